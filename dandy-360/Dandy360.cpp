@@ -2,6 +2,8 @@
 //
 
 #include "stdafx.h"
+#include "LevelUnpack.h"
+#include "Random.h"
 
 //-------------------------------------------------------------------------------------
 // Vertex shader
@@ -312,22 +314,14 @@ public:
         bool failed = true;
         if(in)
         {
-            failed = false;
-            for(int y = 0; y < Height; y++)
+            // Two cells per byte, low nibble first. LevelUnpack does a row at a time.
+            BYTE packed[NumCells / 2];
+            failed = fread(packed, 1, sizeof(packed), in) != sizeof(packed);
+            fclose(in);
+            if(!failed)
             {
-                for(int x = 0; x < Width; x += 2)
-                {
-                    int inb = fgetc(in);
-                    if(inb < 0)
-                    {
-                        failed = true;
-                        break;
-                    }
-                    Cell[y*Width+x] = (BYTE) (inb & 0xf);
-                    Cell[y*Width+x+1] = (BYTE) ((inb >> 4) & 0xf);
-                }
+                LevelUnpack(Cell, packed, Height);
             }
-            fclose(in);
         }
         if(failed)
         {
@@ -574,9 +568,9 @@ public:
         }
     }
 
-    static DWORD getRandom(DWORD range)
+    DWORD getRandom(DWORD range)
     {
-        return rand() % range;
+        return random.Range(range);
     }
 
     Direction GetDirectionOfNearestPlayer(DWORD x, DWORD y)
@@ -1050,6 +1044,9 @@ public:
     Player player[PlayerCount];
     DWORD numPlayers;
     DWORD time;
+    // Init leaves it alone, so restarts carry on through the sequence
+    // rather than replaying it.
+    Random random;
 
     // This information is updated once per tick:
 
@@ -0,0 +1,270 @@
+// Bitplane.h
+//
+// One bit per map cell, for questions like "which cells in this rectangle
+// hold a monster" that would otherwise look at every cell. Map keeps one
+// plane per tile class and updates them in Map::Set.
+//
+// Bits are row-major whatever the map layout, with each row padded to a
+// whole number of 128-bit chunks, so a rectangle query is one masked
+// 128-bit operation per chunk of each row. The SSE2 path is picked at
+// compile time the same way as in LevelUnpack.h; everywhere else the same
+// loops run on pairs of 64-bit words.
+
+#ifndef BITPLANE_H
+#define BITPLANE_H
+
+#include <algorithm>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define BITPLANE_SSE2 1
+#include <emmintrin.h>
+#endif
+
+#if defined(_MSC_VER)
+typedef unsigned __int64 BitplaneWord;
+#else
+typedef unsigned long long BitplaneWord;
+#endif
+
+class Bitplane
+{
+public:
+	static const unsigned long kWordBits = 64;
+	static const unsigned long kChunkWords = 2;	// 128 bits
+
+	Bitplane()
+	{
+		Init(0, 0);
+	}
+
+	void Init(unsigned long width, unsigned long height)
+	{
+		this->width = width;
+		this->height = height;
+		rowWords = (width + kWordBits * kChunkWords - 1) / (kWordBits * kChunkWords) * kChunkWords;
+		words.assign(rowWords * height, 0);
+	}
+
+	void Reset()
+	{
+		std::fill(words.begin(), words.end(), (BitplaneWord) 0);
+	}
+
+	void Set(unsigned long x, unsigned long y)
+	{
+		words[y * rowWords + x / kWordBits] |= Bit(x);
+	}
+
+	void Clear(unsigned long x, unsigned long y)
+	{
+		words[y * rowWords + x / kWordBits] &= ~Bit(x);
+	}
+
+	bool Test(unsigned long x, unsigned long y) const
+	{
+		return (words[y * rowWords + x / kWordBits] & Bit(x)) != 0;
+	}
+
+	// The rectangle is [left, right) x [top, bottom), already clipped to
+	// the plane.
+	bool AnyInRect(unsigned long left, unsigned long top, unsigned long right, unsigned long bottom) const
+	{
+		if(left >= right || top >= bottom)
+		{
+			return false;
+		}
+		for(unsigned long c = left / 128; c <= (right - 1) / 128; c++)
+		{
+			BitplaneWord mask[kChunkWords];
+			ChunkMask(c, left, right, mask);
+			const BitplaneWord* row = &words[top * rowWords + c * kChunkWords];
+#if defined(BITPLANE_SSE2)
+			__m128i m = _mm_loadu_si128((const __m128i*) mask);
+			__m128i any = _mm_setzero_si128();
+			for(unsigned long y = top; y < bottom; y++, row += rowWords)
+			{
+				any = _mm_or_si128(any, _mm_and_si128(_mm_loadu_si128((const __m128i*) row), m));
+			}
+			if(_mm_movemask_epi8(_mm_cmpeq_epi8(any, _mm_setzero_si128())) != 0xffff)
+			{
+				return true;
+			}
+#else
+			BitplaneWord any = 0;
+			for(unsigned long y = top; y < bottom; y++, row += rowWords)
+			{
+				any |= (row[0] & mask[0]) | (row[1] & mask[1]);
+			}
+			if(any)
+			{
+				return true;
+			}
+#endif
+		}
+		return false;
+	}
+
+	unsigned long CountInRect(unsigned long left, unsigned long top, unsigned long right, unsigned long bottom) const
+	{
+		unsigned long count = 0;
+		if(left >= right || top >= bottom)
+		{
+			return 0;
+		}
+		for(unsigned long c = left / 128; c <= (right - 1) / 128; c++)
+		{
+			BitplaneWord mask[kChunkWords];
+			ChunkMask(c, left, right, mask);
+			const BitplaneWord* row = &words[top * rowWords + c * kChunkWords];
+			for(unsigned long y = top; y < bottom; y++, row += rowWords)
+			{
+				count += PopCount(row[0] & mask[0]) + PopCount(row[1] & mask[1]);
+			}
+		}
+		return count;
+	}
+
+	void ClearRect(unsigned long left, unsigned long top, unsigned long right, unsigned long bottom)
+	{
+		if(left >= right || top >= bottom)
+		{
+			return;
+		}
+		for(unsigned long c = left / 128; c <= (right - 1) / 128; c++)
+		{
+			BitplaneWord mask[kChunkWords];
+			ChunkMask(c, left, right, mask);
+			BitplaneWord* row = &words[top * rowWords + c * kChunkWords];
+#if defined(BITPLANE_SSE2)
+			__m128i m = _mm_loadu_si128((const __m128i*) mask);
+			for(unsigned long y = top; y < bottom; y++, row += rowWords)
+			{
+				__m128i* p = (__m128i*) row;
+				_mm_storeu_si128(p, _mm_andnot_si128(m, _mm_loadu_si128(p)));
+			}
+#else
+			for(unsigned long y = top; y < bottom; y++, row += rowWords)
+			{
+				row[0] &= ~mask[0];
+				row[1] &= ~mask[1];
+			}
+#endif
+		}
+	}
+
+	static unsigned long PopCount(BitplaneWord w)
+	{
+		unsigned long count = 0;
+		while(w)
+		{
+			w &= w - 1;
+			++count;
+		}
+		return count;
+	}
+
+	// Bits [left, right) of chunk c, as two words
+	static void ChunkMask(unsigned long c, unsigned long left, unsigned long right, BitplaneWord* mask)
+	{
+		for(unsigned long i = 0; i < kChunkWords; i++)
+		{
+			unsigned long base = (c * kChunkWords + i) * kWordBits;
+			unsigned long lo = left > base ? left - base : 0;
+			unsigned long hi = right > base ? right - base : 0;
+			if(hi > kWordBits)
+			{
+				hi = kWordBits;
+			}
+			if(lo >= hi)
+			{
+				mask[i] = 0;
+				continue;
+			}
+			BitplaneWord upTo = hi == kWordBits ? ~(BitplaneWord) 0 : ((BitplaneWord) 1 << hi) - 1;
+			mask[i] = upTo & ~(((BitplaneWord) 1 << lo) - 1);
+		}
+	}
+
+	static BitplaneWord Bit(unsigned long x)
+	{
+		return (BitplaneWord) 1 << (x % kWordBits);
+	}
+
+	unsigned long width;
+	unsigned long height;
+	unsigned long rowWords;	// Words per row, a multiple of kChunkWords
+	std::vector<BitplaneWord> words;
+};
+
+// Visits the set bits of (a | b) inside a rectangle, top to bottom and
+// left to right, every rowStep'th row. A word is read before any of its
+// bits are returned, so the caller may change the planes as it goes:
+// bits it sets later in the current word are not seen.
+class BitplaneScan
+{
+public:
+	BitplaneScan(const Bitplane& a, const Bitplane& b, unsigned long left, unsigned long top,
+		unsigned long right, unsigned long bottom, unsigned long rowStep)
+		: a(a), b(b), left(left), right(right), bottom(bottom), rowStep(rowStep)
+	{
+		y = top;
+		word = left / Bitplane::kWordBits;
+		bits = 0;
+		if(left < right && top < bottom)
+		{
+			Load();
+		}
+		else
+		{
+			y = bottom;
+		}
+	}
+
+	bool Next(unsigned long& x, unsigned long& outY)
+	{
+		while(!bits)
+		{
+			if(++word > (right - 1) / Bitplane::kWordBits)
+			{
+				word = left / Bitplane::kWordBits;
+				y += rowStep;
+			}
+			if(y >= bottom)
+			{
+				return false;
+			}
+			Load();
+		}
+		unsigned long bit = 0;
+		while(!(bits & ((BitplaneWord) 1 << bit)))
+		{
+			++bit;
+		}
+		bits &= bits - 1;
+		x = word * Bitplane::kWordBits + bit;
+		outY = y;
+		return true;
+	}
+
+private:
+	void Load()
+	{
+		unsigned long i = y * a.rowWords + word;
+		BitplaneWord mask[Bitplane::kChunkWords];
+		Bitplane::ChunkMask(word / Bitplane::kChunkWords, left, right, mask);
+		bits = (a.words[i] | b.words[i]) & mask[word % Bitplane::kChunkWords];
+	}
+
+	const Bitplane& a;
+	const Bitplane& b;
+	unsigned long left;
+	unsigned long right;
+	unsigned long bottom;
+	unsigned long rowStep;
+	unsigned long y;
+	unsigned long word;
+	BitplaneWord bits;
+};
+
+#endif // BITPLANE_H
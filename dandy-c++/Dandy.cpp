@@ -2,6 +2,62 @@
 #include <mmsystem.h>
 #include <d3dx9.h>
 #include <stdio.h>
+#include <process.h>
+#include <vector>
+
+#include "Bitplane.h"
+#include "LevelUnpack.h"
+#include "MapLayout.h"
+#include "Random.h"
+#include "Replay.h"
+
+// A monster or generator where a level starts with one
+struct LevelEntity
+{
+	BYTE x;
+	BYTE y;
+	BYTE kind;
+};
+
+// What Map and World would otherwise scan a level for. Only the embedded
+// levels have one, worked out by tools\make_level_header.py. Lock group g
+// is lockCells[lockGroupStart[g]..lockGroupStart[g+1]), cells as y * 60 + x,
+// numbered the same way Map::FindLockGroups numbers them.
+struct LevelInfo
+{
+	BYTE upX;
+	BYTE upY;
+	WORD monsters;
+	WORD generators;
+	WORD keys;
+	WORD locks;
+	const LevelEntity* entities;	// Row-major
+	WORD entityCount;
+	const WORD* lockGroupStart;
+	WORD lockGroups;
+	const WORD* lockCells;
+};
+
+// Levels compiled into the exe by tools\make_level_header.py, so startup
+// doesn't depend on the working directory. DANDY_EMBEDDED_LEVELS is set
+// only in the Release Embedded configuration: Debug and Release load
+// levels\levels.pak, which they rebuild from the loose level files, so
+// an edited level is picked up by the next build.
+#ifdef DANDY_EMBEDDED_LEVELS
+#include "EmbeddedLevels.h"
+#endif
+
+// The metadata of a level, or NULL if it isn't embedded
+const LevelInfo* GetLevelInfo(DWORD index)
+{
+#ifdef DANDY_EMBEDDED_LEVELS
+	if(index < kEmbeddedLevelCount)
+	{
+		return &kEmbeddedLevelInfo[index];
+	}
+#endif
+	return NULL;
+}
 
 //-----------------------------------------------------------------------------
 // Global variables
@@ -85,20 +141,338 @@ enum MapData
 	kPlayer3
 };
 
+// Map coordinates. Wide enough for maps much bigger than the 60x30 levels.
+typedef DWORD Coord;
+
+// All of the levels in one file, built by tools\make_level_pack.py.
+// Debug and Release rebuild it from the loose level files whenever one
+// of them changes, so it is never out of date and isn't checked in.
+// The file is memory mapped once at startup and levels are unpacked
+// straight out of the mapping.
+//
+// Layout: LevelPackHeader, then one LevelPackEntry per level, then the
+// 4-bit packed level data.
+
+struct LevelPackHeader
+{
+	DWORD magic;
+	DWORD version;
+	DWORD count;
+};
+
+struct LevelPackEntry
+{
+	DWORD offset;	// From the start of the file
+	DWORD size;
+	DWORD checksum;	// Adler-32 of the level data
+};
+
+DWORD Adler32(const BYTE* data, DWORD size)
+{
+	DWORD a = 1;
+	DWORD b = 0;
+	for(DWORD i = 0; i < size; i++)
+	{
+		a = (a + data[i]) % 65521;
+		b = (b + a) % 65521;
+	}
+	return (b << 16) | a;
+}
+
+class LevelPack
+{
+public:
+	LevelPack()
+	{
+		file = INVALID_HANDLE_VALUE;
+		mapping = NULL;
+		base = NULL;
+		size = 0;
+	}
+
+	~LevelPack()
+	{
+		Close();
+	}
+
+	bool Open()
+	{
+		if(base)
+		{
+			return true;
+		}
+		if(!MapFile("levels\\levels.pak") && !MapFile("..\\levels\\levels.pak"))
+		{
+			return false;
+		}
+		if(!Validate())
+		{
+			Close();
+			return false;
+		}
+		return true;
+	}
+
+	void Close()
+	{
+		if(base)
+		{
+			UnmapViewOfFile(base);
+			base = NULL;
+		}
+		if(mapping)
+		{
+			CloseHandle(mapping);
+			mapping = NULL;
+		}
+		if(file != INVALID_HANDLE_VALUE)
+		{
+			CloseHandle(file);
+			file = INVALID_HANDLE_VALUE;
+		}
+		size = 0;
+	}
+
+	// Returns NULL if the pack isn't open or doesn't contain the level.
+	const BYTE* GetLevel(DWORD index, DWORD& levelSize)
+	{
+		if(!base || index >= Header()->count)
+		{
+			return NULL;
+		}
+		const LevelPackEntry* pE = Entries() + index;
+		levelSize = pE->size;
+		return base + pE->offset;
+	}
+
+	// The Adler-32 of the level's data, or false as for GetLevel
+	bool GetChecksum(DWORD index, DWORD& checksum)
+	{
+		if(!base || index >= Header()->count)
+		{
+			return false;
+		}
+		checksum = Entries()[index].checksum;
+		return true;
+	}
+
+	static const DWORD kMagic = 0x4B415044; // "DPAK"
+	static const DWORD kVersion = 1;
+
+private:
+	bool MapFile(const char* fileName)
+	{
+		file = CreateFile(fileName, GENERIC_READ, FILE_SHARE_READ, NULL,
+			OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+		if(file == INVALID_HANDLE_VALUE)
+		{
+			return false;
+		}
+		size = GetFileSize(file, NULL);
+		mapping = CreateFileMapping(file, NULL, PAGE_READONLY, 0, 0, NULL);
+		if(mapping)
+		{
+			base = (const BYTE*) MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+		}
+		if(!base)
+		{
+			Close();
+			return false;
+		}
+		return true;
+	}
+
+	// Check the whole pack once, so GetLevel can trust it afterwards.
+	bool Validate()
+	{
+		if(size < sizeof(LevelPackHeader))
+		{
+			return false;
+		}
+		const LevelPackHeader* pH = Header();
+		if(pH->magic != kMagic || pH->version != kVersion
+			|| pH->count > (size - sizeof(LevelPackHeader)) / sizeof(LevelPackEntry))
+		{
+			return false;
+		}
+		for(DWORD i = 0; i < pH->count; i++)
+		{
+			const LevelPackEntry* pE = Entries() + i;
+			if(pE->offset > size || pE->size > size - pE->offset)
+			{
+				return false;
+			}
+			if(Adler32(base + pE->offset, pE->size) != pE->checksum)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	const LevelPackHeader* Header()
+	{
+		return (const LevelPackHeader*) base;
+	}
+
+	const LevelPackEntry* Entries()
+	{
+		return (const LevelPackEntry*) (base + sizeof(LevelPackHeader));
+	}
+
+	HANDLE file;
+	HANDLE mapping;
+	const BYTE* base;
+	DWORD size;
+};
+
+LevelPack gLevelPack;
+
+// Big maps can be stored in 8x8 tiles; see MapLayout.h.
+#ifdef DANDY_TILED_MAP
+typedef TiledLayout MapLayout;
+#else
+typedef RowMajorLayout MapLayout;
+#endif
+
+// The size of a map is set at runtime. The level files are all
+// LevelWidth x LevelHeight, and loading one resizes the map to match;
+// bigger maps are made with Resize and filled in with Set.
+//
+// Cells are stored in whatever order MapLayout says, so go through
+// Get/Set, or SetRows/GetRows to copy a whole row-major map in or out.
 class Map
 {
 public:
 	Map()
 	{
+		Resize(LevelWidth, LevelHeight);
 		Init();
 	}
 
-	MapData Get(DWORD x, DWORD y)
+	void Resize(Coord width, Coord height)
+	{
+		Width = width;
+		Height = height;
+		NumCells = width * height;
+		Layout.Init(width, height);
+		Cell.resize(Layout.size);
+		Walls.Init(width, height);
+		Items.Init(width, height);
+		Monsters.Init(width, height);
+		Generators.Init(width, height);
+		Players.Init(width, height);
+	}
+
+	// The bitplane that tracks cells holding v, or NULL
+	Bitplane* PlaneOf(int v)
+	{
+		if(v == kWall || v == kLock)
+		{
+			return &Walls;
+		}
+		if(v >= kKey && v <= kBomb || v == kHeart)
+		{
+			return &Items;
+		}
+		if(v >= kGhost && v <= kBig)
+		{
+			return &Monsters;
+		}
+		if(v >= kGen1 && v <= kGen3)
+		{
+			return &Generators;
+		}
+		if(v >= kPlayer0 && v <= kPlayer3)
+		{
+			return &Players;
+		}
+		return NULL;
+	}
+
+	// Rebuilds everything derived from Cell, after writing it directly
+	void Reindex()
+	{
+		RebuildPlanes();
+		FindLockGroups();
+	}
+
+	void RebuildPlanes()
+	{
+		Walls.Reset();
+		Items.Reset();
+		Monsters.Reset();
+		Generators.Reset();
+		Players.Reset();
+		for(Coord y = 0; y < Height; y++)
+		{
+			for(Coord x = 0; x < Width; x++)
+			{
+				Bitplane* plane = PlaneOf(Cell[Layout.Index(x, y)]);
+				if(plane)
+				{
+					plane->Set(x, y);
+				}
+			}
+		}
+	}
+
+	// Copy in a row-major map of Width x Height cells
+	void SetRows(const BYTE* rows)
+	{
+		CopyRows(rows);
+		Reindex();
+	}
+
+	// Like SetRows, but takes the lock groups from the level's metadata
+	void SetRows(const BYTE* rows, const LevelInfo& info)
+	{
+		CopyRows(rows);
+		RebuildPlanes();
+		SetLockGroups(info);
+	}
+
+	void CopyRows(const BYTE* rows)
+	{
+		if(MapLayout::IsRowMajor)
+		{
+			memcpy(&Cell[0], rows, NumCells);
+		}
+		else
+		{
+			for(Coord y = 0; y < Height; y++)
+			{
+				for(Coord x = 0; x < Width; x++)
+				{
+					Cell[Layout.Index(x, y)] = *rows++;
+				}
+			}
+		}
+	}
+
+	// Copy out a row-major map of Width x Height cells
+	void GetRows(BYTE* rows) const
+	{
+		if(MapLayout::IsRowMajor)
+		{
+			memcpy(rows, &Cell[0], NumCells);
+			return;
+		}
+		for(Coord y = 0; y < Height; y++)
+		{
+			for(Coord x = 0; x < Width; x++)
+			{
+				*rows++ = Cell[Layout.Index(x, y)];
+			}
+		}
+	}
+
+	MapData Get(Coord x, Coord y)
 	{
 		MapData b = kSpace;
 		if(x >= 0 && x < Width && y >= 0 && y < Height)
 		{
-			b = (MapData) Cell[x + y*Width];
+			b = (MapData) Cell[Layout.Index(x, y)];
 		}
 		else
 		{
@@ -107,12 +481,12 @@ public:
 		return b;
 	}
 
-	MapData Get(DWORD x, DWORD y, Direction dir)
+	MapData Get(Coord x, Coord y, Direction dir)
 	{
 		MapData b = kSpace;
 		if(x >= 0 && x < Width && y >= 0 && y < Height)
 		{
-			b = (MapData) Cell[x + y*Width];
+			b = (MapData) Cell[Layout.Index(x, y)];
 		}
 		else
 		{
@@ -121,11 +495,22 @@ public:
 		return b;
 	}
 
-	void Set(DWORD x, DWORD y, int v)
+	void Set(Coord x, Coord y, int v)
 	{
 		if(x >= 0 && x < Width && y >= 0 && y < Height && v <= kPlayer3)
 		{
-			Cell[x + y*Width] = v;
+			BYTE& cell = Cell[Layout.Index(x, y)];
+			Bitplane* plane = PlaneOf(cell);
+			if(plane)
+			{
+				plane->Clear(x, y);
+			}
+			plane = PlaneOf(v);
+			if(plane)
+			{
+				plane->Set(x, y);
+			}
+			cell = v;
 		}
 		else
 		{
@@ -133,13 +518,27 @@ public:
 		}
 	}
 
-	bool Find(BYTE& rx, BYTE& ry, MapData v)
+	// Every cell of plane's class inside [left, right) x [top, bottom)
+	// becomes kSpace
+	void ClearInRect(Bitplane& plane, Coord left, Coord top, Coord right, Coord bottom)
+	{
+		BitplaneScan scan(plane, plane, left, top, right, bottom, 1);
+		Coord x;
+		Coord y;
+		while(scan.Next(x, y))
+		{
+			Cell[Layout.Index(x, y)] = kSpace;
+		}
+		plane.ClearRect(left, top, right, bottom);
+	}
+
+	bool Find(Coord& rx, Coord& ry, MapData v)
 	{
-		for(int y = 0; y < Height; y++)
+		for(Coord y = 0; y < Height; y++)
 		{
-			for(int x = 0; x < Width; x++)
+			for(Coord x = 0; x < Width; x++)
 			{
-				if(Cell[x + y * Width] == v)
+				if(Cell[Layout.Index(x, y)] == v)
 				{
 					rx = x;
 					ry = y;
@@ -150,24 +549,147 @@ public:
 		return false;
 	}
 
-	void OpenLock(DWORD x, DWORD y)
+	// Opens the whole 8-way connected group of locks this one is in.
+	// Locks are never added during play and a group only ever opens all
+	// at once, so the groups found at load time stay right.
+	void OpenLock(Coord x, Coord y)
+	{
+		if(Get(x, y) != kLock)
+		{
+			return;
+		}
+		DWORD group = LockGroup[y * Width + x];
+		for(DWORD i = LockGroupStart[group]; i < LockGroupStart[group + 1]; i++)
+		{
+			DWORD cell = LockCells[i];
+			Set(cell % Width, cell / Width, kSpace);
+		}
+	}
+
+	// Labels the 8-way connected groups of locks with union-find, then
+	// lists each group's cells (as y * Width + x) contiguously in LockCells.
+	void FindLockGroups()
+	{
+		std::vector<DWORD> parent(NumCells, (DWORD) kNoGroup);
+		for(Coord y = 0; y < Height; y++)
+		{
+			for(Coord x = 0; x < Width; x++)
+			{
+				if(Cell[Layout.Index(x, y)] != kLock)
+				{
+					continue;
+				}
+				DWORD n = y * Width + x;
+				parent[n] = n;
+				// The neighbours already visited: left, up-left, up, up-right
+				if(x > 0)
+				{
+					JoinLocks(parent, n, n - 1);
+				}
+				if(y > 0)
+				{
+					if(x > 0)
+					{
+						JoinLocks(parent, n, n - Width - 1);
+					}
+					JoinLocks(parent, n, n - Width);
+					if(x + 1 < Width)
+					{
+						JoinLocks(parent, n, n - Width + 1);
+					}
+				}
+			}
+		}
+
+		// Number the groups, then counting-sort the cells into them
+		LockGroup.assign(NumCells, (DWORD) kNoGroup);
+		LockGroupStart.assign(1, 0);
+		DWORD groups = 0;
+		for(DWORD n = 0; n < NumCells; n++)
+		{
+			if(parent[n] == kNoGroup)
+			{
+				continue;
+			}
+			DWORD root = FindLockRoot(parent, n);
+			if(LockGroup[root] == kNoGroup)
+			{
+				LockGroup[root] = groups++;
+				LockGroupStart.push_back(0);
+			}
+			LockGroup[n] = LockGroup[root];
+			LockGroupStart[LockGroup[n] + 1]++;
+		}
+		for(DWORD g = 0; g < groups; g++)
+		{
+			LockGroupStart[g + 1] += LockGroupStart[g];
+		}
+		LockCells.resize(LockGroupStart[groups]);
+		std::vector<DWORD> next(LockGroupStart.begin(), LockGroupStart.end() - 1);
+		for(DWORD n = 0; n < NumCells; n++)
+		{
+			if(LockGroup[n] != kNoGroup)
+			{
+				LockCells[next[LockGroup[n]]++] = n;
+			}
+		}
+	}
+
+	void SetLockGroups(const LevelInfo& info)
+	{
+		MyAssert(Width == LevelWidth && Height == LevelHeight);
+		DWORD first = info.lockGroupStart[0];
+		DWORD end = info.lockGroupStart[info.lockGroups];
+		LockGroup.assign(NumCells, (DWORD) kNoGroup);
+		LockGroupStart.resize(info.lockGroups + 1);
+		LockCells.assign(info.lockCells + first, info.lockCells + end);
+		for(DWORD g = 0; g <= info.lockGroups; g++)
+		{
+			LockGroupStart[g] = info.lockGroupStart[g] - first;
+		}
+		for(DWORD g = 0; g < info.lockGroups; g++)
+		{
+			for(DWORD i = LockGroupStart[g]; i < LockGroupStart[g + 1]; i++)
+			{
+				LockGroup[LockCells[i]] = g;
+			}
+		}
+	}
+
+	static DWORD FindLockRoot(std::vector<DWORD>& parent, DWORD n)
+	{
+		while(parent[n] != n)
+		{
+			parent[n] = parent[parent[n]];
+			n = parent[n];
+		}
+		return n;
+	}
+
+	static void JoinLocks(std::vector<DWORD>& parent, DWORD a, DWORD b)
 	{
-		// Flood fill from this coord
-		if(Cell[x + y * Width] == kLock)
+		if(parent[b] == kNoGroup)
+		{
+			return;
+		}
+		a = FindLockRoot(parent, a);
+		b = FindLockRoot(parent, b);
+		// Keep the smaller index as the root
+		if(a < b)
+		{
+			parent[b] = a;
+		}
+		else if(b < a)
 		{
-			Cell[x + y * Width] = kSpace;
-			for(int dy = -1;dy <= 1; dy++)
-				for(int dx = -1;dx <= 1; dx++)
-					if(dx != 0 || dy != 0)
-						OpenLock(x + dx, y + dy);
+			parent[a] = b;
 		}
 	}
 
 	void Init()
 	{
-		for(DWORD y = 0; y < Height; y++)
+		for(Coord y = 0; y < Height; y++)
 		{
-			for(DWORD x = 0; x < Width; x++)
+			for(Coord x = 0; x < Width; x++)
 			{
 				BYTE b = kSpace;
 				if(y == 0 || y == Height-1 || x == 0 || x == Width - 1)
@@ -182,12 +704,42 @@ public:
 				{
 					b = kDown;
 				}
-				Cell[y*Width+x] = b;
+				Cell[Layout.Index(x, y)] = b;
 			}
 		}
+		Reindex();
 	}
 
 	bool LoadLevel(DWORD index)
+	{
+		Resize(LevelWidth, LevelHeight);
+#ifdef DANDY_EMBEDDED_LEVELS
+		if(index < kEmbeddedLevelCount)
+		{
+			SetRows(kEmbeddedLevels[index], kEmbeddedLevelInfo[index]);
+			return true;
+		}
+#endif
+		DWORD packedSize = 0;
+		const BYTE* packed = gLevelPack.GetLevel(index, packedSize);
+		if(packed && packedSize >= PackedSize)
+		{
+			Unpack(packed);
+			return true;
+		}
+
+		// No level pack, so fall back to the loose level files
+		BYTE buffer[PackedSize];
+		if(!ReadLevelFile(index, buffer))
+		{
+			Init();
+			return false;
+		}
+		Unpack(buffer);
+		return true;
+	}
+
+	static bool ReadLevelFile(DWORD index, BYTE* packed)
 	{
 		char fileName[MAX_PATH];
 		FILE* in;
@@ -197,66 +749,412 @@ public:
 			sprintf(fileName, "..\\levels\\level.%c", index + 'a');
 			in = fopen(fileName, "rb");
 		}
-		bool failed = true;
-		if(in)
+		if(!in)
 		{
-			failed = false;
-			for(int y = 0; y < Height; y++)
-			{
-				for(int x = 0; x < Width; x += 2)
-				{
-					int inb = fgetc(in);
-					if(inb < 0)
-					{
-						failed = true;
-						break;
-					}
-					Cell[y*Width+x] = (BYTE) (inb & 0xf);
-					Cell[y*Width+x+1] = (BYTE) ((inb >> 4) & 0xf);
-				}
-			}
-			fclose(in);
+			return false;
 		}
-		if(failed)
+		bool ok = fread(packed, 1, PackedSize, in) == PackedSize;
+		fclose(in);
+		return ok;
+	}
+
+	// The Adler-32 of the level LoadLevel would unpack, from the pack's
+	// table if it has the level, or 0 if there is no such level
+	static DWORD LevelChecksum(DWORD index)
+	{
+		DWORD checksum = 0;
+		if(gLevelPack.GetChecksum(index, checksum))
 		{
-			Init();
+			return checksum;
 		}
-		return !failed;
+		BYTE buffer[PackedSize];
+		return ReadLevelFile(index, buffer) ? Adler32(buffer, PackedSize) : 0;
 	}
 
-	void GetActive(float& x, float& y, DWORD& left, DWORD& top, DWORD& right, DWORD& bottom)
+	// Two cells per byte, low nibble first. LevelUnpack does a row at a time.
+	void Unpack(const BYTE* packed)
 	{
-		GetActive1(x, left, right, Map::Width, Map::ViewWidth);
-		GetActive1(y, top, bottom, Map::Height, Map::ViewHeight);
+		MyAssert(Width == LEVEL_UNPACK_ROW_CELLS && Height == LevelHeight);
+		if(MapLayout::IsRowMajor)
+		{
+			LevelUnpack(&Cell[0], packed, Height);
+			Reindex();
+			return;
+		}
+		BYTE rows[LevelCells];
+		LevelUnpack(rows, packed, Height);
+		SetRows(rows);
+	}
+
+	void GetActive(float& x, float& y, Coord& left, Coord& top, Coord& right, Coord& bottom)
+	{
+		GetActive1(x, left, right, Width, ViewWidth);
+		GetActive1(y, top, bottom, Height, ViewHeight);
 	}
 
-	void GetActive1(float& x, DWORD& left, DWORD& right, DWORD width, DWORD viewWidth)
+	void GetActive1(float& x, Coord& left, Coord& right, Coord width, Coord viewWidth)
 	{
 		x -= (viewWidth / 2.0f);
 		x = max(x, 0.f);
-		x = min(x, width - viewWidth);
-		left = (DWORD) x;
+		// Maps narrower than the view don't scroll
+		x = min(x, (float) (width > viewWidth ? width - viewWidth : 0));
+		left = (Coord) x;
 		right = min(left + viewWidth + 1, width);
 	}
 
-	const static DWORD Width = 60;
-	const static DWORD Height = 30;
-	const static DWORD NumCells = Width * Height;
-	BYTE Cell[NumCells];
+	Coord Width;
+	Coord Height;
+	DWORD NumCells;
+	MapLayout Layout;
+	std::vector<BYTE> Cell;
+
+	// One bit per cell for each class of tile, kept up to date by Set
+	Bitplane Walls;		// kWall, kLock
+	Bitplane Items;		// kKey..kBomb, kHeart
+	Bitplane Monsters;	// kGhost..kBig
+	Bitplane Generators;	// kGen1..kGen3
+	Bitplane Players;	// kPlayer0..kPlayer3
+
+	// Groups of connected locks, found by FindLockGroups. All three are
+	// indexed by y * Width + x whatever the layout.
+	std::vector<DWORD> LockGroup;		// Group of each cell, or kNoGroup
+	std::vector<DWORD> LockGroupStart;	// Group g is LockCells[start[g]..start[g+1])
+	std::vector<DWORD> LockCells;
+	const static DWORD kNoGroup = 0xffffffff;
+
+	// Size of the maps in the level files
+	const static Coord LevelWidth = 60;
+	const static Coord LevelHeight = 30;
+	const static DWORD LevelCells = LevelWidth * LevelHeight;
+	const static DWORD PackedSize = LevelCells / 2;
 
 	const static DWORD ViewWidth = 20;
 	const static DWORD ViewHeight = 10;
 };
 
-class Arrow
+// Decodes the next level on a worker thread while the current one is being
+// played, so going down the stairs doesn't stall a frame on file I/O.
+//
+// There is a single slot. The main thread owns it while it is kIdle or
+// kReady and the worker owns it while it is kBusy. Each side hands it over
+// with one interlocked exchange, so neither ever waits on the other.
+class LevelPrefetcher
 {
 public:
-	Arrow()
+	LevelPrefetcher()
 	{
-		alive = false;
-		x = 0;
-		y = 0;
-		dir = kDirNone;
+		thread = NULL;
+		wake = NULL;
+		quit = 0;
+		state = kIdle;
+		index = 0;
+	}
+
+	~LevelPrefetcher()
+	{
+		Stop();
+	}
+
+	bool Start()
+	{
+		if(thread)
+		{
+			return true;
+		}
+		wake = CreateEvent(NULL, FALSE, FALSE, NULL);
+		if(!wake)
+		{
+			return false;
+		}
+		quit = 0;
+		state = kIdle;
+		unsigned threadId;
+		thread = (HANDLE) _beginthreadex(NULL, 0, ThreadProc, this, 0, &threadId);
+		if(!thread)
+		{
+			CloseHandle(wake);
+			wake = NULL;
+			return false;
+		}
+		return true;
+	}
+
+	void Stop()
+	{
+		if(thread)
+		{
+			InterlockedExchange(&quit, 1);
+			SetEvent(wake);
+			WaitForSingleObject(thread, INFINITE);
+			CloseHandle(thread);
+			thread = NULL;
+		}
+		if(wake)
+		{
+			CloseHandle(wake);
+			wake = NULL;
+		}
+		state = kIdle;
+	}
+
+	// Start decoding a level in the background. Ignored if the worker is
+	// still busy with the last request; Take will just miss.
+	void Request(DWORD level)
+	{
+		if(!thread || state == kBusy)
+		{
+			return;
+		}
+		index = level;
+		InterlockedExchange(&state, kBusy);
+		SetEvent(wake);
+	}
+
+	// Copy the prefetched level into map if it is the one we want.
+	// Returns false if it isn't ready yet, or is some other level.
+	bool Take(DWORD level, Map& map)
+	{
+		if(InterlockedCompareExchange(&state, kIdle, kReady) != kReady)
+		{
+			return false;
+		}
+		if(index != level)
+		{
+			return false;
+		}
+		map = buffer;
+		return true;
+	}
+
+private:
+	enum State
+	{
+		kIdle,
+		kBusy,
+		kReady
+	};
+
+	static unsigned __stdcall ThreadProc(void* context)
+	{
+		((LevelPrefetcher*) context)->Run();
+		return 0;
+	}
+
+	void Run()
+	{
+		for(;;)
+		{
+			WaitForSingleObject(wake, INFINITE);
+			if(quit)
+			{
+				break;
+			}
+			if(state == kBusy)
+			{
+				// A failed load goes back to kIdle, and the main thread
+				// loads it itself with the usual fallbacks.
+				InterlockedExchange(&state, buffer.LoadLevel(index) ? kReady : kIdle);
+			}
+		}
+	}
+
+	HANDLE thread;
+	HANDLE wake;
+	volatile LONG quit;
+	volatile LONG state;
+	DWORD index;
+	Map buffer;
+};
+
+LevelPrefetcher gLevelPrefetcher;
+
+// Every level as it is on disk, decoded once and kept in one block of
+// memory along with where the party starts. Restarting or revisiting a
+// level is then a copy instead of a load. Filled from the main thread;
+// once Freeze is called it is only read, so any number of threads can
+// load levels from it.
+class LevelCache
+{
+public:
+	LevelCache()
+	{
+		memset(cached, 0, sizeof(cached));
+		frozen = false;
+	}
+
+	// Ignore Store from now on
+	void Freeze()
+	{
+		frozen = true;
+	}
+
+	bool Has(DWORD index)
+	{
+		return index < kNumLevels && cached[index];
+	}
+
+	// The level's row-major cells, or NULL if it isn't cached
+	const BYTE* Cells(DWORD index) const
+	{
+		return index < kNumLevels && cached[index] ? cells[index] : NULL;
+	}
+
+	bool Load(DWORD index, Map& map, Coord& startX, Coord& startY)
+	{
+		if(!Has(index))
+		{
+			return false;
+		}
+		map.Resize(Map::LevelWidth, Map::LevelHeight);
+		map.SetRows(cells[index]);
+		startX = start[index][0];
+		startY = start[index][1];
+		return true;
+	}
+
+	void Store(DWORD index, const Map& map, Coord startX, Coord startY)
+	{
+		if(!frozen && index < kNumLevels && map.NumCells == Map::LevelCells)
+		{
+			map.GetRows(cells[index]);
+			start[index][0] = startX;
+			start[index][1] = startY;
+			cached[index] = true;
+		}
+	}
+
+	const static DWORD kNumLevels = 26;
+
+private:
+	BYTE cells[kNumLevels][Map::LevelCells];
+	Coord start[kNumLevels][2];
+	bool cached[kNumLevels];
+	bool frozen;
+};
+
+LevelCache gLevelCache;
+
+// Every monster and generator on the map, as parallel arrays so the
+// per-tick passes walk packed memory instead of rescanning the map.
+// World keeps these in step with the map: each cell holding one has
+// exactly one slot, and slotAt (indexed like Map::Cell) finds it again.
+// Remove swaps the last slot into the hole, so a pass that walks the
+// slots from the end can remove the one it is on, and never sees slots
+// added during the pass.
+class Entities
+{
+public:
+	static bool IsEntity(MapData d)
+	{
+		return IsMonster(d) || d >= kGen1 && d <= kGen3;
+	}
+
+	static bool IsMonster(MapData d)
+	{
+		return d >= kGhost && d <= kBig;
+	}
+
+	void Rebuild(const Map& map)
+	{
+		x.clear();
+		y.clear();
+		kind.clear();
+		slotAt.assign(map.Layout.size, (DWORD) kNoSlot);
+		for(Coord cy = 0; cy < map.Height; cy++)
+		{
+			for(Coord cx = 0; cx < map.Width; cx++)
+			{
+				MapData d = (MapData) map.Cell[map.Layout.Index(cx, cy)];
+				if(IsEntity(d))
+				{
+					Add(map, cx, cy, d);
+				}
+			}
+		}
+	}
+
+	// Same as Rebuild on the level as it was loaded, without the scan
+	void Seed(const Map& map, const LevelInfo& info)
+	{
+		x.clear();
+		y.clear();
+		kind.clear();
+		slotAt.assign(map.Layout.size, (DWORD) kNoSlot);
+		for(DWORD i = 0; i < info.entityCount; i++)
+		{
+			const LevelEntity& e = info.entities[i];
+			MyAssert(map.Cell[map.Layout.Index(e.x, e.y)] == e.kind);
+			Add(map, e.x, e.y, (MapData) e.kind);
+		}
+	}
+
+	DWORD Count() const
+	{
+		return (DWORD) x.size();
+	}
+
+	void Add(const Map& map, Coord cx, Coord cy, MapData d)
+	{
+		slotAt[map.Layout.Index(cx, cy)] = Count();
+		x.push_back(cx);
+		y.push_back(cy);
+		kind.push_back((BYTE) d);
+	}
+
+	void Remove(const Map& map, DWORD slot)
+	{
+		DWORD last = Count() - 1;
+		slotAt[map.Layout.Index(x[slot], y[slot])] = kNoSlot;
+		if(slot != last)
+		{
+			x[slot] = x[last];
+			y[slot] = y[last];
+			kind[slot] = kind[last];
+			slotAt[map.Layout.Index(x[slot], y[slot])] = slot;
+		}
+		x.pop_back();
+		y.pop_back();
+		kind.pop_back();
+	}
+
+	void Move(const Map& map, DWORD slot, Coord cx, Coord cy)
+	{
+		slotAt[map.Layout.Index(x[slot], y[slot])] = kNoSlot;
+		x[slot] = cx;
+		y[slot] = cy;
+		slotAt[map.Layout.Index(cx, cy)] = slot;
+	}
+
+	DWORD Find(const Map& map, Coord cx, Coord cy) const
+	{
+		if(cx >= map.Width || cy >= map.Height)
+		{
+			return kNoSlot;
+		}
+		return slotAt[map.Layout.Index(cx, cy)];
+	}
+
+	const static DWORD kNoSlot = 0xffffffff;
+
+	std::vector<Coord> x;
+	std::vector<Coord> y;
+	std::vector<BYTE> kind;
+	std::vector<DWORD> slotAt;
+};
+
+// One arrow per player, as parallel arrays indexed by player.
+class Arrows
+{
+public:
+	Arrows()
+	{
+		for(int i = 0; i < kCount; i++)
+		{
+			alive[i] = false;
+			x[i] = 0;
+			y[i] = 0;
+			dir[i] = kDirNone;
+		}
 	}
 
 	static bool CanGo(MapData d)
@@ -269,10 +1167,11 @@ public:
 		return d >= kBomb && d <= kGen3;
 	}
 
-	bool alive;
-	BYTE x;
-	BYTE y;
-	Direction dir;
+	const static int kCount = 4; // World::PlayerCount
+	bool alive[kCount];
+	Coord x[kCount];
+	Coord y[kCount];
+	Direction dir[kCount];
 };
 
 enum PlayerState
@@ -300,15 +1199,15 @@ public:
 		keys = 0;
 		score = 0;
 		dir = kDirNone;
-		lastMoveTime = 0;
+		lastMoveTick = 0;
 	}
 
-	bool IsAlive()
+	bool IsAlive() const
 	{
 		return health > 0;
 	}
 
-	bool IsVisible()
+	bool IsVisible() const
 	{
 		return health > 0 && state == kNormal;
 	}
@@ -323,17 +1222,253 @@ public:
 	}
 
 	static const int kHealthMax = 9;
-	BYTE x;
-	BYTE y;
+	Coord x;
+	Coord y;
 	BYTE health;
 	BYTE food;
 	BYTE keys;
 	BYTE bombs;
 	DWORD score;
 	PlayerState state;
-	DWORD lastMoveTime;
+	DWORD lastMoveTick;
 	Direction dir;
-	Arrow arrow;
+};
+
+// Steps from each cell of the active window to the nearest visible
+// player, counting 8-way moves over cells a monster could get through.
+// One breadth-first search seeded from every player at once serves all
+// the monsters, and it is only redone when the window moves or World
+// calls Invalidate because a player or the walls have changed.
+class FlowField
+{
+public:
+	FlowField()
+	{
+		dirty = true;
+		left = 0;
+		top = 0;
+		right = 0;
+		bottom = 0;
+	}
+
+	// Monsters, arrows and players get out of the way; anything else blocks
+	static bool IsPassable(MapData d)
+	{
+		return d == kSpace || d >= kGhost && d <= kBig || d >= kArrow0;
+	}
+
+	void Invalidate()
+	{
+		dirty = true;
+	}
+
+	void Build(const Map& map, Coord l, Coord t, Coord r, Coord b, const Player* players, DWORD numPlayers)
+	{
+		if(!dirty && l == left && t == top && r == right && b == bottom)
+		{
+			return;
+		}
+		dirty = false;
+		left = l;
+		top = t;
+		right = r;
+		bottom = b;
+		width = r - l;
+		DWORD cells = width * (b - t);
+		distance.assign(cells, (DWORD) kUnreached);
+		queue.resize(cells);
+
+		DWORD head = 0;
+		DWORD tail = 0;
+		for(DWORD i = 0; i < numPlayers; i++)
+		{
+			const Player* p = &players[i];
+			if(p->IsVisible() && Contains(p->x, p->y))
+			{
+				DWORD n = LocalIndex(p->x, p->y);
+				if(distance[n] != 0)
+				{
+					distance[n] = 0;
+					queue[tail++] = n;
+				}
+			}
+		}
+
+		while(head < tail)
+		{
+			DWORD n = queue[head++];
+			Coord x = left + n % width;
+			Coord y = top + n / width;
+			DWORD next = distance[n] + 1;
+			for(int dir = 0; dir < 8; dir++)
+			{
+				// Off the left or top edge wraps round to a huge Coord
+				Coord nx = x + kOffsets[dir][0];
+				Coord ny = y + kOffsets[dir][1];
+				if(!Contains(nx, ny))
+				{
+					continue;
+				}
+				DWORD m = LocalIndex(nx, ny);
+				if(distance[m] == kUnreached && IsPassable((MapData) map.Cell[map.Layout.Index(nx, ny)]))
+				{
+					distance[m] = next;
+					queue[tail++] = m;
+				}
+			}
+		}
+	}
+
+	DWORD Get(Coord x, Coord y) const
+	{
+		return Contains(x, y) ? distance[LocalIndex(x, y)] : kUnreached;
+	}
+
+	const static DWORD kUnreached = 0xffffffff;
+
+private:
+	bool Contains(Coord x, Coord y) const
+	{
+		return x >= left && x < right && y >= top && y < bottom;
+	}
+
+	DWORD LocalIndex(Coord x, Coord y) const
+	{
+		return (y - top) * width + (x - left);
+	}
+
+	static const signed char kOffsets[8][2];
+
+	bool dirty;
+	Coord left;
+	Coord top;
+	Coord right;
+	Coord bottom;
+	Coord width;
+	std::vector<DWORD> distance;
+	std::vector<DWORD> queue;
+};
+
+// Up is zero, clockwise, the same as World::MoveCoords
+const signed char FlowField::kOffsets[8][2] =
+{
+	{0,-1},{1,-1},{1,0},{1,1},{0,1},{-1,1},{-1,0},{-1,-1}
+};
+
+// Everything World::Restore needs to carry on a game exactly as it was,
+// as one flat block of plain fixed-width fields (about 2K) to keep, copy
+// about or write out. Entities and the flow field aren't kept: they
+// follow from the map. Only level-sized maps fit, so positions are bytes.
+// The fields before cells have no padding, and a delta holds them as
+// they are.
+struct WorldSnapshot
+{
+	enum { kPlayers = Arrows::kCount };	// World::PlayerCount
+
+	RandomWord randomState;
+	RandomWord randomInc;
+	DWORD tick;
+	DWORD numPlayers;
+	DWORD playerScore[kPlayers];
+	DWORD playerLastMoveTick[kPlayers];
+	BYTE playerX[kPlayers];
+	BYTE playerY[kPlayers];
+	BYTE playerHealth[kPlayers];
+	BYTE playerFood[kPlayers];
+	BYTE playerKeys[kPlayers];
+	BYTE playerBombs[kPlayers];
+	BYTE playerState[kPlayers];	// PlayerState
+	BYTE playerDir[kPlayers];	// Direction
+	BYTE arrowAlive[kPlayers];
+	BYTE arrowX[kPlayers];
+	BYTE arrowY[kPlayers];
+	BYTE arrowDir[kPlayers];	// Direction
+	BYTE level;
+	BYTE cells[Map::LevelCells];	// Row-major, and last so a delta can stop before it
+};
+
+// A snapshot's cells as the runs of cells that differ from the level as
+// it was loaded: for each run, a varint (7 bits a byte, low first) of
+// unchanged cells to skip, a varint of changed cells, then those cells.
+// The same runs as dandy-gb's dandy_snapshot_delta.
+class CellDelta
+{
+public:
+	static void Encode(const BYTE* pristine, const BYTE* cells, DWORD count, std::vector<BYTE>& out)
+	{
+		DWORD cell = 0;
+		DWORD skipFrom = 0;
+		while(cell < count)
+		{
+			if(cells[cell] == pristine[cell])
+			{
+				cell++;
+				continue;
+			}
+			DWORD runFrom = cell;
+			while(cell < count && cells[cell] != pristine[cell])
+			{
+				cell++;
+			}
+			PutVarint(out, runFrom - skipFrom);
+			PutVarint(out, cell - runFrom);
+			out.insert(out.end(), cells + runFrom, cells + cell);
+			skipFrom = cell;
+		}
+	}
+
+	// cells holds the pristine level and gets the runs. Returns false on
+	// a malformed delta, with cells half written.
+	static bool Decode(const BYTE* in, size_t size, BYTE* cells, DWORD count)
+	{
+		size_t pos = 0;
+		DWORD cell = 0;
+		while(pos < size)
+		{
+			DWORD skip;
+			DWORD run;
+			if(!GetVarint(in, size, pos, skip) || !GetVarint(in, size, pos, run) ||
+				run == 0 || skip > count - cell || run > count - cell - skip || run > size - pos)
+			{
+				return false;
+			}
+			cell += skip;
+			memcpy(cells + cell, in + pos, run);
+			cell += run;
+			pos += run;
+		}
+		return true;
+	}
+
+private:
+	static void PutVarint(std::vector<BYTE>& out, DWORD v)
+	{
+		while(v >= 0x80)
+		{
+			out.push_back((BYTE) (v | 0x80));
+			v >>= 7;
+		}
+		out.push_back((BYTE) v);
+	}
+
+	static bool GetVarint(const BYTE* in, size_t size, size_t& pos, DWORD& v)
+	{
+		v = 0;
+		for(int shift = 0; shift < 32; shift += 7)
+		{
+			if(pos == size)
+			{
+				return false;
+			}
+			BYTE b = in[pos++];
+			v |= (DWORD) (b & 0x7f) << shift;
+			if(!(b & 0x80))
+			{
+				return true;
+			}
+		}
+		return false;
+	}
 };
 
 class World
@@ -346,25 +1481,223 @@ public:
 	void Init()
 	{
 		map.Init();
+		entities.Rebuild(map);
+		flow.Invalidate();
+		// Far enough in that nobody waits for their first move
+		tick = kTicksPerMove;
 		numPlayers = 2;
 		for(DWORD i = 0; i < numPlayers; i++)
 		{
 			player[i].Init();
+			arrows.alive[i] = false;
 		}
 	}
 
+	// Advances the simulation by one fixed tick of 1 / kTicksPerSecond
+	// seconds. Nothing in here reads the clock, so the same inputs always
+	// play out the same way, however fast the ticks are run.
 	void Update()
 	{
-		time = GetTickCount();
+		++tick;
 
 		for(DWORD i = 0; i < numPlayers; i++)
 		{
-			DoArrowMove(&player[i], false);
+			DoArrowMove(i, false);
 		}
 
 		DoMonsters();
 	}
 
+	// FNV-1a over everything that decides how the game goes on, for
+	// checking replays (see Replay.h). Entities and the flow field are
+	// left out: they follow from the map and the players.
+	unsigned int StateHash() const
+	{
+		unsigned int hash = kReplayHashStart;
+		// Row by row, so builds with different MapLayouts agree
+		if(MapLayout::IsRowMajor)
+		{
+			hash = ReplayHash(hash, &map.Cell[0], map.NumCells);
+		}
+		else
+		{
+			for(Coord y = 0; y < map.Height; y++)
+			{
+				for(Coord x = 0; x < map.Width; x++)
+				{
+					hash = ReplayHash(hash, &map.Cell[map.Layout.Index(x, y)], 1);
+				}
+			}
+		}
+		hash = ReplayHash(hash, &level, sizeof(level));
+		hash = ReplayHash(hash, &numPlayers, sizeof(numPlayers));
+		hash = ReplayHash(hash, &tick, sizeof(tick));
+		hash = ReplayHash(hash, &random.state, sizeof(random.state));
+		hash = ReplayHash(hash, &random.inc, sizeof(random.inc));
+		for(DWORD i = 0; i < numPlayers; i++)
+		{
+			const Player* p = &player[i];
+			hash = ReplayHash(hash, &p->x, sizeof(p->x));
+			hash = ReplayHash(hash, &p->y, sizeof(p->y));
+			hash = ReplayHash(hash, &p->health, sizeof(p->health));
+			hash = ReplayHash(hash, &p->food, sizeof(p->food));
+			hash = ReplayHash(hash, &p->keys, sizeof(p->keys));
+			hash = ReplayHash(hash, &p->bombs, sizeof(p->bombs));
+			hash = ReplayHash(hash, &p->score, sizeof(p->score));
+			hash = ReplayHash(hash, &p->state, sizeof(p->state));
+			hash = ReplayHash(hash, &p->lastMoveTick, sizeof(p->lastMoveTick));
+			hash = ReplayHash(hash, &p->dir, sizeof(p->dir));
+			// A dead arrow's position is whatever it was last
+			hash = ReplayHash(hash, &arrows.alive[i], sizeof(arrows.alive[i]));
+			if(arrows.alive[i])
+			{
+				hash = ReplayHash(hash, &arrows.x[i], sizeof(arrows.x[i]));
+				hash = ReplayHash(hash, &arrows.y[i], sizeof(arrows.y[i]));
+				hash = ReplayHash(hash, &arrows.dir[i], sizeof(arrows.dir[i]));
+			}
+		}
+		return hash;
+	}
+
+	// Returns false if the map isn't level-sized
+	bool Snapshot(WorldSnapshot& s) const
+	{
+		if(map.Width != Map::LevelWidth || map.Height != Map::LevelHeight)
+		{
+			return false;
+		}
+		map.GetRows(s.cells);
+		s.level = level;
+		s.numPlayers = numPlayers;
+		s.tick = tick;
+		s.randomState = random.state;
+		s.randomInc = random.inc;
+		for(int i = 0; i < PlayerCount; i++)
+		{
+			const Player* p = &player[i];
+			s.playerScore[i] = p->score;
+			s.playerLastMoveTick[i] = p->lastMoveTick;
+			s.playerX[i] = (BYTE) p->x;
+			s.playerY[i] = (BYTE) p->y;
+			s.playerHealth[i] = p->health;
+			s.playerFood[i] = p->food;
+			s.playerKeys[i] = p->keys;
+			s.playerBombs[i] = p->bombs;
+			s.playerState[i] = (BYTE) p->state;
+			s.playerDir[i] = (BYTE) p->dir;
+			s.arrowAlive[i] = arrows.alive[i];
+			s.arrowX[i] = (BYTE) arrows.x[i];
+			s.arrowY[i] = (BYTE) arrows.y[i];
+			s.arrowDir[i] = (BYTE) arrows.dir[i];
+		}
+		return true;
+	}
+
+	// Cheap enough to do thousands of times a second: the map is copied
+	// in and reindexed, and the entities rebuilt from it.
+	void Restore(const WorldSnapshot& s)
+	{
+		if(map.Width != Map::LevelWidth || map.Height != Map::LevelHeight)
+		{
+			map.Resize(Map::LevelWidth, Map::LevelHeight);
+		}
+		map.SetRows(s.cells);
+		entities.Rebuild(map);
+		flow.Invalidate();
+		level = s.level;
+		numPlayers = s.numPlayers;
+		tick = s.tick;
+		random.state = s.randomState;
+		random.inc = s.randomInc;
+		for(int i = 0; i < PlayerCount; i++)
+		{
+			Player* p = &player[i];
+			p->score = s.playerScore[i];
+			p->lastMoveTick = s.playerLastMoveTick[i];
+			p->x = s.playerX[i];
+			p->y = s.playerY[i];
+			p->health = s.playerHealth[i];
+			p->food = s.playerFood[i];
+			p->keys = s.playerKeys[i];
+			p->bombs = s.playerBombs[i];
+			p->state = (PlayerState) s.playerState[i];
+			p->dir = (Direction) s.playerDir[i];
+			arrows.alive[i] = s.arrowAlive[i] != 0;
+			arrows.x[i] = s.arrowX[i];
+			arrows.y[i] = s.arrowY[i];
+			arrows.dir[i] = (Direction) s.arrowDir[i];
+		}
+	}
+
+	// A snapshot with its cells stored as a CellDelta against the level
+	// as it was loaded: typically a few hundred bytes. Returns false, and
+	// Snapshot has to be used instead, if the map isn't level-sized or the
+	// level isn't in gLevelCache (the built-in map when a level is missing).
+	bool SnapshotDelta(std::vector<BYTE>& out) const
+	{
+		WorldSnapshot s;
+		memset(&s, 0, sizeof(s)); // So the padding is always the same
+		const BYTE* pristine = gLevelCache.Cells(level);
+		if(!pristine || !Snapshot(s))
+		{
+			return false;
+		}
+		out.assign((const BYTE*) &s, (const BYTE*) &s + kDeltaFieldsSize);
+		CellDelta::Encode(pristine, s.cells, Map::LevelCells, out);
+		return true;
+	}
+
+	// Returns false, leaving the world as it was, if the delta is
+	// malformed, holds state no game could be in, or its level isn't in
+	// gLevelCache
+	bool RestoreDelta(const BYTE* data, size_t size)
+	{
+		if(size < kDeltaFieldsSize)
+		{
+			return false;
+		}
+		WorldSnapshot s;
+		memcpy(&s, data, kDeltaFieldsSize);
+		const BYTE* pristine = gLevelCache.Cells(s.level);
+		if(!pristine || !IsPossible(s))
+		{
+			return false;
+		}
+		memcpy(s.cells, pristine, Map::LevelCells);
+		if(!CellDelta::Decode(data + kDeltaFieldsSize, size - kDeltaFieldsSize, s.cells, Map::LevelCells))
+		{
+			return false;
+		}
+		Restore(s);
+		return true;
+	}
+
+	// Whether a game could have left these fields. A delta may come from
+	// anywhere, and Update goes straight to the map with the positions.
+	static bool IsPossible(const WorldSnapshot& s)
+	{
+		if(s.level >= LevelCache::kNumLevels || s.numPlayers < 1 || s.numPlayers > PlayerCount)
+		{
+			return false;
+		}
+		for(int i = 0; i < PlayerCount; i++)
+		{
+			if(s.playerX[i] >= Map::LevelWidth || s.playerY[i] >= Map::LevelHeight ||
+				s.playerState[i] > kInWarp || !IsDirection(s.playerDir[i]) ||
+				s.arrowAlive[i] > 1 || s.arrowX[i] >= Map::LevelWidth || s.arrowY[i] >= Map::LevelHeight ||
+				!IsDirection(s.arrowDir[i]) || s.arrowAlive[i] && s.arrowDir[i] == kDirNone)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	static bool IsDirection(BYTE d)
+	{
+		return d <= kDirUpLeft || d == kDirNone;
+	}
+
 	bool IsGameOver()
 	{
 		for(DWORD i = 0; i < numPlayers; i++)
@@ -381,103 +1714,163 @@ public:
 	{
 		float cogX;
 		float cogY;
-		DWORD startX;
-		DWORD endX;
-		DWORD startY;
-		DWORD endY;
+		Coord startX;
+		Coord endX;
+		Coord startY;
+		Coord endY;
 		GetCOG(cogX, cogY);
 		map.GetActive(cogX, cogY, startX, startY, endX, endY);
-
-		// update in a grid pattern
-		int gridStep = (time / (1000 / 60)) % 9;
-		int gridXOffset = gridStep % 3;
-		int gridYOffset = gridStep / 3;
-		for(DWORD y = startY + gridYOffset; y < endY; y += 3)
+		flow.Build(map, startX, startY, endX, endY, player, numPlayers);
+
+		// update in a grid pattern, visiting only the cells the bitplanes
+		// say hold a monster or generator. Anything that moves or spawns
+		// lands on another grid phase, so the scan never sees it twice.
+		int gridStep = tick % 9;
+		Coord gridXOffset = gridStep % 3;
+		Coord gridYOffset = gridStep / 3;
+		BitplaneScan scan(map.Monsters, map.Generators, startX, startY + gridYOffset, endX, endY, 3);
+		Coord x;
+		Coord y;
+		while(scan.Next(x, y))
 		{
-			for(DWORD x = startX + gridXOffset; x < endX; x += 3)
+			if((x - startX) % 3 != gridXOffset)
+			{
+				continue;
+			}
+			DWORD slot = entities.Find(map, x, y);
+			MapData d = (MapData) entities.kind[slot];
+			if(Entities::IsMonster(d))
 			{
-				MapData d = map.Get(x, y);
-				if(d >= kGhost && d <= kBig)
+				// Move towards nearest player
+				Direction dir = GetChaseDirection(x, y);
+				if(dir != kDirNone)
 				{
-					// Move towards nearest player
-					Direction dir = GetDirectionOfNearestPlayer(x, y);
-					if(dir != kDirNone)
+					Coord mx;
+					Coord my;
+					bool canMove = false;
+					MapData d2;
+					for(int test = 0; test < 3; test++)
 					{
-						BYTE mx;
-						BYTE my;
-						bool canMove = false;
-						MapData d2;
-						for(int test = 0; test < 3; test++)
+						const static int kTestDelta[3] = {0,-1,1};
+						mx = x;
+						my = y;
+						MoveCoords(mx, my, (dir + kTestDelta[test]) & 7);
+						d2 = map.Get(mx, my);
+						if(d2 == kSpace || d2 >= kPlayer0 && d2 <= kPlayer3)
 						{
-							const static int kTestDelta[3] = {0,-1,1};
-							mx = (BYTE) x;
-							my = (BYTE) y;
-							MoveCoords(mx, my, (dir + kTestDelta[test]) & 7);
-							d2 = map.Get(mx, my);
-							if(d2 == kSpace || d2 >= kPlayer0 && d2 <= kPlayer3)
-							{
-								canMove = true;
-								break;
-							}
+							canMove = true;
+							break;
 						}
-						if(canMove)
+					}
+					if(canMove)
+					{
+						if(d2 >= kPlayer0 && d2 <= kPlayer3)
 						{
-							map.Set(x, y, kSpace);
-							if(d2 >= kPlayer0 && d2 <= kPlayer3)
+							SetCell(x, y, kSpace);
+							Player* p = &player[d2 - kPlayer0];
+							int monsterHit = d - kGhost + 1;
+							if(p->health > monsterHit)
 							{
-								Player* p = &player[d2 - kPlayer0];
-								int monsterHit = d - kGhost + 1;
-								if(p->health > monsterHit)
-								{
-									p->health -= monsterHit;
-								}
-								else
-								{
-									p->health = 0;
-									MapData remains = kSpace;
-									if(p->keys)
-									{
-										--p->keys;
-										remains = kKey;
-									}
-									map.Set(p->x, p->y, remains);
-								}
+								p->health -= monsterHit;
 							}
 							else
 							{
-								map.Set(mx, my, d);
+								p->health = 0;
+								MapData remains = kSpace;
+								if(p->keys)
+								{
+									--p->keys;
+									remains = kKey;
+								}
+								SetCell(p->x, p->y, remains);
 							}
 						}
+						else
+						{
+							map.Set(x, y, kSpace);
+							map.Set(mx, my, d);
+							entities.Move(map, slot, mx, my);
+						}
 					}
 				}
-				else if(d >= kGen1 && d <= kGen3)
+			}
+			else
+			{
+				// Random generator
+				if(getRandom(10) < 3)
 				{
-					// Random generator
-					if(getRandom(10) < 3)
+					Coord gx = x;
+					Coord gy = y;
+					MoveCoords(gx, gy, getRandom(4) * 2);
+					if(map.Get(gx,gy) == kSpace)
 					{
-						BYTE gx = (BYTE) x;
-						BYTE gy = (BYTE) y;
-						MoveCoords(gx, gy, getRandom(4) * 2);
-						if(map.Get(gx,gy) == kSpace)
-						{
-							map.Set(gx, gy, (MapData) kGhost + (d - kGen1));
-						}
+						SetCell(gx, gy, (MapData) kGhost + (d - kGen1));
 					}
 				}
 			}
 		}
 	}
 
-	static DWORD getRandom(DWORD range)
+	// Map::Set, keeping entities and the flow field in step with the map
+	void SetCell(Coord x, Coord y, int v)
+	{
+		MapData old = map.Get(x, y);
+		if(FlowField::IsPassable(old) != FlowField::IsPassable((MapData) v)
+			|| old >= kPlayer0 || v >= kPlayer0)
+		{
+			flow.Invalidate();
+		}
+		DWORD slot = entities.Find(map, x, y);
+		if(slot != Entities::kNoSlot)
+		{
+			entities.Remove(map, slot);
+		}
+		map.Set(x, y, v);
+		if(Entities::IsEntity((MapData) v))
+		{
+			entities.Add(map, x, y, (MapData) v);
+		}
+	}
+
+	DWORD getRandom(DWORD range)
 	{
-		return rand() % range;
+		return random.Range(range);
+	}
+
+	// Downhill on the flow field, so monsters find their way round walls.
+	// Ties go to the direction nearest the straight line to the player, and
+	// cells the field doesn't reach just head straight for the player.
+	Direction GetChaseDirection(Coord x, Coord y)
+	{
+		Direction straight = GetDirectionOfNearestPlayer(x, y);
+		DWORD bestDistance = flow.Get(x, y);
+		if(straight == kDirNone || bestDistance == FlowField::kUnreached)
+		{
+			return straight;
+		}
+		Direction best = straight;
+		const static int kTurns[8] = {0,-1,1,-2,2,-3,3,4};
+		for(int i = 0; i < 8; i++)
+		{
+			Direction dir = (Direction) ((straight + kTurns[i]) & 7);
+			Coord nx = x;
+			Coord ny = y;
+			MoveCoords(nx, ny, dir);
+			DWORD distance = flow.Get(nx, ny);
+			if(distance < bestDistance)
+			{
+				bestDistance = distance;
+				best = dir;
+			}
+		}
+		return best;
 	}
 
-	Direction GetDirectionOfNearestPlayer(DWORD x, DWORD y)
+	Direction GetDirectionOfNearestPlayer(Coord x, Coord y)
 	{
-		DWORD bestX = 0;
-		DWORD bestY = 0;
-		DWORD bestDistance = 10000;
+		Coord bestX = 0;
+		Coord bestY = 0;
+		DWORD bestDistance = kNoDistance;
 		for(DWORD i = 0; i < numPlayers; i++)
 		{
 			Player *pP = &player[i];
@@ -492,7 +1885,7 @@ public:
 				}
 			}
 		}
-		if(bestDistance == 10000)
+		if(bestDistance == kNoDistance)
 		{
 			return kDirNone;
 		}
@@ -556,16 +1949,66 @@ public:
 
 	void LoadLevel(DWORD index)
 	{
-		if(map.LoadLevel(index))
+		Coord x;
+		Coord y;
+		const LevelInfo* info = NULL;
+		if(LoadPristine(index, x, y))
 		{
 			level = (BYTE) index;
+			info = GetLevelInfo(index);
 		}
 		else
 		{
 			level = 0;
-			map.LoadLevel(0);
+			if(LoadPristine(0, x, y))
+			{
+				info = GetLevelInfo(0);
+			}
+			else
+			{
+				// map.LoadLevel has put in the default map
+				FindStart(x, y);
+			}
+		}
+		if(info)
+		{
+			entities.Seed(map, *info);
+		}
+		else
+		{
+			entities.Rebuild(map);
+		}
+		flow.Invalidate();
+		SetPlayerPositions(x, y);
+		if(!gLevelCache.Has(level + 1))
+		{
+			gLevelPrefetcher.Request(level + 1);
 		}
-		SetPlayerPositions();
+	}
+
+	// The level as it is on disk, from the cache if we've seen it before.
+	bool LoadPristine(DWORD index, Coord& x, Coord& y)
+	{
+		if(gLevelCache.Load(index, map, x, y))
+		{
+			return true;
+		}
+		if(!gLevelPrefetcher.Take(index, map) && !map.LoadLevel(index))
+		{
+			return false;
+		}
+		const LevelInfo* info = GetLevelInfo(index);
+		if(info)
+		{
+			x = info->upX;
+			y = info->upY;
+		}
+		else
+		{
+			FindStart(x, y);
+		}
+		gLevelCache.Store(index, map, x, y);
+		return true;
 	}
 
 	void ChangeLevel(int delta)
@@ -574,39 +2017,41 @@ public:
 		LoadLevel(newLevel);
 	}
 
-	void SetPlayerPositions()
+	void FindStart(Coord& x, Coord& y)
 	{
-		BYTE x;
-		BYTE y;
 		if(!map.Find(x, y, kUp))
 		{
 			MyDebugBreak();
 			x = 4;
 			y = 4;
 		}
+	}
+
+	void SetPlayerPositions(Coord x, Coord y)
+	{
 		for(DWORD i = 0; i < numPlayers; i++)
 		{
 			Player* p = &player[i];
 			if(p->IsAlive())
 			{
-				BYTE px = x;
-				BYTE py = y;
+				Coord px = x;
+				Coord py = y;
 				MoveCoords(px, py, i * 2);
 				PlaceInWorld(i, px, py);
 			}
 		}
 	}
 
-	void PlaceInWorld(DWORD index, DWORD x, DWORD y)
+	void PlaceInWorld(DWORD index, Coord x, Coord y)
 	{
 		Player* p = &player[index];
 		MyAssert(p->IsAlive());
-		p->x = (BYTE) x;
-		p->y = (BYTE) y;
+		p->x = x;
+		p->y = y;
 		p->dir = (Direction) (index * 2);
-		map.Set(p->x, p->y, (MapData) (kPlayer0 + index));
+		SetCell(p->x, p->y, (MapData) (kPlayer0 + index));
 		p->state = kNormal;
-		p->arrow.alive = false;
+		arrows.alive[index] = false;
 	}
 
 	void Move(DWORD stick, Direction dir)
@@ -617,11 +2062,11 @@ public:
 			{
 				Player* p = &player[stick];
 				p->dir = dir;
-				if(p->IsVisible() && time - p->lastMoveTime >= kMsPerMove)
+				if(p->IsVisible() && tick - p->lastMoveTick >= kTicksPerMove)
 				{
-					p->lastMoveTime = time;
-					BYTE x = p->x;
-					BYTE y = p->y;
+					p->lastMoveTick = tick;
+					Coord x = p->x;
+					Coord y = p->y;
 					MoveCoords(x, y, dir);
 					MapData d = map.Get(x,y);
 					bool bMove = false;
@@ -635,6 +2080,7 @@ public:
 						{
 							--p->keys;
 							map.OpenLock(x, y);
+							flow.Invalidate();
 							bMove = true;
 						}
 						break;
@@ -657,7 +2103,7 @@ public:
 					case kDown:
 						{
 							p->state = kInWarp;
-							map.Set(p->x, p->y, kSpace);
+							SetCell(p->x, p->y, kSpace);
 							if(IsPartyInWarp())
 							{
 								ChangeLevel(1);
@@ -669,8 +2115,8 @@ public:
 					}
 					if(bMove)
 					{
-						map.Set(p->x, p->y, kSpace);
-						map.Set(x, y, kPlayer0 + stick);
+						SetCell(p->x, p->y, kSpace);
+						SetCell(x, y, kPlayer0 + stick);
 						p->x = x;
 						p->y = y;
 					}
@@ -725,13 +2171,13 @@ public:
 		if(index < numPlayers)
 		{
 			Player* p = &player[index];
-			if(!p->arrow.alive)
+			if(!arrows.alive[index])
 			{
-				p->arrow.alive = true;
-				p->arrow.x = p->x;
-				p->arrow.y = p->y;
-				p->arrow.dir = p->dir;
-				DoArrowMove(p, true);
+				arrows.alive[index] = true;
+				arrows.x[index] = p->x;
+				arrows.y[index] = p->y;
+				arrows.dir[index] = p->dir;
+				DoArrowMove(index, true);
 			}
 		}
 		else
@@ -740,27 +2186,27 @@ public:
 		}
 	}
 
-	void DoArrowMove(Player* p, bool isFirstMove)
+	void DoArrowMove(DWORD index, bool isFirstMove)
 	{
-		if(!p->arrow.alive)
+		if(!arrows.alive[index])
 		{
 			return;
 		}
-		BYTE x = p->arrow.x;
-		BYTE y = p->arrow.y;
+		Coord x = arrows.x[index];
+		Coord y = arrows.y[index];
 		if(!isFirstMove)
 		{
-			map.Set(x, y, kSpace);
+			SetCell(x, y, kSpace);
 		}
-		MoveCoords(x, y, p->arrow.dir);
+		MoveCoords(x, y, arrows.dir[index]);
 		MapData d = map.Get(x,y);
-		if(Arrow::CanHit(d))
+		if(Arrows::CanHit(d))
 		{
 			switch(d)
 			{
 			case kBomb:
 				DoSmartBomb();
-				map.Set(x, y, kSpace);
+				SetCell(x, y, kSpace);
 				break;
 			case kGhost:
 			case kSmiley:
@@ -768,7 +2214,7 @@ public:
 			case kGen1:
 			case kGen2:
 			case kGen3:
-				map.Set(x, y, kSpace);
+				SetCell(x, y, kSpace);
 				break;
 			case kHeart:
 				{
@@ -787,25 +2233,25 @@ public:
 					}
 					if(!foundPlayer)
 					{
-						map.Set(x, y, kBig);
+						SetCell(x, y, kBig);
 					}
 				}
 				break;
 			default:
 				MyDebugBreak();
 			}
-			p->arrow.alive = false;
+			arrows.alive[index] = false;
 		}
-		else if(Arrow::CanGo(d))
+		else if(Arrows::CanGo(d))
 		{
-			p->arrow.x = x;
-			p->arrow.y = y;
-			int rotatedDir = ((p->arrow.dir + 3) & 7); // Because font is screwed up
-			map.Set(x, y, kArrow0 + rotatedDir);
+			arrows.x[index] = x;
+			arrows.y[index] = y;
+			int rotatedDir = ((arrows.dir[index] + 3) & 7); // Because font is screwed up
+			SetCell(x, y, kArrow0 + rotatedDir);
 		}
 		else
 		{
-			p->arrow.alive = false;
+			arrows.alive[index] = false;
 		}
 	}
 
@@ -830,26 +2276,28 @@ public:
 	{
 		float cogX;
 		float cogY;
-		DWORD startX;
-		DWORD endX;
-		DWORD startY;
-		DWORD endY;
+		Coord startX;
+		Coord endX;
+		Coord startY;
+		Coord endY;
 		GetCOG(cogX, cogY);
 		map.GetActive(cogX, cogY, startX, startY, endX, endY);
-		for(DWORD y = startX; y < endY; y++)
+		if(map.Generators.AnyInRect(startX, startY, endX, endY))
 		{
-			for(DWORD x = startX; x < endX; x++)
-			{
-				MapData d = map.Get(x, y);
-				if(d >= kGhost && d <= kBig || d >= kGen1 && d <= kGen3)
-				{
-					map.Set(x, y, kSpace);
-				}
-			}
+			flow.Invalidate();
+		}
+		BitplaneScan scan(map.Monsters, map.Generators, startX, startY, endX, endY, 1);
+		Coord x;
+		Coord y;
+		while(scan.Next(x, y))
+		{
+			entities.Remove(map, entities.Find(map, x, y));
 		}
+		map.ClearInRect(map.Monsters, startX, startY, endX, endY);
+		map.ClearInRect(map.Generators, startX, startY, endX, endY);
 	}
 
-	static void MoveCoords(BYTE& x, BYTE& y, DWORD direction)
+	static void MoveCoords(Coord& x, Coord& y, DWORD direction)
 	{
 		if(direction < 8)
 		{
@@ -867,13 +2315,23 @@ public:
 		}
 	}
 	Map map;
+	Entities entities;
+	FlowField flow;
 	BYTE level;
 	const static int PlayerCount = 4;
 	Player player[PlayerCount];
+	Arrows arrows;
 	DWORD numPlayers;
-	DWORD time;
-
-	static const DWORD kMsPerMove = (1000 / 60) * 3;
+	DWORD tick;
+	// Init leaves it alone, so restarts carry on through the sequence
+	// rather than replaying it. Seed it directly for a repeatable game.
+	Random random;
+
+	static const DWORD kTicksPerSecond = 60;
+	static const DWORD kTicksPerMove = 3;
+	static const DWORD kNoDistance = 0xffffffff;
+	// A delta starts with the snapshot's fields as they are
+	static const size_t kDeltaFieldsSize = offsetof(WorldSnapshot, cells);
 };
 
 class GamePad
@@ -913,7 +2371,8 @@ public:
 
 };
 
-const DWORD kNumVerts = Map::NumCells * 6;
+// Enough for the cells GetActive can return, two triangles each
+const DWORD kNumVerts = (Map::ViewWidth + 1) * (Map::ViewHeight + 1) * 6;
 
 class View
 {
@@ -972,19 +2431,19 @@ public:
 
 		CUSTOMVERTEX* pTri = pV;
 
-		DWORD startX;
-		DWORD endX;
-		DWORD startY;
-		DWORD endY;
+		Coord startX;
+		Coord endX;
+		Coord startY;
+		Coord endY;
 		map.GetActive(cogX, cogY, startX, startY, endX, endY);
 
 		const float xBase = -cogX * 16.f - 0.5f;
 		const float yBase = -cogY * 16.f - 0.5f;
 
 		DWORD dwNumTris = 0;
-		for(DWORD x = startX; x < endX; x++)
+		for(Coord x = startX; x < endX; x++)
 		{
-			for(DWORD y = startY; y < endY; y ++)
+			for(Coord y = startY; y < endY; y ++)
 			{
 				BYTE b = map.Get(x, y);
 				float uLow = (b % uChars) * uScale;
@@ -1062,11 +2521,81 @@ public:
 	}
 };
 
+// Turns wall-clock time into whole simulation ticks, using the
+// performance counter rather than GetTickCount's 10-16ms steps. Time left
+// over from one call carries into the next, so the ticks come at
+// World::kTicksPerSecond on average however uneven the frames are.
+class SimClock
+{
+public:
+	SimClock()
+	{
+		frequency.QuadPart = 0;
+	}
+
+	// Ticks due since the last call. The first call just starts the clock.
+	DWORD Advance()
+	{
+		LARGE_INTEGER now;
+		QueryPerformanceCounter(&now);
+		if(frequency.QuadPart == 0)
+		{
+			QueryPerformanceFrequency(&frequency);
+			last = now;
+			owed = 0;
+			return 0;
+		}
+		owed += (now.QuadPart - last.QuadPart) * World::kTicksPerSecond;
+		last = now;
+		LONGLONG ticks = owed / frequency.QuadPart;
+		owed -= ticks * frequency.QuadPart;
+		// After a long stall (a breakpoint, dragging the window) drop the
+		// backlog rather than fast-forwarding through it.
+		if(ticks > (LONGLONG) kMaxCatchUp)
+		{
+			ticks = (LONGLONG) kMaxCatchUp;
+		}
+		return (DWORD) ticks;
+	}
+
+	static const DWORD kMaxCatchUp = 5;
+
+private:
+	LARGE_INTEGER frequency;
+	LARGE_INTEGER last;
+	LONGLONG owed;	// In units of 1 / (frequency * kTicksPerSecond) seconds
+};
+
+enum ReplayStatus
+{
+	kReplayOk,
+	kReplayBadFormat,	// Not a replay, cut short, or for another setup
+	kReplayDesync		// A state hash didn't match
+};
+
+struct ReplayResult
+{
+	ReplayResult()
+	{
+		ticks = 0;
+		hashesChecked = 0;
+		desyncTick = 0;
+		buildMatches = false;
+	}
+
+	DWORD ticks;			// Ticks played
+	DWORD hashesChecked;
+	DWORD desyncTick;		// kReplayDesync: the tick whose hash differed
+	bool buildMatches;		// Recorded by this Dandy.exe
+};
+
 class Game
 {
 public:
 	Game()
 	{
+		recording = false;
+		gameOvers = 0;
 		Init();
 	}
 
@@ -1090,7 +2619,8 @@ public:
 		keyboard.HandleEvent(down, key);
 	}
 
-	void TranslateKeysToPads()
+	// The buttons the keyboard has down on each pad
+	void ReadKeys(BYTE buttons[World::PlayerCount])
 	{
 		struct PadMapEntry {
 			UCHAR vkcode;
@@ -1120,37 +2650,180 @@ public:
 			{0, 0, 0}
 		};
 
-		// Reset all pads
 		for(int i = 0; i < World::PlayerCount; i++)
 		{
-			gamepad[i].strobe = gamepad[i].buttons; // Remember old state
-			gamepad[i].buttons = 0;
+			buttons[i] = 0;
 		}
 		for(PadMapEntry* pE = map; pE->vkcode != 0; pE++)
 		{
 			if(keyboard.data[pE->vkcode])
 			{
-				gamepad[pE->pad].buttons |= pE->mask;
+				buttons[pE->pad] |= pE->mask;
 			}
 		}
-		// calculate strobe
+	}
+
+	// Sets the pads for this tick; strobe is whatever is newly down
+	void LatchPads(const BYTE buttons[World::PlayerCount])
+	{
+		for(int i = 0; i < World::PlayerCount; i++)
+		{
+			gamepad[i].strobe = buttons[i] & ~ gamepad[i].buttons;
+			gamepad[i].buttons = buttons[i];
+		}
+	}
+
+	void ResetPads()
+	{
 		for(int i = 0; i < World::PlayerCount; i++)
 		{
-			gamepad[i].strobe = gamepad[i].buttons & ~ gamepad[i].strobe;
+			gamepad[i] = GamePad();
 		}
 	}
 
+	// Runs whatever ticks are due by the clock. Rendering happens once per
+	// Step whether or not any were.
 	void Step()
+	{
+		for(DWORD ticks = clock.Advance(); ticks > 0; ticks--)
+		{
+			Tick();
+		}
+	}
+
+	// One fixed step of the game, with the keyboard's buttons. Call it
+	// directly to run without the clock, e.g. headless and faster than
+	// real time.
+	void Tick()
+	{
+		BYTE buttons[World::PlayerCount];
+		ReadKeys(buttons);
+		RunTick(buttons);
+		if(recording)
+		{
+			recorder.Tick(buttons);
+			if(recorder.HashDue())
+			{
+				recorder.Hash(world.StateHash());
+			}
+		}
+	}
+
+	// One fixed step of the game with the given buttons on the pads
+	void RunTick(const BYTE buttons[World::PlayerCount])
 	{
 		world.Update();
-		TranslateKeysToPads();
+		LatchPads(buttons);
 		MovePlayers();
 		if(world.IsGameOver())
 		{
+			gameOvers++;
 			Start();
 		}
 	}
 
+	// Starts a new game and records it, from its first tick, until
+	// SaveRecording. seed picks the game.
+	void StartRecording(RandomWord seed)
+	{
+		world.random.Seed(seed, Random::kDefaultStream);
+		Start();
+		ResetPads();
+		ReplayHeader header;
+		header.level = world.level;
+		header.players = (unsigned char) world.numPlayers;
+		header.seed = seed;
+		header.stream = Random::kDefaultStream;
+		header.buildHash = BuildHash();
+		header.hashInterval = Replay::kHashInterval;
+		recorder.Begin(header);
+		recording = true;
+	}
+
+	bool SaveRecording(const char* path)
+	{
+		const std::vector<BYTE>& data = recorder.End();
+		FILE* file = fopen(path, "wb");
+		if(!file)
+		{
+			return false;
+		}
+		bool ok = fwrite(&data[0], 1, data.size(), file) == data.size();
+		return fclose(file) == 0 && ok;
+	}
+
+	// Plays a replay from its start as fast as it goes, drawing nothing,
+	// and checks each of its state hashes against the world's. Stops at
+	// the first that doesn't match.
+	ReplayStatus PlayReplay(const BYTE* data, size_t size, ReplayResult& result)
+	{
+		result = ReplayResult();
+		recording = false;
+		ReplayReader reader;
+		if(!reader.Open(data, size))
+		{
+			return kReplayBadFormat;
+		}
+		const ReplayHeader& header = reader.Header();
+		result.buildMatches = header.buildHash == BuildHash();
+		world.random.Seed(header.seed, header.stream);
+		Init();
+		if(header.players != world.numPlayers)
+		{
+			return kReplayBadFormat;
+		}
+		world.LoadLevel(header.level);
+		ResetPads();
+		for(;;)
+		{
+			BYTE buttons[World::PlayerCount];
+			unsigned int hash;
+			switch(reader.Next(buttons, hash))
+			{
+			case ReplayReader::kTick:
+				RunTick(buttons);
+				result.ticks++;
+				break;
+			case ReplayReader::kHashCheck:
+				result.hashesChecked++;
+				if(hash != world.StateHash())
+				{
+					result.desyncTick = result.ticks;
+					return kReplayDesync;
+				}
+				break;
+			case ReplayReader::kEnd:
+				return kReplayOk;
+			default:
+				return kReplayBadFormat;
+			}
+		}
+	}
+
+	// Replays note the build that recorded them by what decides how a
+	// game goes: the replay format, the layout of the world's state and
+	// the levels, compiled in or by their checksums as loaded. Rebuilding
+	// the same source gives the same hash, as the GameBoy's
+	// replay_build_hash does.
+	static unsigned int BuildHash()
+	{
+		unsigned int hash = kReplayHashStart;
+		const BYTE version = Replay::kVersion;
+		hash = ReplayHash(hash, &version, sizeof(version));
+		const DWORD layout[2] = { sizeof(WorldSnapshot), Map::LevelCells };
+		hash = ReplayHash(hash, layout, sizeof(layout));
+#ifdef DANDY_EMBEDDED_LEVELS
+		hash = ReplayHash(hash, kEmbeddedLevels, sizeof(kEmbeddedLevels));
+#else
+		for(DWORD i = 0; i < LevelCache::kNumLevels; i++)
+		{
+			const DWORD checksum = Map::LevelChecksum(i);
+			hash = ReplayHash(hash, &checksum, sizeof(checksum));
+		}
+#endif
+		return hash;
+	}
+
 	void MovePlayers()
 	{
 		for(DWORD i = 0; i < world.numPlayers; i++)
@@ -1211,9 +2884,175 @@ public:
 	GamePad gamepad[World::PlayerCount];
 	Keyboard keyboard;
 	View view;
+	SimClock clock;
+	ReplayWriter recorder;
+	bool recording;
+	DWORD gameOvers;	// Games restarted because every player died
 };
 
 Game gGame;
+char gRecordPath[MAX_PATH];	// -record's file, empty if not recording
+
+// One headless game of a batch
+struct BatchJob
+{
+	RandomWord seed;	// Seeds the world's Random, on Random::kDefaultStream
+	DWORD level;		// Where the game starts
+	DWORD ticks;
+	DWORD inputSeed;	// BatchRunner::RandomButtons from this, or no buttons if 0
+};
+
+struct BatchResult
+{
+	DWORD ticks;
+	DWORD finalLevel;
+	DWORD maxLevel;		// Furthest level reached
+	DWORD gameOvers;
+	DWORD score[World::PlayerCount];
+	unsigned int stateHash;	// World::StateHash at the end
+};
+
+// Plays many headless games at once, one World per game, on a pool of
+// threads that each take the next job until there are none left. Games
+// are stepped by Game::RunTick, as the window and -play step them, so a
+// job plays out the same whichever thread runs it, and the same as it
+// would anywhere else.
+//
+// The games share only gLevelPack and gLevelCache. Run fills the cache and
+// freezes it before starting any threads, so from then on both are only
+// read. The prefetcher isn't used: its one slot is for one game, and with
+// every level cached it has nothing to do.
+class BatchRunner
+{
+public:
+	// Runs every job, writing results[i] for jobs[i]. The calling thread is
+	// one of the workers, so every job is run even if no thread starts.
+	void Run(const BatchJob* jobList, BatchResult* resultList, DWORD count, DWORD numThreads)
+	{
+		jobs = jobList;
+		results = resultList;
+		numJobs = count;
+		next = 0;
+		Game* game = new Game;
+		FillLevelCache(game->world);
+		std::vector<HANDLE> threads;
+		for(DWORD i = 1; i < numThreads; i++)
+		{
+			unsigned threadId;
+			HANDLE thread = (HANDLE) _beginthreadex(NULL, 0, ThreadProc, this, 0, &threadId);
+			if(thread)
+			{
+				threads.push_back(thread);
+			}
+		}
+		Work(*game);
+		delete game;
+		for(size_t i = 0; i < threads.size(); i++)
+		{
+			WaitForSingleObject(threads[i], INFINITE);
+			CloseHandle(threads[i]);
+		}
+	}
+
+	// Plays one job on game, which is started afresh for it
+	static void RunJob(Game& game, const BatchJob& job, BatchResult& result)
+	{
+		World& world = game.world;
+		world.random.Seed(job.seed, Random::kDefaultStream);
+		game.Init();
+		world.LoadLevel(job.level);
+		game.ResetPads();
+		game.gameOvers = 0;
+		result.maxLevel = world.level;
+
+		BYTE buttons[World::PlayerCount] = { 0 };
+		DWORD input = job.inputSeed;
+		for(DWORD tick = 0; tick < job.ticks; tick++)
+		{
+			if(input)
+			{
+				RandomButtons(input, buttons);
+			}
+			game.RunTick(buttons);
+			result.maxLevel = max(result.maxLevel, (DWORD) world.level);
+		}
+
+		result.ticks = job.ticks;
+		result.finalLevel = world.level;
+		result.gameOvers = game.gameOvers;
+		for(int i = 0; i < World::PlayerCount; i++)
+		{
+			result.score[i] = world.player[i].score;
+		}
+		result.stateHash = world.StateHash();
+	}
+
+	// Each tick every pad has a 1 in 16 chance of switching to a new
+	// combination of buttons, which it then holds. state is an xorshift32
+	// word, and must not be 0.
+	static void RandomButtons(DWORD& state, BYTE buttons[World::PlayerCount])
+	{
+		static const BYTE kCombos[16] =
+		{
+			0,
+			GamePad::kLeft, GamePad::kRight, GamePad::kUp, GamePad::kDown,
+			GamePad::kLeft | GamePad::kUp, GamePad::kRight | GamePad::kUp,
+			GamePad::kLeft | GamePad::kDown, GamePad::kRight | GamePad::kDown,
+			GamePad::kA, GamePad::kLeft | GamePad::kA, GamePad::kRight | GamePad::kA,
+			GamePad::kUp | GamePad::kA, GamePad::kDown | GamePad::kA,
+			GamePad::kB, GamePad::kC
+		};
+		for(int i = 0; i < World::PlayerCount; i++)
+		{
+			DWORD x = state;
+			x ^= x << 13;
+			x ^= x >> 17;
+			x ^= x << 5;
+			state = x;
+			if((x & 15) == 0)
+			{
+				buttons[i] = kCombos[(x >> 4) & 15];
+			}
+		}
+	}
+
+private:
+	// Loads every level once, on the calling thread, and freezes the cache
+	static void FillLevelCache(World& world)
+	{
+		for(DWORD i = 0; i < LevelCache::kNumLevels; i++)
+		{
+			world.LoadLevel(i);
+		}
+		gLevelCache.Freeze();
+	}
+
+	static unsigned __stdcall ThreadProc(void* context)
+	{
+		Game* game = new Game;
+		((BatchRunner*) context)->Work(*game);
+		delete game;
+		return 0;
+	}
+
+	void Work(Game& game)
+	{
+		for(;;)
+		{
+			LONG job = InterlockedIncrement(&next) - 1;
+			if((DWORD) job >= numJobs)
+			{
+				break;
+			}
+			RunJob(game, jobs[job], results[job]);
+		}
+	}
+
+	const BatchJob* jobs;
+	BatchResult* results;
+	DWORD numJobs;
+	volatile LONG next;
+};
 
 
 
@@ -1303,6 +3142,12 @@ VOID Cleanup()
 
     if( g_pD3D != NULL )
         g_pD3D->Release();
+
+    if( gGame.recording && !gGame.SaveRecording( gRecordPath ) )
+        MessageBox(NULL, gRecordPath, "Could not save the replay", MB_OK);
+
+    gLevelPrefetcher.Stop();
+    gLevelPack.Close();
 }
 
 
@@ -1355,12 +3200,215 @@ LRESULT WINAPI MsgProc( HWND hWnd, UINT msg, WPARAM wParam, LPARAM lParam )
 }
 
 
+//-----------------------------------------------------------------------------
+// Name: CommandLineFile()
+// Desc: Copies the file named after flag on the command line (quoted or
+//       not) into path. Returns false if flag isn't there.
+//-----------------------------------------------------------------------------
+bool CommandLineFile( const char* cmdLine, const char* flag, char* path, size_t size )
+{
+    const char* p = strstr( cmdLine, flag );
+    if( p == NULL || size == 0 )
+        return false;
+    p += strlen( flag );
+    while( *p == ' ' )
+        p++;
+    char end = ' ';
+    if( *p == '"' )
+    {
+        end = '"';
+        p++;
+    }
+    size_t n = 0;
+    while( p[n] != 0 && p[n] != end && n + 1 < size )
+    {
+        path[n] = p[n];
+        n++;
+    }
+    path[n] = 0;
+    return n > 0;
+}
+
+
+//-----------------------------------------------------------------------------
+// Name: PlayReplayFile()
+// Desc: Plays a replay as fast as it goes with no window, and reports
+//       whether it matched
+//-----------------------------------------------------------------------------
+INT PlayReplayFile( const char* path )
+{
+    std::vector<BYTE> data;
+    FILE* file = fopen( path, "rb" );
+    if( file != NULL )
+    {
+        BYTE buffer[4096];
+        size_t n;
+        while( ( n = fread( buffer, 1, sizeof(buffer), file ) ) > 0 )
+            data.insert( data.end(), buffer, buffer + n );
+        fclose( file );
+    }
+    if( data.empty() )
+    {
+        MessageBox(NULL, path, "Could not read the replay", MB_OK);
+        return 1;
+    }
+
+#ifndef DANDY_EMBEDDED_LEVELS
+    gLevelPack.Open();
+    gLevelPrefetcher.Start();
+#endif
+    LARGE_INTEGER frequency, start, end;
+    QueryPerformanceFrequency( &frequency );
+    QueryPerformanceCounter( &start );
+    ReplayResult result;
+    ReplayStatus status = gGame.PlayReplay( &data[0], data.size(), result );
+    QueryPerformanceCounter( &end );
+    gLevelPrefetcher.Stop();
+    gLevelPack.Close();
+
+    double seconds = (double) (end.QuadPart - start.QuadPart) / frequency.QuadPart;
+    char message[256];
+    if( status == kReplayOk )
+        sprintf( message, "Matched: %lu ticks, %lu hashes, %.0f ticks/s%s", result.ticks,
+                 result.hashesChecked, seconds > 0 ? result.ticks / seconds : 0.0,
+                 result.buildMatches ? "" : "\n(recorded by another build)" );
+    else if( status == kReplayDesync )
+        sprintf( message, "Desync at tick %lu, after %lu matching hashes%s", result.desyncTick,
+                 result.hashesChecked - 1, result.buildMatches ? "" : "\n(recorded by another build)" );
+    else
+        sprintf( message, "Not a replay, or cut short" );
+    MessageBox(NULL, message, path, MB_OK);
+    return status == kReplayOk ? 0 : 1;
+}
+
+
+//-----------------------------------------------------------------------------
+// Name: RunBatchFile()
+// Desc: Plays a file of headless games on every core (see BatchRunner) and
+//       writes one line per game to resultsPath. Each line of the file is
+//       one job, '#' starting a comment:
+//
+//           seed level ticks input
+//
+//       where input is "idle" or "random:<seed>". Results are in job order
+//       and don't depend on numThreads, so two runs can be compared.
+//-----------------------------------------------------------------------------
+INT RunBatchFile( const char* path, const char* resultsPath, DWORD numThreads )
+{
+    std::vector<BatchJob> jobs;
+    FILE* file = fopen( path, "r" );
+    if( file == NULL )
+    {
+        MessageBox(NULL, path, "Could not read the batch", MB_OK);
+        return 1;
+    }
+    char line[256];
+    while( fgets( line, sizeof(line), file ) != NULL )
+    {
+        char* comment = strchr( line, '#' );
+        if( comment != NULL )
+            *comment = 0;
+        unsigned long seed, level, ticks, inputSeed = 0;
+        char input[32];
+        int fields = sscanf( line, "%lu %lu %lu %31s", &seed, &level, &ticks, input );
+        if( fields <= 0 )
+            continue;
+        if( fields != 4 || level >= LevelCache::kNumLevels ||
+            ( strcmp( input, "idle" ) != 0 && sscanf( input, "random:%lu", &inputSeed ) != 1 ) )
+        {
+            fclose( file );
+            MessageBox(NULL, line, "Expected 'seed level ticks input'", MB_OK);
+            return 1;
+        }
+        BatchJob job;
+        job.seed = seed;
+        job.level = level;
+        job.ticks = ticks;
+        job.inputSeed = inputSeed;
+        jobs.push_back( job );
+    }
+    fclose( file );
+    if( jobs.empty() )
+    {
+        MessageBox(NULL, path, "The batch has no games", MB_OK);
+        return 1;
+    }
+
+    if( numThreads == 0 )
+    {
+        SYSTEM_INFO info;
+        GetSystemInfo( &info );
+        numThreads = max( info.dwNumberOfProcessors, (DWORD) 1 );
+    }
+#ifndef DANDY_EMBEDDED_LEVELS
+    gLevelPack.Open();
+#endif
+    std::vector<BatchResult> results( jobs.size() );
+    LARGE_INTEGER frequency, start, end;
+    QueryPerformanceFrequency( &frequency );
+    QueryPerformanceCounter( &start );
+    BatchRunner runner;
+    runner.Run( &jobs[0], &results[0], jobs.size(), numThreads );
+    QueryPerformanceCounter( &end );
+    gLevelPack.Close();
+
+    FILE* out = fopen( resultsPath, "w" );
+    if( out == NULL )
+    {
+        MessageBox(NULL, resultsPath, "Could not write the results", MB_OK);
+        return 1;
+    }
+    fprintf( out, "# job seed level ticks final max game_overs scores hash\n" );
+    double ticks = 0;
+    for( size_t i = 0; i < jobs.size(); i++ )
+    {
+        const BatchResult& r = results[i];
+        fprintf( out, "%lu %lu %lu %lu %lu %lu %lu %lu,%lu %08x\n", (DWORD) i, (DWORD) jobs[i].seed,
+                 jobs[i].level, r.ticks, r.finalLevel, r.maxLevel, r.gameOvers,
+                 r.score[0], r.score[1], r.stateHash );
+        ticks += r.ticks;
+    }
+    bool written = fclose( out ) == 0;
+
+    double seconds = (double) (end.QuadPart - start.QuadPart) / frequency.QuadPart;
+    if( seconds <= 0 )
+        seconds = 1e-9;
+    char message[256];
+    sprintf( message, "%lu games, %.0f ticks on %lu threads in %.3f s: %.1f games/s, %.0f ticks/s",
+             (DWORD) jobs.size(), ticks, numThreads, seconds, jobs.size() / seconds, ticks / seconds );
+    MessageBox(NULL, message, resultsPath, MB_OK);
+    return written ? 0 : 1;
+}
+
+
 //-----------------------------------------------------------------------------
 // Name: WinMain()
 // Desc: The application's entry point
 //-----------------------------------------------------------------------------
-INT WINAPI WinMain( HINSTANCE hInst, HINSTANCE, LPSTR, INT )
+INT WINAPI WinMain( HINSTANCE hInst, HINSTANCE, LPSTR lpCmdLine, INT )
 {
+    // -play <file> checks a replay without opening a window
+    char replayPath[MAX_PATH];
+    if( CommandLineFile( lpCmdLine, "-play", replayPath, sizeof(replayPath) ) )
+        return PlayReplayFile( replayPath );
+
+    // -batch <file> plays a file of headless games, writing their results
+    // to -results <file> (<file>.out by default), on -threads <n> threads
+    // (one per CPU by default)
+    char batchPath[MAX_PATH];
+    if( CommandLineFile( lpCmdLine, "-batch", batchPath, sizeof(batchPath) ) )
+    {
+        char resultsPath[MAX_PATH];
+        if( !CommandLineFile( lpCmdLine, "-results", resultsPath, sizeof(resultsPath) ) )
+            _snprintf( resultsPath, sizeof(resultsPath), "%s.out", batchPath );
+        resultsPath[sizeof(resultsPath) - 1] = 0;
+        char threads[16];
+        DWORD numThreads = 0;
+        if( CommandLineFile( lpCmdLine, "-threads", threads, sizeof(threads) ) )
+            numThreads = (DWORD) atoi( threads );
+        return RunBatchFile( batchPath, resultsPath, numThreads );
+    }
+
     // Register the window class
     WNDCLASSEX wc = { sizeof(WNDCLASSEX), CS_CLASSDC, MsgProc, 0L, 0L,
                       GetModuleHandle(NULL), NULL, NULL, NULL, NULL,
@@ -1375,7 +3423,21 @@ INT WINAPI WinMain( HINSTANCE hInst, HINSTANCE, LPSTR, INT )
     // Initialize Direct3D
     if( SUCCEEDED( InitD3D( hWnd ) ) )
     {
-		gGame.Start();
+#ifndef DANDY_EMBEDDED_LEVELS
+		gLevelPack.Open();
+		gLevelPrefetcher.Start();
+#endif
+		// -record <file> saves the game to file on exit
+		if(CommandLineFile(lpCmdLine, "-record", gRecordPath, sizeof(gRecordPath)))
+		{
+			LARGE_INTEGER now;
+			QueryPerformanceCounter(&now);
+			gGame.StartRecording(now.QuadPart);
+		}
+		else
+		{
+			gGame.Start();
+		}
         // Create the scene geometry
         if( SUCCEEDED( InitGeometry() ) )
         {
@@ -0,0 +1,1186 @@
+// EmbeddedLevels.h
+//
+// Generated by tools/make_level_header.py from levels/level.a..z.
+// Do not edit; change the level files and run the script again.
+
+#ifndef EMBEDDED_LEVELS_H
+#define EMBEDDED_LEVELS_H
+
+const static DWORD kEmbeddedLevelCount = 26;
+
+static const BYTE kEmbeddedLevels[26][1800] =
+{
+	// level.a
+	{
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		1,0,0,0,0,0,0,0,0,0,0,0,0,0,9,0,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,9,9,9,9,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,9,9,9,1,
+		1,0,10,0,0,0,0,0,0,0,0,0,0,9,0,9,0,0,0,0,0,0,0,0,0,0,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,0,1,
+		1,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,0,7,0,0,0,0,7,0,0,0,1,0,0,0,0,0,1,0,1,
+		1,0,0,1,7,1,7,1,7,1,7,1,7,1,7,1,7,1,7,1,1,1,1,1,1,0,9,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,1,0,0,13,0,0,1,0,1,
+		1,0,0,1,0,0,10,0,10,0,10,0,10,0,10,0,10,0,10,7,7,0,0,0,1,1,9,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,1,0,0,0,0,0,1,0,1,
+		1,0,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,1,0,0,0,0,1,9,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,1,0,0,0,0,0,1,0,1,
+		1,0,0,1,0,0,10,0,10,0,10,0,10,0,10,0,10,0,10,7,1,0,4,0,0,1,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,1,0,0,1,1,1,0,1,1,1,0,1,
+		1,0,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,1,0,0,0,0,1,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,0,1,0,0,0,1,
+		1,0,0,1,0,0,10,0,10,0,10,0,10,0,10,0,10,0,10,7,1,0,0,0,1,1,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,0,1,0,0,0,1,
+		1,0,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,1,0,9,0,9,1,0,1,0,0,0,1,
+		1,0,0,2,0,0,10,0,10,0,10,0,10,0,10,0,10,0,10,7,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,1,9,0,9,0,1,0,1,0,0,0,1,
+		1,0,0,2,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,1,0,0,1,0,0,0,0,0,1,7,7,1,1,1,7,7,1,1,0,0,0,0,1,1,1,0,0,1,1,1,1,1,1,1,1,2,0,2,1,
+		1,0,0,2,0,0,10,0,10,0,10,0,10,0,10,0,10,0,10,7,1,0,0,1,0,1,0,1,0,1,0,0,1,1,1,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,9,0,0,1,0,1,0,0,0,1,
+		1,8,0,2,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,1,0,0,1,9,1,0,1,9,1,0,0,1,1,1,0,0,1,1,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,1,0,0,0,1,
+		1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,1,0,1,0,1,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,10,0,1,0,1,0,1,0,1,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,1,
+		1,0,0,0,0,0,0,0,0,0,0,0,0,11,0,0,0,1,0,0,0,0,0,1,0,1,0,1,0,1,0,0,0,3,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,1,0,0,0,1,
+		1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,1,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,1,1,1,1,1,1,1,1,1,1,0,0,1,0,0,1,0,0,0,1,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,1,1,1,0,0,0,1,
+		1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,1,9,0,0,0,7,0,0,0,0,1,
+		1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,1,9,0,0,7,7,7,7,0,0,1,
+		1,0,6,6,0,0,1,0,0,1,1,1,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,7,0,7,0,0,0,0,1,
+		1,0,6,0,0,1,0,1,0,0,1,0,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,7,7,7,0,0,0,1,
+		1,0,6,6,0,1,1,1,0,0,1,0,0,0,1,1,1,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,0,0,0,0,0,1,1,0,0,0,7,0,7,0,0,1,
+		1,0,6,0,0,1,0,1,0,0,1,0,0,1,1,1,0,0,0,0,1,0,0,0,0,1,0,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,1,0,0,0,0,0,1,1,0,7,7,7,7,0,0,0,1,
+		1,0,6,6,0,1,0,1,0,0,1,0,1,1,1,0,0,0,1,1,1,0,0,0,0,1,0,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,1,0,0,0,0,0,1,1,0,0,0,7,0,0,0,0,1,
+		1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,1,0,11,0,0,0,1,1,0,0,0,0,12,0,0,0,1,
+		1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,9,0,0,0,9,1,1,1,1,10,10,10,10,1,1,1,1,1,11,0,0,0,0,1,1,0,0,1,1,1,0,0,0,1,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+	},
+	// level.b
+	{
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,9,0,0,9,0,0,0,0,0,0,0,0,0,0,0,9,0,0,1,9,0,0,0,0,0,0,0,0,1,0,0,0,1,
+		1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,1,1,1,1,1,1,1,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,1,0,3,0,1,
+		1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,1,
+		1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,1,1,1,0,1,1,1,1,0,1,1,1,1,0,0,1,0,1,0,1,1,0,1,1,
+		1,0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,1,0,9,0,0,1,0,1,0,0,9,0,9,1,0,0,0,0,1,0,1,1,
+		1,0,0,0,0,1,9,9,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,1,1,0,0,1,1,1,0,1,0,1,1,1,1,0,1,1,1,1,0,1,1,0,1,1,0,1,0,1,1,
+		1,0,0,0,0,1,0,9,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,1,0,1,0,1,1,
+		1,0,0,0,0,1,0,0,1,1,1,1,1,1,1,1,1,1,1,1,0,0,1,1,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,1,0,1,0,1,0,1,1,1,1,1,1,1,1,0,1,0,1,1,
+		1,0,0,0,0,1,0,0,1,0,0,0,10,0,10,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,1,1,1,0,0,0,1,1,1,9,1,9,1,0,0,0,0,0,0,0,0,0,0,1,0,1,1,
+		1,0,0,0,0,1,0,0,1,0,0,0,0,10,0,10,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,1,0,1,1,
+		1,0,0,0,0,1,0,0,1,0,0,1,1,1,1,1,1,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,0,1,
+		1,0,0,0,0,1,0,0,1,0,0,1,7,7,7,0,1,1,0,0,0,0,1,1,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,1,0,1,
+		1,0,0,0,0,1,0,0,1,0,0,1,6,6,0,4,0,1,1,0,0,0,0,1,0,1,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,0,0,2,0,0,1,0,1,
+		1,0,0,0,0,1,0,0,1,0,0,1,7,7,7,0,7,1,1,0,0,0,0,1,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,2,0,0,1,0,1,
+		1,0,0,0,0,1,0,0,1,0,0,1,11,11,11,7,1,1,0,0,0,1,1,1,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,1,1,0,0,0,0,0,0,0,9,1,0,2,0,0,1,0,1,
+		1,0,0,0,0,1,0,0,1,0,0,1,11,11,11,1,1,0,0,0,1,1,1,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,1,0,9,0,0,0,0,0,0,0,0,1,1,0,2,0,0,1,0,1,
+		1,0,0,0,0,1,0,0,1,0,0,0,11,11,1,1,0,0,0,1,1,1,0,0,0,0,0,0,0,0,1,1,0,0,0,1,1,0,0,0,1,0,0,0,0,0,0,0,0,9,0,0,0,0,2,0,0,1,0,1,
+		1,0,0,0,0,1,0,0,1,0,0,0,0,1,1,0,0,0,0,1,1,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,1,0,0,0,0,0,1,1,1,0,0,0,0,0,0,0,0,0,2,0,0,1,0,1,
+		1,0,0,0,0,1,0,0,1,0,0,0,1,1,0,0,0,0,1,1,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,0,0,0,0,0,1,0,0,0,0,0,0,1,1,1,1,0,2,0,0,1,0,1,
+		1,0,0,0,0,1,0,0,1,0,0,1,1,0,0,0,0,1,1,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,1,0,0,7,0,0,1,0,0,0,9,0,0,0,0,0,1,0,2,0,0,1,0,1,
+		1,0,0,0,0,1,0,0,1,1,1,1,0,0,0,0,1,1,0,0,0,0,0,0,0,0,1,1,0,0,10,0,10,0,0,0,1,0,0,0,0,0,1,0,0,0,0,0,0,0,0,9,1,0,2,0,0,1,0,1,
+		1,0,0,0,0,1,0,0,0,0,0,0,0,0,1,1,1,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,1,0,0,0,0,7,1,0,9,0,1,1,1,0,0,0,1,0,2,0,0,1,0,1,
+		1,0,0,0,0,1,9,9,9,9,9,9,9,9,1,1,0,0,0,0,0,0,0,0,1,1,0,0,0,10,0,10,0,10,0,0,1,0,0,0,0,0,1,0,0,0,0,0,1,0,0,0,1,0,2,0,0,1,0,1,
+		1,0,0,0,0,1,1,1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,1,0,0,7,0,0,1,0,0,0,9,0,1,0,0,0,0,0,2,0,0,1,6,1,
+		1,0,12,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,10,0,10,0,0,0,1,0,0,0,0,0,1,1,1,0,0,0,1,0,0,0,0,0,2,0,0,1,6,1,
+		1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,7,7,7,7,0,0,0,0,0,1,0,0,7,0,0,9,0,0,0,0,0,1,0,0,0,0,0,2,0,0,1,6,1,
+		1,0,12,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,7,7,7,7,0,0,7,7,7,7,0,0,1,0,0,0,0,0,0,0,0,0,1,1,1,9,0,0,0,0,2,0,0,1,6,1,
+		1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,7,7,7,0,0,0,0,0,0,0,0,7,7,7,1,0,0,0,0,7,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,1,1,1,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+	},
+	// level.c
+	{
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		1,7,7,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,7,0,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,1,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,1,
+		1,7,7,1,0,0,1,1,1,1,1,1,1,1,1,0,0,0,13,0,1,0,0,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+		1,7,7,1,0,0,1,0,0,0,0,0,0,0,0,0,1,1,1,1,1,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+		1,0,0,0,0,0,1,0,1,1,1,1,1,1,1,1,1,6,0,0,2,0,0,0,0,0,0,0,0,0,0,0,6,8,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+		1,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,6,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,1,0,0,0,1,0,0,0,0,0,0,1,
+		1,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,1,0,0,0,1,0,0,0,0,0,0,1,
+		1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,13,0,0,0,0,1,0,0,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,1,10,10,10,10,10,10,10,1,0,0,0,1,10,10,10,10,10,10,1,
+		1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,7,0,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,1,10,10,10,10,10,10,6,1,0,0,0,1,6,10,10,10,10,10,1,
+		1,1,1,1,1,1,1,1,1,2,2,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,2,2,2,1,1,1,1,1,1,1,
+		1,7,0,0,0,0,0,0,1,0,0,0,1,0,0,0,0,0,0,7,1,0,0,0,0,0,0,0,0,9,9,9,0,0,0,0,0,0,0,0,1,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,1,
+		1,0,0,0,0,0,0,0,1,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,1,1,1,1,0,0,0,0,0,12,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+		1,0,0,0,0,0,0,0,1,1,0,1,1,0,0,0,0,0,0,0,1,0,0,0,0,0,1,0,0,5,0,5,0,0,1,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+		1,0,0,0,0,0,0,0,0,14,0,14,0,0,0,0,0,0,0,0,1,0,0,0,0,9,1,5,0,0,0,0,0,5,1,9,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+		1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,9,9,1,0,0,0,3,0,0,0,1,9,9,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+		1,0,0,0,0,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,9,1,5,0,0,0,0,0,5,1,9,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,1,0,0,0,0,0,0,1,
+		1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,1,0,0,5,0,5,0,0,1,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,1,0,0,0,0,0,0,1,
+		1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,12,0,0,0,0,0,1,1,1,1,1,0,0,0,0,0,0,0,1,9,9,9,9,9,9,9,1,0,0,0,1,9,9,9,9,9,9,1,
+		1,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,1,0,0,0,0,0,0,0,0,9,9,9,0,0,0,0,0,0,0,0,1,9,9,9,9,9,9,9,1,0,0,0,1,9,9,9,9,9,9,1,
+		1,1,1,1,1,1,1,1,1,2,2,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,2,1,1,1,1,1,1,1,1,
+		1,0,0,0,0,0,0,0,1,0,0,0,1,0,0,0,0,0,0,7,1,7,0,0,0,0,10,10,1,0,0,0,1,10,10,0,0,0,0,7,1,11,11,11,11,0,0,0,0,0,8,0,0,0,0,0,0,0,6,1,
+		1,0,1,1,1,1,1,0,1,0,6,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,10,10,1,0,0,0,1,10,10,0,0,0,0,0,1,11,11,11,11,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+		1,0,0,0,0,0,1,0,0,6,0,6,1,0,0,0,15,0,0,0,1,0,0,0,0,0,0,6,1,0,0,0,1,6,0,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+		1,1,1,1,1,0,1,1,1,1,1,1,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,1,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+		1,0,0,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,7,0,0,0,7,0,1,
+		1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+		1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+		1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,11,11,11,11,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+		1,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,1,7,0,0,0,0,0,0,0,0,6,0,0,0,0,0,0,0,0,7,1,11,11,11,11,0,0,0,0,0,0,0,0,0,0,0,0,0,6,1,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+	},
+	// level.d
+	{
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		1,0,0,0,0,0,0,0,0,0,0,0,0,0,9,0,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,9,9,9,9,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,9,9,9,1,
+		1,0,10,0,0,0,0,0,0,0,0,0,0,9,0,9,0,0,0,0,0,0,0,0,0,0,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,0,1,
+		1,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,0,7,0,0,0,0,7,0,0,0,1,0,0,0,0,0,1,0,1,
+		1,0,0,1,7,1,7,1,7,1,7,1,7,1,7,1,7,1,7,1,1,1,1,1,1,0,9,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,1,0,0,13,0,0,1,0,1,
+		1,0,0,1,0,0,10,0,10,0,10,0,10,0,10,0,10,0,10,7,7,0,0,0,1,1,9,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,1,0,0,0,0,0,1,0,1,
+		1,0,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,1,0,0,0,0,1,9,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,1,0,0,0,0,0,1,0,1,
+		1,0,0,1,0,0,10,0,10,0,10,0,10,0,10,0,10,0,10,7,1,0,4,0,0,1,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,1,0,0,1,1,1,0,1,1,1,0,1,
+		1,0,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,1,0,0,0,0,1,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,0,1,0,0,0,1,
+		1,0,0,1,0,0,10,0,10,0,10,0,10,0,10,0,10,0,10,7,1,0,0,0,1,1,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,0,1,0,0,0,1,
+		1,0,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,1,0,9,0,9,1,0,1,0,0,0,1,
+		1,0,0,2,0,0,10,0,10,0,10,0,10,0,10,0,10,0,10,7,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,1,9,0,9,0,1,0,1,0,0,0,1,
+		1,0,0,2,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,1,0,0,1,0,0,0,0,0,1,7,7,1,1,1,7,7,1,1,0,0,0,0,1,1,1,0,0,1,1,1,1,1,1,1,1,2,0,2,1,
+		1,0,0,2,0,0,10,0,10,0,10,0,10,0,10,0,10,0,10,7,1,0,0,1,0,1,0,1,0,1,0,0,1,1,1,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,9,0,0,1,0,1,0,0,0,1,
+		1,8,0,2,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,1,0,0,1,9,1,0,1,9,1,0,0,1,1,1,0,0,1,1,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,1,0,0,0,1,
+		1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,1,0,1,0,1,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,10,0,1,0,1,0,1,0,1,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,1,
+		1,0,0,0,0,0,0,0,0,0,0,0,0,11,0,0,0,1,0,0,0,0,0,1,0,1,0,1,0,1,0,0,0,3,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,1,0,0,0,1,
+		1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,1,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,1,1,1,1,1,1,1,1,1,1,0,0,1,0,0,1,0,0,0,1,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,1,1,1,0,0,0,1,
+		1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,1,9,0,0,0,7,0,0,0,0,1,
+		1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,1,9,0,0,7,7,7,7,0,0,1,
+		1,0,6,6,0,0,1,0,0,1,1,1,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,7,0,7,0,0,0,0,1,
+		1,0,6,0,0,1,0,1,0,0,1,0,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,7,7,7,0,0,0,1,
+		1,0,6,6,0,1,1,1,0,0,1,0,0,0,1,1,1,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,0,0,0,0,0,1,1,0,0,0,7,0,7,0,0,1,
+		1,0,6,0,0,1,0,1,0,0,1,0,0,1,1,1,0,0,0,0,1,0,0,0,0,1,0,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,1,0,0,0,0,0,1,1,0,7,7,7,7,0,0,0,1,
+		1,0,6,6,0,1,0,1,0,0,1,0,1,1,1,0,0,0,1,1,1,0,0,0,0,1,0,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,1,0,0,0,0,0,1,1,0,0,0,7,0,0,0,0,1,
+		1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,1,1,0,11,0,0,0,1,1,0,0,0,0,12,0,0,0,1,
+		1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,9,0,0,0,9,1,1,1,1,10,10,10,10,1,1,1,1,1,11,0,0,0,0,1,1,0,0,1,1,1,0,0,0,1,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+	},
+	// level.e
+	{
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		1,0,0,10,1,9,0,0,12,0,0,11,12,10,0,0,12,0,0,9,12,11,0,0,1,0,0,10,12,9,0,0,12,0,0,11,12,10,0,0,12,0,0,11,12,9,0,0,12,0,0,10,12,9,0,0,12,0,11,1,
+		1,0,10,0,1,0,9,0,12,0,11,0,12,0,10,0,12,0,9,0,12,0,11,0,1,0,10,0,12,0,9,0,12,0,11,0,12,0,10,0,12,0,11,0,12,0,9,0,12,0,10,0,12,0,9,0,12,0,11,1,
+		1,10,0,0,1,0,0,9,12,11,0,0,12,0,0,10,12,9,0,0,12,0,0,11,1,10,0,0,12,0,0,9,12,11,0,0,12,0,0,10,12,11,0,0,12,0,0,9,12,10,0,0,12,0,0,9,12,11,0,1,
+		1,12,12,12,1,1,1,1,1,1,1,1,1,1,1,1,1,12,12,12,1,1,1,1,1,12,12,12,1,1,1,1,1,1,1,1,1,12,12,12,1,1,1,1,1,1,1,1,1,12,12,12,1,1,1,1,1,1,1,1,
+		1,10,0,0,2,0,0,11,12,9,0,0,12,0,0,10,12,11,0,0,12,0,0,10,1,11,0,0,1,0,0,9,12,11,0,0,12,0,0,9,12,11,0,0,12,0,0,10,1,11,0,0,12,0,0,9,12,10,0,1,
+		1,0,10,0,2,0,11,0,12,0,9,0,12,0,10,0,12,0,11,0,12,0,10,0,1,0,11,0,1,0,9,0,12,0,11,0,12,0,9,0,12,0,11,0,12,0,10,0,1,0,11,0,12,0,9,0,12,0,10,1,
+		1,0,0,10,2,11,0,0,12,0,0,9,12,10,0,0,12,0,0,11,12,10,0,0,1,5,0,11,1,9,0,0,12,0,0,11,12,9,0,0,12,0,0,11,12,10,0,0,1,0,0,11,12,9,0,0,12,0,10,1,
+		1,12,12,12,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,12,12,12,1,12,12,12,1,1,1,1,1,1,1,1,1,12,12,1,
+		1,0,0,9,1,9,0,0,12,0,0,11,12,10,0,0,1,0,0,10,12,9,0,0,12,0,0,11,12,10,0,0,12,0,0,9,12,10,0,0,1,0,0,10,12,9,0,0,1,0,0,9,12,10,0,0,1,0,11,1,
+		1,0,9,0,1,0,9,0,12,0,11,0,12,0,10,0,1,0,10,0,12,0,9,0,12,0,11,0,12,0,10,0,12,0,9,0,12,0,10,0,1,0,10,0,12,0,9,0,1,0,9,0,12,0,10,0,1,0,11,1,
+		1,9,0,0,1,0,0,9,12,11,0,0,12,0,0,10,1,10,0,0,12,0,0,9,12,11,0,0,12,0,0,10,12,9,0,0,12,0,0,10,1,10,0,0,12,0,0,9,1,9,0,0,12,0,0,10,1,11,0,1,
+		1,12,12,12,1,12,12,12,1,12,12,12,1,12,12,12,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,12,12,12,1,1,1,1,1,12,12,12,1,1,1,1,1,12,12,12,1,12,12,12,1,2,2,1,
+		1,11,0,0,1,0,0,10,1,9,0,0,12,0,0,10,12,11,0,0,12,0,0,9,12,10,0,0,1,0,0,9,12,10,0,0,12,0,0,11,12,9,0,0,12,0,0,9,12,11,0,0,12,0,0,9,1,9,0,1,
+		1,0,11,0,1,0,10,0,1,0,9,0,12,0,10,0,12,0,11,0,12,0,9,0,12,0,10,0,1,0,9,0,12,0,10,0,12,0,11,0,12,0,9,0,12,0,9,0,12,0,11,0,12,0,9,0,1,0,9,1,
+		1,6,0,11,1,10,0,6,1,6,0,9,12,10,0,6,12,6,0,11,12,9,0,6,12,6,0,10,1,9,0,6,12,6,0,10,12,11,0,6,12,6,0,9,12,9,0,6,12,6,0,11,12,9,0,6,1,6,9,1,
+		1,12,12,12,1,12,12,12,1,12,12,12,1,1,1,1,1,1,1,1,1,1,1,1,1,12,12,12,1,12,12,12,1,12,12,12,1,12,12,12,1,1,1,1,1,12,12,12,1,1,1,1,1,1,1,1,1,12,12,1,
+		1,0,0,10,1,11,0,0,1,0,0,11,1,9,0,0,12,0,0,10,1,9,0,0,1,0,0,0,1,0,0,0,1,0,0,9,1,10,0,0,12,0,0,10,12,11,0,0,1,0,0,9,12,11,0,0,12,0,10,1,
+		1,0,10,0,1,0,11,0,1,0,11,0,1,0,9,0,12,0,10,0,1,0,9,0,1,0,0,0,1,0,0,0,1,0,9,0,1,0,10,0,12,0,10,0,12,0,11,0,1,0,9,0,12,0,11,0,12,0,10,1,
+		1,10,0,0,1,0,0,11,1,11,0,0,1,0,0,9,12,10,0,0,1,0,0,9,1,0,4,0,1,0,3,0,1,9,0,0,1,0,0,10,12,10,0,0,12,0,0,11,1,9,0,0,12,0,0,11,12,10,0,1,
+		1,12,12,12,1,12,12,12,1,12,12,12,1,12,12,12,1,1,1,1,1,12,12,12,1,1,1,1,1,1,1,1,1,12,12,12,1,12,12,12,1,12,12,12,1,1,1,1,1,12,12,12,1,1,1,1,1,12,12,1,
+		1,9,0,0,1,0,0,9,1,10,0,0,12,0,0,9,12,11,0,0,1,0,0,10,12,9,0,0,12,0,0,10,12,9,0,0,12,0,0,11,1,10,0,0,1,0,0,11,12,10,0,0,1,0,0,9,12,10,0,1,
+		1,0,9,0,1,0,9,0,1,0,10,0,12,0,9,0,12,0,11,0,1,0,10,0,12,0,9,0,12,0,10,0,12,0,9,0,12,0,11,0,1,0,10,0,1,0,11,0,12,0,10,0,1,0,9,0,12,0,10,1,
+		1,0,0,9,1,9,0,0,1,0,0,10,12,9,0,0,12,0,0,11,1,10,0,0,12,0,0,9,12,10,0,0,12,0,0,9,12,11,0,0,1,0,0,10,1,11,0,0,12,0,0,10,1,9,0,0,12,0,10,1,
+		1,12,12,12,1,12,12,12,1,1,1,1,1,12,12,12,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,12,12,12,1,12,12,12,1,1,1,1,1,12,12,1,
+		1,0,0,11,12,10,0,0,1,0,0,10,12,11,0,0,12,0,0,10,12,9,0,0,12,0,0,11,12,10,0,0,12,0,0,9,12,11,0,0,12,0,0,10,12,9,0,0,1,0,0,9,1,10,0,0,12,0,11,1,
+		1,0,11,0,12,0,10,0,1,0,10,0,12,0,11,0,12,0,10,0,12,0,9,0,12,0,11,0,12,0,10,0,12,0,9,0,12,0,11,0,12,0,10,0,12,0,9,0,1,0,9,0,1,0,10,0,12,0,11,1,
+		1,11,0,0,12,0,0,10,1,10,0,0,12,0,0,11,12,10,0,0,12,0,0,9,12,11,0,0,12,0,0,10,12,9,0,0,12,0,0,11,12,10,0,0,12,0,0,9,1,9,0,0,1,0,0,10,12,11,0,1,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+	},
+	// level.f
+	{
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		1,0,0,0,5,0,0,0,1,7,7,7,11,11,7,7,7,1,0,0,0,0,0,0,0,0,0,0,9,9,9,0,0,0,1,10,10,10,10,10,0,0,7,7,0,0,0,0,7,7,0,0,0,0,9,9,9,9,0,1,
+		1,10,0,10,0,10,0,10,1,0,0,0,0,0,0,0,0,1,0,0,0,0,9,9,0,0,0,9,9,9,9,0,0,0,1,0,0,0,0,10,0,0,7,0,7,0,0,7,7,7,0,0,7,9,9,0,0,0,0,1,
+		1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,0,0,9,9,0,9,0,9,9,0,0,0,0,0,0,1,0,0,0,0,10,0,0,7,0,0,7,7,7,9,7,0,7,9,7,7,0,0,0,0,1,
+		1,0,10,0,10,0,10,0,1,0,0,0,0,0,0,0,0,1,0,0,9,9,0,1,1,1,1,1,1,1,1,0,0,0,1,0,0,0,0,10,0,0,7,0,0,0,7,9,7,7,7,9,9,0,7,7,0,7,0,1,
+		1,0,0,0,0,0,0,0,1,0,0,0,9,0,9,0,9,1,0,0,9,0,0,1,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,10,0,0,7,7,9,0,0,9,7,7,0,7,0,0,0,7,7,7,0,1,
+		1,10,0,0,15,0,0,10,1,0,9,0,0,14,0,0,0,1,0,0,9,0,0,1,0,0,0,15,0,0,0,0,0,0,0,0,0,0,0,10,0,0,7,7,9,9,9,9,0,7,7,0,0,0,0,0,7,7,0,1,
+		1,7,7,7,7,7,7,7,1,2,2,2,2,2,2,2,2,1,9,9,9,0,0,1,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,10,0,0,7,7,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+		1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,9,9,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,6,6,6,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,0,9,9,0,0,1,0,0,0,10,10,0,0,0,0,10,10,0,0,0,10,10,0,0,0,0,10,10,0,0,0,0,10,10,0,0,0,0,0,0,10,1,
+		1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,0,0,15,0,0,2,0,0,0,10,0,10,0,0,10,0,10,10,0,10,10,10,10,0,0,10,0,10,10,0,0,10,10,10,10,0,0,10,10,10,10,1,
+		1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,0,0,0,0,0,1,0,0,0,0,10,10,10,10,0,0,0,10,10,10,0,0,10,10,10,0,0,0,10,10,10,10,0,0,10,10,10,10,0,0,10,1,
+		1,0,9,0,9,0,9,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,7,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		1,9,7,9,7,9,7,1,5,7,7,7,7,7,2,0,2,10,0,0,0,0,0,10,10,0,0,0,10,10,7,0,0,0,0,0,10,10,0,0,0,0,0,10,0,10,10,0,12,0,0,0,0,0,10,10,10,0,0,1,
+		1,7,9,7,9,7,9,1,12,7,7,7,7,7,2,10,2,10,10,0,0,0,10,10,0,10,0,0,10,0,7,10,10,0,0,10,10,0,10,0,0,10,10,10,0,10,10,10,0,0,10,10,10,0,0,0,10,10,10,1,
+		1,9,7,9,7,9,7,1,5,7,7,7,7,7,2,10,2,0,10,10,0,10,10,0,0,0,10,0,0,0,7,10,0,10,10,10,0,0,10,0,10,0,10,10,0,10,0,10,10,10,10,0,0,10,0,10,10,0,10,1,
+		1,7,7,7,7,7,7,1,10,10,10,10,10,10,2,0,2,0,0,10,10,10,10,0,0,0,0,10,0,0,7,10,10,0,10,0,0,0,10,10,0,0,0,10,10,0,0,0,10,10,0,0,0,10,10,10,10,10,10,1,
+		1,0,0,0,0,0,0,1,12,7,7,7,7,7,2,10,2,0,0,10,10,0,10,0,10,10,10,0,10,10,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,1,1,1,1,1,
+		1,0,0,0,0,0,0,1,5,7,7,7,7,7,2,10,2,10,10,10,0,0,10,10,10,0,10,10,10,10,10,0,0,10,0,1,7,7,7,7,7,7,7,7,7,7,7,7,1,0,0,0,0,0,0,0,0,0,0,1,
+		1,0,0,0,0,0,0,1,12,7,7,7,7,7,2,0,2,0,0,0,0,0,10,10,0,0,10,10,0,0,0,10,10,10,0,1,7,0,7,0,7,0,7,0,7,0,7,0,1,0,7,7,7,7,7,7,7,7,0,1,
+		1,0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,7,7,1,1,1,1,7,7,7,7,7,7,1,0,7,0,0,11,11,11,0,7,0,1,
+		1,0,0,0,0,0,0,9,0,0,0,0,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,7,1,0,0,0,0,0,0,0,0,0,0,1,0,7,0,11,0,0,0,11,7,0,1,
+		1,0,0,0,0,0,0,9,0,0,0,0,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,3,0,7,1,15,0,5,0,0,0,0,0,0,0,1,0,7,0,0,0,0,0,11,7,0,1,
+		1,0,0,0,0,0,0,9,0,0,0,0,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,7,1,0,0,0,0,0,0,0,0,0,0,1,0,7,0,0,0,0,0,11,7,0,1,
+		1,2,2,2,2,2,12,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,7,7,1,1,1,1,7,7,7,7,7,7,1,0,7,0,0,0,0,11,0,7,2,1,
+		1,9,9,9,9,9,0,0,0,0,13,0,0,0,0,9,9,9,9,9,9,0,0,9,9,0,0,0,0,0,7,0,0,6,11,1,7,0,7,0,7,0,7,0,7,0,7,0,1,0,7,0,0,0,11,0,0,7,0,1,
+		1,9,7,7,7,9,0,0,0,0,0,0,13,0,9,9,7,7,0,9,9,7,7,7,9,9,9,9,9,0,7,0,0,6,5,1,7,7,7,7,7,7,7,7,7,7,7,7,1,0,7,0,0,0,11,0,0,7,0,1,
+		1,9,9,0,7,7,7,7,0,0,13,0,0,0,7,9,9,7,7,0,7,7,0,0,7,0,0,0,0,0,7,0,0,6,11,1,7,0,7,0,7,0,7,0,7,0,7,0,1,0,7,7,7,7,7,7,7,7,0,1,
+		1,0,9,9,0,7,7,7,0,0,0,0,0,0,0,9,9,0,0,0,0,0,0,0,0,7,7,7,7,7,7,0,0,6,11,1,6,7,6,7,6,7,6,7,6,7,6,8,1,0,0,0,0,0,12,0,0,0,4,1,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+	},
+	// level.g
+	{
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		1,0,0,0,0,0,0,0,9,1,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,
+		1,0,0,0,0,0,0,0,9,1,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,7,7,7,7,7,7,0,1,
+		1,0,0,0,0,0,0,0,9,2,0,0,0,9,0,9,0,9,0,0,2,0,0,0,0,9,0,0,0,0,2,2,0,0,9,9,9,0,9,0,0,2,0,9,9,9,9,0,0,0,2,0,7,9,9,9,9,7,0,1,
+		1,0,0,0,0,0,0,0,9,1,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,7,7,7,7,7,7,0,1,
+		1,9,9,9,9,9,9,9,9,1,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,
+		1,1,1,1,2,1,1,1,1,1,1,1,1,1,1,2,1,1,1,1,1,1,1,1,1,2,1,1,1,1,1,1,1,1,1,1,2,1,1,1,1,1,1,1,1,1,2,1,1,1,1,1,1,1,2,1,1,1,1,1,
+		1,1,1,1,2,1,1,1,1,1,1,1,1,1,1,2,1,1,1,1,1,1,1,1,1,2,1,1,1,1,1,1,1,1,1,1,2,1,1,1,1,1,1,1,1,1,2,1,1,1,1,1,1,1,2,1,1,1,1,1,
+		1,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,5,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,
+		1,0,0,0,0,8,0,0,0,1,0,6,0,6,0,6,0,6,0,0,1,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,
+		1,0,0,0,8,0,8,0,0,2,0,0,6,0,6,0,6,0,6,0,2,5,0,0,0,3,0,0,0,5,2,2,0,0,0,10,10,10,0,0,0,2,0,9,9,9,0,9,9,0,2,0,0,0,9,9,9,0,0,1,
+		1,0,0,0,0,8,0,0,0,1,0,6,0,6,0,6,0,6,0,0,1,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,
+		1,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,5,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,
+		1,1,1,1,1,2,1,1,1,1,1,1,1,1,1,2,1,1,1,1,1,1,1,1,1,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,1,1,1,1,1,1,1,1,1,2,1,1,1,1,
+		1,1,1,1,1,2,1,1,1,1,1,1,1,1,1,2,1,1,1,1,1,1,1,1,1,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,1,1,1,1,1,1,1,1,1,2,1,1,1,1,
+		1,0,0,0,0,0,0,0,0,1,7,7,7,7,7,7,7,7,7,7,1,13,0,0,0,0,0,0,0,13,1,1,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,
+		1,0,0,0,0,0,0,0,0,1,7,0,0,0,0,0,0,0,0,7,1,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,
+		1,0,0,0,0,12,0,0,0,2,7,0,7,7,7,7,7,7,0,7,1,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,1,0,0,10,0,0,10,10,0,1,0,0,0,10,10,10,0,10,1,
+		1,0,0,0,12,0,0,0,0,1,7,0,7,7,7,7,7,7,0,7,2,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,4,0,0,0,0,2,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,1,
+		1,0,0,0,0,0,0,0,0,1,7,0,0,0,0,0,0,0,0,7,1,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,0,10,0,0,0,0,0,1,
+		1,0,0,0,0,0,0,0,0,1,7,7,7,7,7,7,7,7,7,7,1,13,0,0,0,0,0,0,0,13,1,1,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,
+		1,1,1,1,2,1,1,1,1,1,1,1,1,1,2,1,1,1,1,1,1,1,1,1,1,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,1,1,1,1,1,1,1,2,1,1,1,1,1,
+		1,1,1,1,2,1,1,1,1,1,1,1,1,1,2,1,1,1,1,1,1,1,1,1,1,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,1,1,1,1,1,1,1,2,1,1,1,1,1,
+		1,0,5,0,5,0,5,0,5,1,15,0,0,0,0,0,0,0,0,15,1,14,0,0,0,0,0,0,0,14,1,1,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,
+		1,5,0,5,0,5,0,5,0,1,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,1,1,0,0,0,11,11,11,11,0,0,1,0,0,11,11,11,0,0,0,1,0,0,0,0,0,0,0,0,1,
+		1,0,5,0,5,0,5,0,5,2,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,2,2,0,0,0,11,0,0,11,0,0,2,0,0,0,0,11,0,0,0,2,0,0,10,10,10,0,0,0,1,
+		1,5,0,5,0,5,0,5,0,1,0,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,1,1,0,0,0,11,0,11,11,0,0,1,0,0,11,11,11,0,0,0,1,0,0,10,10,10,0,0,0,1,
+		1,0,5,0,5,0,5,0,5,1,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,1,1,0,0,0,11,11,11,11,0,0,1,0,0,0,0,0,0,0,0,1,0,0,10,10,10,0,0,0,1,
+		1,5,0,5,0,5,0,5,0,1,15,0,0,0,0,0,0,0,0,15,1,14,0,0,0,0,0,0,0,14,1,1,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+	},
+	// level.h
+	{
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		1,8,0,8,0,8,0,8,0,8,0,8,5,8,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+		1,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,7,7,7,7,7,0,0,7,7,7,7,7,0,0,7,7,7,7,7,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,1,
+		1,0,0,0,14,14,14,14,14,14,14,14,0,0,1,0,0,7,0,0,0,7,0,0,7,0,0,0,7,0,0,7,0,0,0,7,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+		1,0,0,14,14,14,14,14,14,14,14,14,14,0,1,0,0,7,0,13,0,7,0,0,7,0,3,0,7,0,0,7,0,13,0,7,0,0,1,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,1,
+		1,0,0,14,14,0,0,14,14,0,0,14,14,0,1,0,0,7,0,0,0,7,0,0,7,0,0,0,7,0,0,7,0,0,0,7,0,0,1,0,0,0,0,0,1,0,0,0,0,1,0,0,0,0,0,0,0,0,0,1,
+		1,0,0,14,14,0,0,14,14,0,0,14,14,0,1,0,0,7,7,7,7,7,0,0,7,7,7,7,7,0,0,7,7,7,7,7,0,0,1,0,0,0,0,0,1,0,0,0,0,1,1,1,1,1,1,1,1,0,0,1,
+		1,0,0,14,14,0,0,14,14,0,0,14,14,0,1,0,0,0,0,0,0,0,6,6,0,0,0,0,0,6,6,0,0,0,0,0,0,0,1,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+		1,0,0,14,14,14,14,0,0,14,14,14,14,0,1,0,0,7,7,7,7,7,0,0,7,7,7,7,7,0,0,7,7,7,7,7,0,0,1,2,2,1,1,1,1,0,0,0,0,0,0,0,12,0,0,0,0,0,0,1,
+		1,0,0,0,0,0,14,0,0,14,0,0,0,0,1,0,0,7,0,0,0,7,0,0,7,0,0,0,7,0,0,7,0,0,0,7,0,0,1,0,6,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+		1,0,0,0,0,0,14,14,14,14,0,0,0,0,1,0,0,7,0,14,0,7,0,0,7,0,13,0,7,0,0,7,0,14,0,7,0,0,1,0,6,6,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,1,
+		1,0,0,0,0,0,14,14,14,14,0,0,0,0,1,0,0,7,0,0,0,7,0,0,7,0,0,0,7,0,0,7,0,0,0,7,0,0,1,0,0,1,0,0,0,0,1,1,0,14,0,0,0,0,0,12,0,0,0,1,
+		1,0,0,14,14,14,0,0,0,0,14,14,14,0,1,0,0,7,7,7,7,7,0,0,7,7,7,7,7,0,0,7,7,7,7,7,0,0,1,2,2,1,1,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,
+		1,0,0,0,0,0,14,14,14,14,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,6,0,1,1,0,0,0,0,1,1,0,14,0,0,0,0,0,0,0,1,
+		1,0,0,14,14,14,0,0,0,0,14,14,14,0,1,1,1,1,1,1,1,1,1,1,1,0,0,0,1,1,1,1,1,1,1,1,1,1,1,0,0,14,0,1,1,0,0,0,0,1,1,0,0,0,0,0,0,0,0,1,
+		1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,12,1,0,0,0,1,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,1,1,0,14,0,0,0,0,0,1,
+		1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,14,0,1,1,0,0,0,0,1,1,0,0,0,0,0,0,1,
+		1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,1,1,0,14,0,0,0,1,
+		1,6,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,14,0,1,1,0,0,0,0,1,1,0,0,0,0,1,
+		1,6,6,6,6,6,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,1,1,0,14,0,1,
+		1,6,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,14,0,1,1,0,0,0,0,1,1,0,0,1,
+		1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,5,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,1,1,0,1,
+		1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,5,0,0,0,1,1,0,0,0,0,0,0,14,0,0,0,0,0,0,0,0,0,0,14,0,1,1,0,0,0,0,1,1,1,
+		1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,1,1,
+		1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,14,0,1,1,0,0,0,0,1,
+		1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,1,1,0,0,0,1,
+		1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,1,
+		1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+		1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,2,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,1,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+	},
+	// level.i
+	{
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		1,8,12,8,1,0,0,0,0,0,0,0,0,0,0,0,9,9,1,0,0,2,1,1,1,1,1,1,9,9,9,9,9,9,9,1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,1,10,0,0,0,0,0,0,0,1,
+		1,12,8,12,1,0,1,1,1,1,1,1,1,0,0,0,9,9,1,0,0,2,1,1,1,1,1,1,9,1,1,1,1,1,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,0,0,1,
+		1,8,12,8,1,0,1,0,0,0,0,0,1,0,1,1,9,9,0,0,0,2,1,1,1,1,1,1,9,9,9,9,9,9,9,1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+		1,0,0,0,1,0,1,0,0,0,0,0,1,0,7,1,9,9,1,0,0,2,1,1,1,1,1,1,1,1,1,9,1,1,1,1,1,1,1,1,1,1,1,7,1,1,0,0,0,0,0,0,1,1,1,1,1,0,0,1,
+		1,0,15,0,1,0,1,0,0,13,0,0,1,0,0,1,9,9,1,0,0,2,0,0,0,0,0,0,0,0,0,9,0,0,0,0,0,0,0,0,0,1,7,1,7,1,1,0,0,0,0,0,1,10,0,10,0,0,0,1,
+		1,0,0,0,1,0,1,0,0,0,0,0,1,0,7,1,9,9,0,0,0,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,1,1,7,1,7,1,1,1,1,1,0,1,10,0,10,0,0,0,1,
+		1,0,0,0,1,0,1,0,0,0,0,0,1,0,0,1,9,9,1,0,0,2,0,1,0,0,0,0,0,0,0,9,0,0,0,0,0,0,0,1,0,1,7,1,7,1,7,1,7,1,1,0,1,1,1,1,1,0,0,1,
+		1,0,0,0,1,0,1,0,0,0,0,0,1,0,7,1,9,9,1,0,0,2,0,1,0,1,1,1,1,1,1,1,1,1,1,1,1,1,0,1,0,1,1,7,1,7,1,7,1,7,1,0,0,0,0,0,0,0,0,1,
+		1,15,0,15,1,0,1,0,0,0,0,0,1,0,0,1,9,9,0,0,0,2,0,1,0,1,0,0,0,0,0,9,0,0,0,0,0,1,0,1,0,1,7,1,7,1,7,1,7,1,1,1,1,1,1,1,1,1,0,1,
+		1,0,0,0,1,0,1,0,0,13,0,0,1,0,7,1,9,9,1,0,0,2,0,1,0,1,0,1,1,1,1,1,1,1,1,1,0,1,0,1,0,1,1,7,1,7,1,7,1,7,1,7,1,7,1,7,1,0,1,1,
+		1,0,0,0,1,0,1,0,0,0,0,0,1,0,0,1,9,9,1,0,0,2,0,1,0,1,0,1,0,0,0,9,0,0,0,1,0,1,0,1,0,1,7,1,7,1,7,1,7,1,7,1,7,1,7,1,1,1,0,1,
+		1,0,0,0,1,0,1,0,0,0,0,0,1,0,7,1,9,9,0,0,0,2,0,1,0,1,0,1,0,1,1,1,1,1,0,1,0,1,0,1,0,1,1,1,1,7,1,7,1,7,1,7,1,7,1,7,1,0,1,1,
+		1,0,15,0,1,0,1,0,0,0,0,0,1,0,0,1,9,9,1,0,0,2,0,1,0,1,0,0,0,1,0,0,0,1,0,1,0,0,0,0,0,0,0,0,1,1,1,1,7,1,7,1,7,1,7,1,1,1,0,1,
+		1,0,0,0,1,0,1,0,0,0,0,0,1,0,7,1,9,9,1,0,0,2,0,1,0,1,1,1,1,1,0,3,0,0,0,1,0,1,1,1,1,1,1,0,0,0,0,0,1,7,1,7,1,7,1,7,1,0,1,1,
+		1,0,0,0,1,0,1,0,0,13,0,0,1,0,0,1,9,9,0,0,0,2,0,1,0,1,0,0,0,1,0,0,0,1,0,1,0,0,0,0,0,0,0,0,1,1,0,0,1,1,7,1,7,1,7,1,1,1,0,1,
+		1,0,0,0,1,0,1,0,0,0,0,0,1,0,7,1,9,9,1,0,0,2,0,1,0,1,0,1,0,1,1,1,1,1,0,1,0,1,0,1,0,1,1,1,1,1,1,0,1,7,1,7,1,7,1,7,1,0,1,1,
+		1,0,0,0,1,0,1,0,0,0,0,0,1,0,0,1,9,9,1,0,0,2,0,1,0,1,0,1,0,0,0,9,0,0,0,1,0,1,0,1,0,1,1,6,1,1,1,0,1,1,7,1,7,1,7,1,1,1,0,1,
+		1,0,14,0,1,0,1,0,0,0,0,0,1,0,7,1,9,9,0,0,0,2,0,1,0,1,0,1,1,1,1,1,1,1,1,1,0,1,0,1,0,1,6,1,6,1,1,0,1,1,1,1,1,1,1,1,1,0,1,1,
+		1,0,0,0,1,0,1,0,0,13,0,0,1,0,0,1,9,9,1,0,0,2,0,1,0,1,0,0,0,0,0,9,0,0,0,0,0,1,0,1,0,1,1,6,1,6,1,0,1,0,0,0,0,0,0,0,1,1,0,1,
+		1,0,0,0,1,0,1,0,0,0,0,0,1,0,1,1,9,9,1,0,0,2,0,1,0,1,1,1,1,1,1,1,1,1,1,1,1,1,0,1,0,1,6,1,6,1,1,0,1,0,4,0,0,0,4,0,1,0,1,1,
+		1,0,0,0,1,0,1,0,0,0,0,0,1,0,0,0,9,9,0,0,0,2,0,1,0,0,0,0,0,0,0,9,0,0,0,0,0,0,0,1,5,1,1,6,1,1,1,0,1,0,0,0,0,0,0,0,1,1,0,1,
+		1,0,0,0,1,0,1,0,0,13,0,0,1,0,0,0,9,9,1,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,1,0,10,10,10,10,10,0,1,0,1,1,
+		1,0,13,0,1,0,1,0,0,0,0,0,1,1,1,1,1,1,1,1,1,1,6,11,7,11,7,11,7,10,7,10,7,10,7,10,7,9,7,9,7,9,7,9,7,2,0,0,1,0,0,0,0,0,0,0,1,1,0,1,
+		1,0,0,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,6,7,11,7,11,7,11,7,10,7,10,7,10,7,10,7,9,7,9,7,9,7,9,2,0,0,1,1,1,1,1,1,1,1,1,0,1,1,
+		1,0,0,0,1,0,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,1,6,11,7,11,7,11,7,10,7,10,7,10,7,10,7,9,7,9,7,9,7,9,7,2,0,0,1,1,1,1,1,1,1,1,0,1,0,1,
+		1,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,0,1,6,7,11,7,11,7,11,7,10,7,10,7,10,7,10,7,9,7,9,7,9,7,9,2,0,0,1,1,1,1,1,1,1,1,1,0,0,1,
+		1,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,1,6,11,7,11,7,11,7,10,7,10,7,10,7,10,7,9,7,9,7,9,7,9,7,2,0,0,1,1,1,1,1,1,1,1,0,0,0,1,
+		1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,6,7,11,7,11,7,11,7,10,7,10,7,10,7,10,7,9,7,9,7,9,7,9,2,0,0,1,1,1,1,1,1,1,1,0,4,0,1,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+	},
+	// level.j
+	{
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		1,1,9,1,0,1,0,1,0,1,12,1,12,1,0,1,0,1,12,1,12,1,9,1,1,0,1,1,9,1,9,1,1,0,1,1,9,1,8,1,9,1,0,1,0,1,9,1,0,1,0,1,0,1,0,1,6,0,6,1,
+		1,1,1,0,1,1,1,0,1,1,1,0,1,1,1,0,1,1,1,0,1,1,1,0,1,0,1,0,1,1,1,0,1,0,1,0,1,1,1,0,1,1,1,0,1,1,1,0,1,1,1,0,1,1,1,0,0,3,0,1,
+		1,1,0,1,0,1,9,1,0,1,0,1,9,1,0,1,0,1,9,1,0,1,1,1,0,0,0,1,1,1,1,1,0,0,0,1,1,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,6,0,6,1,
+		1,0,1,1,1,0,1,1,1,0,1,1,1,0,1,1,1,0,1,1,1,1,0,0,0,6,0,0,0,1,0,0,0,6,0,0,0,1,1,1,1,0,1,1,1,0,1,1,1,0,1,1,1,0,1,1,1,0,1,1,
+		1,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,1,1,0,0,0,1,1,1,1,1,0,0,0,1,1,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,
+		1,1,1,0,1,1,1,0,1,1,1,0,1,1,1,0,1,1,1,0,1,1,1,0,1,0,1,0,1,1,1,0,1,0,1,0,1,1,1,0,1,1,1,0,1,1,1,0,1,1,1,0,1,1,1,0,1,1,1,1,
+		1,1,9,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,1,9,1,1,0,1,0,1,1,9,1,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,9,1,
+		1,0,1,1,1,0,1,1,1,0,1,1,1,0,1,1,1,0,1,1,1,2,1,1,1,1,1,1,1,0,1,1,1,1,1,1,1,0,1,1,1,0,1,1,1,0,1,1,1,0,1,1,1,0,1,1,1,0,1,1,
+		1,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,0,0,1,0,0,0,1,0,0,0,1,0,0,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,
+		1,1,1,0,1,1,1,0,1,1,1,0,1,1,1,0,1,1,1,0,1,1,0,13,0,1,0,6,0,1,0,6,0,1,0,11,0,1,1,0,1,0,1,0,1,9,1,0,1,0,1,0,1,9,1,0,1,0,1,1,
+		1,1,10,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,0,0,1,0,0,0,1,0,0,0,1,0,0,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,
+		1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,1,1,1,1,0,1,1,1,0,1,1,1,0,1,1,1,1,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,1,
+		1,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,10,1,0,0,0,1,0,0,0,1,0,0,0,1,0,0,0,1,0,1,0,1,10,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,10,1,
+		1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,10,1,0,1,0,1,1,0,13,0,1,0,6,0,1,0,6,0,1,0,13,0,1,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,1,
+		1,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,0,0,1,0,0,0,1,0,0,0,1,0,0,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,
+		1,0,1,0,1,0,1,0,1,0,1,0,1,10,1,0,1,0,1,0,1,2,1,1,1,0,1,1,1,0,1,1,1,0,1,1,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,1,
+		1,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,0,0,1,0,0,0,1,0,0,0,1,0,0,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,
+		1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,1,0,14,0,1,0,6,0,1,0,6,0,1,0,13,0,1,1,0,1,0,1,0,1,1,1,0,1,0,1,0,1,1,1,0,1,0,1,1,
+		1,1,10,1,0,1,0,1,0,1,0,1,10,1,0,1,0,1,0,1,0,1,0,0,0,1,0,0,0,1,0,0,0,1,0,0,0,1,1,1,0,1,0,1,1,1,1,1,0,1,10,1,1,1,1,1,0,1,0,1,
+		1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,1,1,1,1,0,1,1,1,1,1,1,1,0,1,1,1,1,1,1,1,0,1,1,1,1,1,1,1,0,1,1,1,1,1,1,1,0,1,1,
+		1,1,0,0,0,1,0,0,0,1,0,0,0,1,0,0,0,1,0,0,0,1,0,0,0,1,0,0,0,1,0,0,0,1,0,0,0,1,1,1,0,1,0,1,1,1,1,1,0,1,0,1,1,1,1,1,0,1,0,1,
+		1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,1,0,14,0,1,0,6,0,1,0,6,0,1,0,13,0,1,1,0,1,1,1,0,1,1,1,0,1,1,1,0,1,1,1,0,1,1,1,1,
+		1,12,0,1,0,0,0,1,0,0,0,1,0,0,0,1,0,0,0,1,0,1,0,0,0,1,0,0,0,1,0,0,0,1,0,0,0,1,0,1,1,1,1,1,10,1,0,1,1,1,1,1,0,1,0,1,1,1,1,1,
+		1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,2,1,1,1,1,1,1,1,0,1,1,1,1,1,1,1,0,1,1,1,1,1,1,1,0,1,1,1,1,1,1,1,0,1,1,1,1,1,1,
+		1,1,0,0,0,1,0,0,0,1,0,0,0,1,0,11,0,1,0,0,0,1,0,0,0,1,0,0,0,1,0,0,0,1,0,0,0,1,0,1,1,1,1,1,0,1,10,1,1,1,1,1,0,1,0,1,1,1,1,1,
+		1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,1,0,15,0,1,0,6,0,1,0,6,0,1,0,14,0,1,1,0,1,1,1,0,1,1,1,0,1,1,1,0,1,1,1,0,1,1,1,1,
+		1,4,0,1,0,0,0,1,0,0,0,1,0,0,0,1,0,0,0,1,11,1,0,0,0,1,0,0,0,1,0,0,0,1,0,0,0,1,1,1,0,1,0,1,1,1,1,1,0,1,0,1,1,1,1,1,0,1,10,1,
+		1,11,1,0,1,0,1,11,1,0,1,0,1,0,1,0,1,0,1,0,1,1,1,1,1,0,1,1,1,1,1,1,1,0,1,1,1,1,1,1,1,12,1,1,1,1,1,1,1,5,1,1,1,1,1,1,1,0,1,1,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+	},
+	// level.k
+	{
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,9,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,12,1,
+		1,0,0,1,1,1,0,0,0,0,0,0,0,1,1,1,0,0,1,0,0,9,0,9,9,9,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+		1,0,0,0,1,0,0,1,0,0,0,1,0,0,1,0,0,0,1,1,1,1,1,1,1,1,1,0,0,0,0,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,0,0,0,0,1,
+		1,0,0,0,1,0,1,0,0,0,0,0,1,0,1,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+		1,0,0,0,1,0,1,0,0,0,0,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+		1,0,0,0,1,0,1,0,0,3,0,0,1,0,1,0,0,1,1,0,1,1,1,1,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,0,1,1,0,0,0,0,1,1,1,1,1,0,0,0,1,
+		1,0,0,0,1,0,1,0,0,0,0,0,1,0,1,0,0,0,1,1,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,0,1,0,0,0,1,
+		1,0,0,0,1,0,1,1,1,1,1,1,1,0,1,0,0,0,1,0,0,15,15,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,1,
+		1,0,0,0,1,0,0,0,0,0,0,0,0,0,1,0,0,0,1,0,0,15,15,0,1,0,0,0,0,0,0,0,0,0,0,1,8,1,0,0,1,1,1,0,0,0,0,0,1,0,0,0,1,0,0,1,0,0,0,1,
+		1,0,0,0,0,1,1,1,1,1,1,1,1,1,0,0,0,0,1,1,0,0,0,0,1,0,0,0,0,1,1,1,1,1,0,0,0,0,0,1,1,0,1,1,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,1,
+		1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,1,1,1,0,0,0,0,0,1,0,0,0,1,1,0,7,0,1,1,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,1,
+		1,0,1,1,10,10,1,1,10,10,1,1,0,0,1,0,0,0,1,0,0,0,0,0,0,0,11,0,0,1,0,0,0,0,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+		1,0,1,1,1,1,1,1,1,1,1,1,0,0,1,0,0,0,1,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+		1,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,1,0,0,1,1,1,0,0,0,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,1,0,0,0,1,
+		1,0,1,1,0,0,1,1,0,0,1,1,0,0,1,11,0,1,1,0,0,1,1,1,0,0,0,1,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,0,0,6,6,6,1,0,0,0,1,
+		1,0,1,1,0,0,1,1,0,0,1,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,1,
+		1,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,
+		1,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,1,
+		1,1,1,1,1,1,1,1,1,1,0,0,11,0,1,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,0,0,0,1,7,9,7,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+		1,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,1,0,1,1,1,1,1,1,0,1,0,0,0,0,1,1,1,1,1,0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,1,
+		1,1,1,1,1,0,0,1,0,1,0,0,0,1,1,1,0,0,0,1,0,1,0,0,0,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+		1,0,0,0,0,0,10,1,0,1,0,0,0,0,0,1,0,0,0,1,0,1,0,1,1,0,1,1,0,1,0,0,0,1,1,1,1,0,0,1,1,1,0,0,0,0,0,1,1,1,1,1,0,1,1,1,0,0,0,1,
+		1,0,0,0,0,0,10,1,0,1,0,0,0,0,0,1,0,0,0,1,0,1,0,1,1,0,0,1,0,1,0,0,1,1,0,0,1,1,0,0,1,0,0,0,0,0,0,0,1,0,0,1,1,1,0,1,1,0,0,1,
+		1,0,1,1,1,0,10,1,0,1,0,0,9,0,0,1,0,13,0,1,0,1,0,1,1,0,1,1,0,1,0,0,1,0,0,0,0,1,1,0,0,1,0,0,1,0,0,1,0,0,0,1,0,0,0,0,1,0,0,1,
+		1,0,0,0,1,0,10,1,0,1,0,0,0,0,0,1,0,0,0,1,0,1,0,0,0,0,1,0,0,1,0,0,1,1,0,0,0,0,1,0,0,1,0,1,0,1,0,1,0,0,0,1,0,0,4,0,1,0,0,1,
+		1,1,1,0,1,0,10,1,0,0,0,0,0,0,0,1,0,13,0,1,0,1,1,1,1,1,1,0,1,0,0,0,0,1,1,0,0,1,1,0,0,0,1,0,0,0,1,0,0,0,0,1,0,0,0,0,1,0,0,1,
+		1,0,10,0,1,0,10,1,1,1,1,1,1,1,1,1,0,0,0,1,0,0,0,0,0,0,0,0,1,0,0,0,0,0,1,1,1,1,0,0,0,0,1,0,0,0,1,0,0,0,1,1,1,2,2,1,1,1,0,1,
+		1,5,0,1,1,0,0,10,0,0,10,10,10,10,0,0,0,1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+	},
+	// level.l
+	{
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		1,8,6,7,7,11,10,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,10,11,7,7,6,8,1,
+		1,6,6,7,7,11,10,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,10,11,7,7,6,6,1,
+		1,7,7,7,7,11,10,9,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,0,0,0,0,0,0,0,9,10,11,7,7,7,7,1,
+		1,7,7,7,7,11,10,9,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,1,0,1,0,1,0,0,0,0,0,0,0,9,10,11,7,7,7,7,1,
+		1,11,11,11,11,11,10,9,0,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,0,0,0,0,0,0,0,9,10,11,11,11,11,11,1,
+		1,10,10,10,10,10,10,9,0,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,1,0,0,0,0,0,0,0,9,10,10,10,10,10,10,1,
+		1,9,9,9,9,9,9,9,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,0,0,0,0,0,0,0,9,9,9,9,9,9,9,1,
+		1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+		1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+		1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+		1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+		1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+		1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,0,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+		1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,1,12,0,0,0,12,1,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+		1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,3,0,0,1,0,0,0,0,0,0,0,0,0,0,0,1,0,0,4,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,
+		1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,1,12,0,0,0,12,1,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+		1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,0,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+		1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+		1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+		1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,1,1,0,0,0,0,0,0,0,0,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+		1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,1,1,0,0,0,0,0,0,0,0,1,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+		1,9,9,9,9,9,9,9,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,1,0,0,0,0,0,0,0,9,9,9,9,9,9,9,1,
+		1,10,10,10,10,10,10,9,0,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,0,0,0,0,0,0,9,10,10,10,10,10,10,1,
+		1,11,11,11,11,11,10,9,0,0,0,0,0,0,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,0,0,0,0,0,0,9,10,11,11,11,11,11,1,
+		1,7,7,7,7,11,10,9,0,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,1,0,0,1,0,0,1,0,0,0,0,0,0,9,10,11,7,7,7,7,1,
+		1,7,7,7,7,11,10,9,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,9,10,11,7,7,7,7,1,
+		1,6,6,7,7,11,10,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,0,0,0,0,0,0,0,9,10,11,7,7,6,6,1,
+		1,8,6,7,7,11,10,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,10,11,7,7,6,8,1,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+	},
+	// level.m
+	{
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		1,9,0,0,0,9,1,1,1,1,1,0,0,0,0,0,1,1,1,1,1,0,0,10,0,0,1,1,1,1,1,0,7,0,7,0,1,1,1,1,1,0,7,0,7,0,1,1,1,1,1,7,7,7,7,7,1,1,1,1,
+		1,0,0,0,0,0,1,0,0,0,1,0,0,0,0,0,1,0,0,0,1,0,7,10,7,0,1,0,0,0,1,7,0,7,0,7,1,0,0,0,1,7,0,7,0,7,1,0,0,0,1,7,0,0,0,7,1,0,0,1,
+		1,0,0,0,0,0,2,0,13,0,1,0,0,0,0,0,2,0,13,0,1,0,7,10,7,0,2,8,13,0,1,0,0,12,0,0,2,0,13,0,1,0,0,12,0,0,2,0,13,0,1,7,9,5,0,7,2,0,13,1,
+		1,0,0,14,0,0,1,0,0,0,1,0,0,0,0,0,1,0,0,0,1,0,7,10,7,0,1,0,0,0,1,0,0,13,0,0,1,0,0,0,1,0,0,13,0,0,1,0,0,0,1,7,0,0,0,7,1,0,0,1,
+		1,9,0,0,0,9,1,1,1,1,1,0,0,0,0,0,1,1,1,1,1,0,7,6,7,0,1,1,1,1,1,0,0,0,0,0,1,1,1,1,1,11,0,0,0,11,1,1,1,1,1,7,7,7,7,7,1,1,1,1,
+		1,1,1,1,1,1,0,0,0,0,0,1,1,1,1,1,0,0,0,0,0,1,1,1,1,1,0,0,0,0,0,1,1,1,1,1,0,0,0,0,0,1,1,1,1,1,0,0,0,0,0,1,1,1,1,1,0,0,0,1,
+		1,0,0,0,0,1,0,0,0,0,0,1,0,0,0,1,0,0,0,0,0,1,0,0,0,1,0,0,0,0,0,1,0,0,0,1,0,0,0,0,0,1,0,0,0,1,0,0,0,0,0,1,0,0,0,1,0,0,9,1,
+		1,0,0,13,0,2,0,15,0,0,0,1,0,13,0,2,0,0,9,0,0,1,0,13,0,2,0,0,9,0,0,1,0,13,0,2,0,0,0,0,0,1,0,13,0,2,0,0,0,0,0,1,0,13,0,2,0,0,0,1,
+		1,0,0,0,0,1,0,0,0,0,0,1,0,0,0,1,0,0,0,0,0,1,0,0,0,1,0,0,0,0,0,1,0,0,0,1,0,0,0,0,0,1,0,0,0,1,0,0,9,0,0,1,0,0,0,1,0,0,0,1,
+		1,1,1,1,1,1,0,0,0,0,0,1,1,1,1,1,0,0,0,0,0,1,1,1,1,1,0,0,0,0,0,1,1,1,1,1,0,0,0,0,0,1,1,1,1,1,0,0,0,0,0,1,1,1,1,1,0,0,0,1,
+		1,0,0,0,0,0,1,1,1,1,1,0,0,0,0,0,1,1,1,1,1,0,0,0,0,0,1,1,1,1,1,0,0,0,0,0,1,1,1,1,1,0,0,0,0,10,1,1,1,1,1,10,0,0,0,0,1,1,1,1,
+		1,0,0,0,0,0,1,0,0,0,1,0,0,0,0,0,1,0,0,0,1,0,0,0,0,0,1,0,0,0,1,0,12,1,12,0,1,0,0,0,1,0,7,0,0,0,1,0,0,0,1,0,0,0,7,0,1,0,0,1,
+		1,0,4,0,0,0,2,0,13,0,1,0,14,0,0,0,2,0,13,0,1,0,0,9,0,0,2,0,13,0,1,0,1,8,1,0,2,0,13,0,1,0,0,7,0,0,2,0,13,0,1,0,0,7,0,0,2,0,13,1,
+		1,0,0,0,0,0,1,0,0,0,1,0,0,0,0,0,1,0,0,0,1,0,0,0,0,0,1,0,0,0,1,0,12,1,12,0,1,0,0,0,1,0,0,0,7,0,1,0,0,0,1,0,7,0,0,0,1,0,0,1,
+		1,0,0,0,0,0,1,1,1,1,1,0,0,0,0,0,1,1,1,1,1,0,0,0,0,0,1,1,1,1,1,0,0,0,0,0,1,1,1,1,1,10,0,0,0,0,1,1,1,1,1,0,0,0,0,10,1,1,1,1,
+		1,1,1,1,1,1,0,0,0,0,0,1,1,1,1,1,0,0,0,0,0,1,1,1,1,1,0,0,0,0,0,1,1,1,1,1,0,0,0,0,0,1,1,1,1,1,0,0,0,0,0,1,1,1,1,1,0,0,0,1,
+		1,0,0,0,0,1,0,0,0,0,0,1,0,0,0,1,0,0,0,0,0,1,0,0,0,1,0,0,0,0,0,1,0,0,0,1,0,10,0,10,0,1,0,0,0,1,0,10,0,10,0,1,0,0,0,1,0,0,0,1,
+		1,0,0,13,0,2,0,15,0,0,0,1,0,13,0,2,0,0,0,0,0,1,0,13,0,2,0,0,0,0,0,1,0,13,0,2,0,0,0,0,0,1,0,13,0,2,0,0,10,0,0,1,0,13,0,2,0,0,0,1,
+		1,0,0,0,0,1,0,0,0,0,0,1,0,0,0,1,0,0,0,0,0,1,0,0,0,1,0,0,0,0,0,1,0,0,0,1,0,10,0,10,0,1,0,0,0,1,0,10,0,10,0,1,0,0,0,1,10,6,6,1,
+		1,1,1,1,1,1,0,0,0,0,0,1,1,1,1,1,0,0,0,0,0,1,1,1,1,1,0,0,0,0,0,1,1,1,1,1,0,0,0,0,0,1,1,1,1,1,0,0,0,0,0,1,1,1,1,1,0,0,0,1,
+		1,9,0,0,0,9,1,1,1,1,1,0,0,0,0,0,1,1,1,1,1,10,0,0,0,10,1,1,1,1,1,0,0,11,0,0,1,1,1,1,1,0,0,0,0,0,1,1,1,1,1,0,0,0,0,0,1,1,1,1,
+		1,0,0,14,0,0,1,0,0,0,1,0,0,0,0,0,1,0,0,0,1,0,0,0,0,0,1,0,0,0,1,0,0,0,0,0,1,0,0,0,1,0,0,0,7,0,1,0,0,0,1,0,7,0,0,0,1,0,0,1,
+		1,0,0,0,0,0,2,0,13,0,1,0,0,0,0,0,2,0,13,0,1,0,0,0,0,0,2,0,13,0,1,11,0,0,0,0,2,0,13,0,1,0,0,7,0,0,2,0,13,0,1,0,0,7,0,0,2,0,13,1,
+		1,0,0,0,0,0,1,0,0,0,1,0,0,0,0,9,1,0,0,0,1,0,0,0,0,0,1,0,0,0,1,0,0,0,0,0,1,0,0,0,1,0,7,0,0,0,1,0,0,0,1,0,0,0,7,0,1,0,0,1,
+		1,9,0,0,0,9,1,1,1,1,1,0,0,0,9,0,1,1,1,1,1,10,0,0,0,10,1,1,1,1,1,0,0,0,0,11,1,1,1,1,1,0,0,0,0,0,1,1,1,1,1,0,0,0,0,0,1,1,1,1,
+		1,1,1,1,1,1,0,0,0,0,0,1,1,1,1,1,0,0,0,0,0,1,1,1,1,1,0,0,0,0,0,1,1,1,1,1,0,0,10,0,0,1,1,1,1,1,0,0,0,0,0,1,1,1,1,1,0,0,0,1,
+		1,0,0,0,0,1,0,0,0,0,0,1,0,0,0,1,0,0,0,0,0,1,0,0,0,1,0,0,13,0,0,1,0,0,0,1,10,0,0,0,0,1,0,0,0,1,0,0,0,6,0,1,0,0,0,1,0,3,0,1,
+		1,0,0,13,0,2,0,0,0,0,6,1,0,13,0,2,9,0,0,0,6,1,0,13,0,2,0,0,0,0,5,1,0,13,0,2,0,0,10,0,0,1,0,13,0,2,10,0,0,6,0,1,0,13,0,2,0,0,0,1,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+	},
+	// level.n
+	{
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		1,0,0,1,1,1,1,0,5,1,13,0,1,1,1,1,13,0,1,14,0,0,14,1,14,0,0,14,1,1,0,0,1,1,0,0,0,0,0,0,1,1,1,0,1,1,0,13,0,0,13,0,1,0,0,0,0,0,0,1,
+		1,0,3,0,1,1,1,0,0,1,0,0,1,1,1,1,0,0,1,1,0,0,1,1,1,0,0,1,1,14,0,0,1,1,15,0,1,1,0,0,1,1,1,0,0,1,0,1,1,1,1,0,1,13,1,1,1,1,0,1,
+		1,0,0,0,0,1,1,0,0,1,0,0,1,1,1,1,0,0,1,1,0,0,1,1,1,0,0,1,1,1,0,0,1,1,1,1,1,0,0,0,1,1,1,1,0,1,0,1,1,1,1,0,1,1,1,1,1,1,0,1,
+		1,0,0,1,0,0,1,0,0,1,0,0,0,0,0,0,0,0,1,1,0,0,1,1,1,0,0,1,1,1,0,0,1,1,1,1,1,0,0,1,1,1,1,1,1,1,0,0,0,0,0,0,1,1,1,1,13,0,0,1,
+		1,0,0,1,1,0,0,0,0,1,0,0,0,0,0,0,0,0,1,1,0,0,1,1,1,0,0,1,1,1,0,0,1,1,1,1,0,0,0,1,1,1,1,1,1,1,0,1,1,1,1,0,1,1,1,1,1,1,0,1,
+		1,6,6,1,1,1,6,6,6,1,6,6,1,1,1,1,6,6,1,1,6,6,1,1,1,6,6,1,1,1,6,6,1,1,1,1,6,6,1,1,1,1,1,1,1,1,6,1,1,1,1,6,1,1,1,1,1,1,6,1,
+		1,7,7,1,1,1,1,7,7,1,7,7,1,1,1,1,7,7,1,1,7,7,1,1,1,7,7,1,1,1,7,7,1,1,1,1,7,7,1,1,1,1,1,1,1,1,7,1,1,1,1,7,1,7,1,1,1,1,7,1,
+		1,7,7,1,1,1,1,7,7,1,7,7,1,1,1,1,7,7,1,7,7,7,7,1,7,7,7,7,1,7,7,7,7,1,1,7,7,7,7,1,1,1,1,1,1,1,7,7,7,7,7,7,1,7,7,7,7,7,7,1,
+		1,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,
+		1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+		1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+		1,0,0,0,0,1,0,0,1,1,0,0,0,0,1,0,0,0,1,0,1,1,1,1,1,0,0,0,1,0,0,1,0,0,1,1,0,0,0,0,1,1,1,1,0,1,1,1,1,1,0,0,1,1,1,0,0,0,0,1,
+		1,0,0,0,0,1,0,1,0,0,1,0,0,0,1,1,0,1,1,0,0,0,1,0,0,0,0,0,1,9,9,1,0,1,9,9,1,0,0,0,1,0,9,0,0,0,0,1,0,0,0,1,0,10,0,1,0,0,0,1,
+		1,0,0,0,0,1,0,1,10,0,10,0,0,0,1,10,1,10,1,0,0,0,1,0,0,0,0,0,1,1,1,1,0,1,1,1,1,0,0,0,1,1,1,0,0,0,0,1,0,0,0,1,10,10,10,0,0,0,0,1,
+		1,0,1,0,0,1,0,1,0,1,1,0,0,0,1,0,0,0,1,0,0,0,1,0,0,0,0,0,1,0,0,1,0,1,0,0,1,0,0,0,1,0,9,0,0,0,0,1,0,0,0,1,10,10,10,0,0,0,0,1,
+		1,0,1,0,0,1,0,1,0,0,1,0,0,0,1,0,0,0,1,0,0,0,1,0,0,0,0,0,1,0,0,1,0,1,0,0,1,0,0,0,1,0,9,0,0,0,0,1,0,0,0,1,0,10,0,1,0,0,0,1,
+		1,0,0,1,1,0,8,0,1,1,0,8,0,0,1,0,0,0,1,6,0,0,1,0,6,0,0,0,1,0,0,1,7,1,0,0,1,7,0,0,1,1,1,1,0,0,0,1,0,0,0,0,1,1,1,0,0,5,0,1,
+		1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+		1,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,
+		1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+		1,0,1,1,1,1,0,0,1,1,1,1,0,0,1,1,1,1,0,0,1,1,1,1,1,1,1,1,0,0,7,7,7,7,7,7,7,0,0,1,1,1,1,1,1,1,0,0,1,1,0,0,1,1,0,0,1,1,0,1,
+		1,0,0,1,1,0,0,0,0,1,1,0,11,11,0,1,1,0,0,0,1,0,11,1,1,11,0,1,0,0,0,7,7,11,11,11,7,0,0,0,1,1,0,0,0,1,0,0,1,1,0,0,1,1,0,0,1,1,0,1,
+		1,0,0,1,1,0,11,11,0,1,1,11,0,0,11,1,1,0,0,0,0,11,0,1,1,0,11,0,0,0,0,7,7,11,7,11,0,0,0,0,1,1,0,0,0,1,0,0,1,1,0,0,1,1,0,0,1,1,0,1,
+		1,0,0,1,1,0,11,11,0,1,1,1,1,1,1,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,7,7,7,7,11,0,0,0,0,1,1,1,1,1,1,0,0,1,1,0,0,1,1,0,0,1,1,0,1,
+		1,0,0,1,1,0,11,11,0,1,1,12,0,0,12,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,7,7,11,7,11,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,1,1,0,0,1,1,0,1,
+		1,0,0,1,1,0,0,0,0,1,1,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,7,7,11,11,11,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,0,0,1,
+		1,0,1,1,1,1,0,0,1,1,1,1,0,0,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,7,7,7,7,0,0,0,0,0,1,1,1,1,0,0,0,0,0,1,1,0,0,1,1,0,0,1,1,0,1,
+		1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+	},
+	// level.o
+	{
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		1,1,1,0,0,0,11,1,1,1,1,1,1,0,0,0,0,1,1,1,1,1,1,0,0,0,0,1,1,1,1,1,1,0,0,0,0,1,1,1,1,1,1,0,0,0,0,1,1,1,1,1,1,12,0,0,12,1,1,1,
+		1,1,2,0,0,0,0,0,1,1,1,1,0,0,0,0,0,0,1,1,1,1,0,0,0,0,0,0,1,1,1,1,0,0,0,0,0,0,1,1,1,1,0,0,0,0,0,0,1,1,1,1,0,0,0,0,0,0,1,1,
+		1,4,2,0,7,7,0,0,0,0,0,0,0,0,7,7,0,0,0,0,0,0,0,0,7,7,0,0,0,1,1,0,0,0,7,7,0,0,0,1,1,0,0,0,7,7,0,0,0,0,0,0,0,0,7,7,0,0,8,1,
+		1,1,2,0,0,0,0,0,1,1,1,1,0,0,0,0,0,0,1,1,1,1,0,0,0,0,0,0,1,1,1,1,0,0,0,0,0,0,1,1,1,1,0,0,0,0,0,0,1,1,1,1,0,0,0,0,0,0,1,1,
+		1,1,1,0,0,0,11,1,1,1,1,1,1,0,0,0,0,1,1,1,1,1,1,0,0,0,0,1,1,1,1,1,1,0,0,0,0,1,1,1,1,1,1,0,0,0,0,1,1,1,1,1,1,12,0,0,12,1,1,1,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,1,1,1,1,1,1,1,1,0,0,1,1,1,1,1,1,1,1,0,0,1,1,1,1,1,1,1,1,0,0,1,1,1,1,1,1,1,1,0,0,1,1,1,1,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,1,1,1,1,1,1,1,1,0,0,1,1,1,1,1,1,1,1,0,0,1,1,1,1,1,1,1,1,0,0,1,1,1,1,1,1,1,1,0,0,1,1,1,1,
+		1,1,1,0,0,0,0,1,1,1,1,1,1,0,0,0,0,1,1,1,1,1,1,0,0,0,0,1,1,1,1,1,1,0,0,0,0,1,1,1,1,1,1,0,0,0,0,1,1,1,1,1,1,0,0,0,0,1,1,1,
+		1,1,0,0,0,0,0,0,1,1,1,1,0,0,0,0,0,0,1,1,1,1,0,0,0,0,0,0,1,1,1,1,0,0,0,0,0,0,1,1,1,1,0,0,0,0,0,0,1,1,1,1,0,0,0,0,0,0,1,1,
+		1,0,0,0,7,7,0,0,0,1,1,0,0,0,7,7,0,0,0,1,1,0,0,0,7,7,0,0,0,0,0,0,0,0,7,7,0,0,0,0,0,0,0,0,7,7,0,0,0,1,1,0,0,0,7,7,0,0,0,1,
+		1,1,0,0,0,0,0,0,1,1,1,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0,0,0,1,1,1,1,0,0,0,0,0,0,1,1,1,1,0,0,0,0,0,0,1,1,1,1,0,0,0,0,0,0,1,1,
+		1,1,1,0,0,0,0,1,1,1,0,0,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,1,1,9,1,1,1,0,0,0,0,1,1,1,1,1,1,0,0,0,0,1,1,1,1,1,1,0,0,0,0,1,1,1,
+		1,1,1,1,0,0,1,1,1,0,0,0,1,1,0,0,1,1,0,13,13,0,1,1,0,0,1,1,9,1,9,1,1,1,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		1,1,1,1,0,0,1,1,0,0,0,1,1,1,0,0,1,1,0,13,13,0,1,1,0,0,1,1,1,9,1,9,1,1,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		1,1,1,0,0,0,0,0,0,0,1,1,1,0,0,0,0,1,1,0,0,1,1,0,0,0,0,1,1,1,9,1,1,0,0,0,0,1,1,1,1,1,1,0,10,10,0,1,1,1,1,1,1,10,0,0,10,1,1,1,
+		1,1,0,0,0,0,0,0,0,1,1,1,0,0,0,0,0,0,1,0,0,1,0,0,0,0,0,0,1,9,0,1,0,0,0,0,0,0,1,1,1,1,0,0,0,0,0,0,1,1,1,1,10,0,0,0,0,10,1,1,
+		1,0,0,0,7,7,0,0,0,1,1,0,0,0,7,7,0,0,0,0,0,0,0,0,7,7,0,0,7,0,9,7,0,0,7,7,0,0,0,1,1,0,10,0,7,7,0,10,0,0,0,0,10,0,7,7,0,10,10,1,
+		1,1,0,0,0,0,0,0,1,1,1,1,0,0,0,0,0,0,1,1,1,1,0,0,0,0,0,0,1,9,0,1,0,0,0,0,0,0,1,1,1,1,0,0,0,0,0,0,1,1,1,1,0,0,0,0,0,0,1,1,
+		1,1,1,0,0,0,0,1,1,10,10,1,1,0,0,0,0,1,1,1,1,1,1,0,0,0,0,1,1,1,9,1,1,0,0,0,0,1,1,9,9,1,1,0,0,0,0,1,1,0,0,1,1,0,0,0,0,1,1,1,
+		1,1,1,1,0,0,1,1,10,10,1,10,1,1,0,0,1,1,1,1,1,1,1,1,0,0,1,1,1,9,1,9,1,1,0,0,1,1,9,9,9,9,1,1,0,0,1,1,0,9,9,0,1,1,0,0,1,1,1,1,
+		1,1,1,1,0,0,10,10,10,1,10,10,1,1,0,0,1,1,1,1,1,1,1,1,0,0,1,1,9,1,9,1,1,1,0,0,1,1,9,9,9,9,1,1,0,0,1,1,0,9,9,0,1,1,0,0,1,1,1,1,
+		1,1,1,0,0,0,0,1,1,10,10,1,1,0,0,0,0,1,1,1,1,1,1,0,0,0,0,1,1,9,1,1,1,0,0,0,0,1,1,9,9,1,1,0,0,0,0,1,1,0,0,1,1,0,0,0,0,1,1,1,
+		1,1,0,0,0,0,0,0,1,1,1,1,0,0,0,0,0,0,1,1,1,1,0,0,0,0,0,0,1,1,1,1,0,0,0,0,0,0,1,9,9,2,0,0,0,0,0,0,1,1,1,1,0,0,0,0,0,0,1,1,
+		1,0,0,0,7,7,0,0,0,0,0,0,0,0,7,7,0,0,0,0,0,0,0,0,7,7,0,0,0,1,1,0,0,0,7,7,0,0,2,2,2,2,0,0,7,7,0,0,0,0,0,0,0,0,7,7,0,3,0,1,
+		1,1,0,0,0,0,0,0,1,1,1,1,0,0,0,0,0,0,1,0,0,1,0,0,0,0,0,0,1,1,1,1,0,0,0,0,0,0,1,9,9,2,0,0,0,0,0,0,1,0,0,1,0,0,0,0,0,0,1,1,
+		1,1,1,0,0,0,0,1,1,1,1,1,1,0,0,0,0,1,1,0,0,1,1,0,0,0,0,1,1,1,1,1,1,0,0,0,0,1,1,9,9,1,1,0,0,0,0,1,1,0,0,1,1,0,0,0,0,1,1,1,
+		1,1,1,1,0,0,1,1,1,1,1,1,1,1,0,0,1,1,1,0,0,1,1,1,0,0,1,1,1,1,1,1,1,1,0,0,1,1,9,9,9,9,1,1,0,0,1,1,0,0,0,0,1,1,0,0,1,1,1,1,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,6,0,11,11,0,6,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,9,9,9,9,1,1,1,1,1,1,9,5,5,9,1,1,6,6,1,1,1,1,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+	},
+	// level.p
+	{
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		1,7,7,7,7,7,7,7,7,7,7,7,7,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+		1,7,7,1,1,7,7,7,7,7,7,7,1,7,0,0,0,0,0,0,7,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,
+		1,7,1,0,0,1,0,0,0,0,0,0,1,7,0,0,0,0,0,7,0,7,0,0,0,0,0,0,1,9,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,13,0,0,1,
+		1,7,7,0,0,1,0,0,3,0,0,1,7,7,0,0,0,0,0,0,7,0,0,0,0,0,0,0,1,9,1,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,1,0,0,0,0,1,
+		1,7,7,0,0,1,0,0,0,0,0,1,7,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,
+		1,7,7,0,1,1,1,0,1,1,0,1,1,7,1,1,0,0,0,0,0,0,1,1,1,0,0,0,1,1,1,1,0,0,0,1,0,0,1,0,0,0,0,0,1,0,0,1,1,0,0,0,0,0,1,0,0,0,0,1,
+		1,7,7,0,1,0,1,1,0,0,1,0,7,1,0,0,1,0,0,0,0,0,1,0,0,0,0,0,1,1,0,0,1,0,1,10,1,0,1,1,0,0,0,0,1,0,1,10,1,0,0,1,1,0,1,1,1,0,0,1,
+		1,7,7,0,1,0,0,0,1,0,1,0,7,1,0,9,1,1,0,0,0,1,0,9,9,9,0,1,1,0,9,1,1,0,1,10,1,0,1,10,1,0,0,1,1,0,1,10,1,0,1,0,0,0,1,0,0,1,0,1,
+		1,7,7,1,0,0,0,0,0,1,1,0,7,1,9,0,1,1,0,0,0,1,0,0,0,9,0,1,1,0,0,1,0,0,1,1,0,0,1,0,1,0,0,1,1,1,1,10,1,0,1,0,0,10,1,10,1,0,0,1,
+		1,7,7,1,7,7,7,7,7,7,1,7,7,1,0,0,1,0,1,0,0,1,1,0,0,0,1,0,1,0,0,0,1,0,1,0,0,1,0,10,1,0,0,1,1,0,1,10,1,1,1,0,0,0,1,0,1,1,0,1,
+		1,7,7,1,7,7,7,7,7,7,1,7,7,7,1,1,0,0,0,1,1,0,1,1,1,1,0,0,1,0,0,0,0,1,1,1,1,0,0,0,0,1,1,10,1,0,0,1,0,1,0,1,1,1,0,0,0,0,0,1,
+		1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+		1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,0,0,0,0,0,0,6,0,0,0,0,0,0,6,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+		1,7,7,1,7,7,1,1,1,7,7,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,0,0,0,0,0,0,7,0,7,0,0,0,0,0,0,1,1,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,
+		1,7,7,1,1,1,7,7,7,1,7,7,0,0,0,0,0,0,0,1,0,0,0,0,0,7,0,7,0,0,0,0,0,0,7,0,0,0,0,0,0,0,1,11,1,0,0,7,7,7,0,0,1,1,0,0,0,0,0,1,
+		1,7,1,1,0,0,0,0,0,0,1,7,0,0,0,0,0,0,1,0,1,0,0,0,0,0,7,0,0,0,0,0,0,7,0,7,0,0,0,0,0,0,1,1,0,0,0,7,0,7,0,0,1,1,0,0,0,0,0,1,
+		1,7,7,1,0,0,9,0,0,0,1,7,0,0,0,0,0,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,7,7,7,0,0,1,1,0,0,0,0,0,1,
+		1,7,7,1,0,0,0,9,0,1,7,7,0,0,0,0,0,0,1,9,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,1,
+		1,7,7,1,1,0,0,0,0,1,7,7,0,0,0,0,0,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,1,
+		1,7,7,1,0,1,1,1,1,0,7,7,0,0,0,0,0,0,1,1,0,0,0,0,1,1,0,0,0,0,1,1,0,0,0,1,1,0,0,0,1,0,0,0,0,0,0,1,1,0,0,0,1,0,0,0,0,0,0,1,
+		1,7,7,1,0,0,0,0,0,0,7,1,1,1,1,0,0,0,1,1,0,0,0,1,0,0,1,0,0,1,0,0,1,0,0,0,1,1,1,1,1,0,0,0,0,0,1,0,0,1,0,0,1,0,1,1,0,0,0,1,
+		1,7,7,1,0,0,9,0,0,0,1,7,0,9,1,0,0,0,1,1,0,0,0,1,0,9,1,0,0,1,0,0,1,0,10,0,1,0,0,0,1,0,0,0,0,1,0,0,0,0,0,0,1,1,0,0,1,0,0,1,
+		1,7,1,0,0,0,0,0,0,0,1,7,0,0,1,0,0,0,1,1,0,0,0,1,0,0,1,0,0,1,0,0,1,0,10,0,1,0,0,0,1,0,0,0,0,1,10,10,10,0,0,0,1,1,0,10,1,0,0,1,
+		1,7,1,0,0,9,0,9,0,0,1,7,9,1,0,1,0,0,1,1,0,0,0,1,9,1,0,0,0,1,0,0,1,0,10,0,1,0,0,0,1,0,0,0,0,1,0,0,0,0,0,1,1,0,0,0,1,0,0,1,
+		1,7,1,0,0,0,0,0,0,0,1,7,0,1,0,1,0,0,1,0,1,1,0,1,1,0,0,0,1,0,0,0,1,0,0,0,1,0,0,0,1,0,0,0,1,0,1,0,0,1,1,0,1,10,10,0,1,0,0,1,
+		1,7,1,7,7,7,7,7,7,7,7,1,1,0,0,0,1,1,0,0,0,0,1,1,0,1,1,1,0,0,0,0,0,1,1,1,0,0,0,0,0,1,1,1,0,0,0,1,1,0,0,0,1,0,0,0,0,1,0,1,
+		1,7,7,7,7,7,7,7,7,7,7,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+		1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,12,0,0,0,0,0,0,0,0,0,0,0,0,0,12,0,0,0,0,0,0,0,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,1,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+	},
+	// level.q
+	{
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		1,6,0,0,0,1,11,0,0,1,0,0,0,0,0,1,0,0,0,1,0,0,0,0,7,1,0,0,0,1,0,0,9,0,0,1,0,0,0,1,0,7,0,0,0,1,0,0,0,1,0,0,7,0,0,1,0,0,6,1,
+		1,9,0,0,0,0,0,0,7,0,1,0,10,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,10,0,1,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,
+		1,0,0,0,1,1,1,0,0,0,1,0,0,0,1,1,1,0,0,10,1,0,0,0,1,1,1,0,0,0,1,0,0,0,1,1,1,0,11,0,1,0,0,0,1,1,1,0,9,0,1,0,0,0,1,1,1,0,0,1,
+		1,0,0,1,0,0,0,1,0,0,0,0,0,1,0,0,0,1,0,0,0,0,0,1,0,0,12,1,0,0,0,0,0,1,0,0,0,1,0,0,0,0,0,1,0,7,0,1,0,0,0,0,0,1,0,0,0,1,0,1,
+		1,0,0,0,0,9,0,1,0,0,1,0,0,0,0,7,0,1,0,0,1,0,0,0,0,0,0,1,0,0,1,0,7,0,0,0,0,1,0,10,1,0,0,0,0,0,0,1,0,0,1,0,0,0,0,0,0,1,0,1,
+		1,0,0,7,0,0,1,0,0,0,0,0,9,0,0,0,1,0,0,0,0,0,0,9,0,0,1,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,1,0,0,10,0,0,0,0,0,0,1,0,0,1,
+		1,1,0,0,0,1,0,0,0,1,1,1,0,0,0,1,0,0,0,1,1,1,0,0,0,1,0,0,0,1,1,1,0,0,0,1,0,0,0,1,1,1,0,0,0,1,0,0,0,1,1,1,0,0,0,1,0,0,0,1,
+		1,10,1,0,0,1,0,0,1,0,0,0,1,0,0,1,0,0,1,0,0,0,1,0,0,1,0,0,1,0,0,10,1,0,0,1,0,0,1,0,0,0,1,0,0,1,0,0,1,0,0,0,1,0,0,1,0,0,1,1,
+		1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,11,1,0,0,0,0,0,0,0,0,0,1,0,9,0,0,0,0,0,0,11,1,0,0,0,0,0,0,0,0,0,1,1,
+		1,0,0,0,0,1,0,0,0,1,0,0,0,9,0,1,0,0,0,1,0,10,0,0,0,1,0,0,0,1,0,0,0,0,0,1,0,0,0,1,0,0,7,0,0,4,0,0,0,1,0,0,0,9,0,1,0,0,0,1,
+		1,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,10,0,0,1,0,7,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,7,1,
+		1,0,0,0,1,1,1,0,0,0,1,0,0,0,1,1,1,0,0,0,1,0,0,0,1,1,1,0,0,0,1,0,0,0,1,1,1,0,0,0,1,0,0,0,1,1,1,0,0,0,1,0,0,0,1,1,1,0,0,1,
+		1,0,0,1,7,0,0,1,0,0,0,0,0,1,0,0,0,1,0,0,0,0,0,1,0,0,0,1,0,0,0,0,0,1,0,0,0,1,0,0,0,0,0,1,0,0,0,1,0,0,0,0,0,1,0,0,0,1,0,1,
+		1,0,0,0,0,9,0,1,0,0,1,0,0,0,0,0,0,1,0,0,1,0,0,0,0,0,0,1,0,0,1,0,9,0,0,0,0,1,0,0,1,0,0,0,0,0,0,1,0,0,1,0,0,0,0,0,10,1,0,1,
+		1,0,0,0,0,0,1,0,0,0,0,0,0,9,0,0,1,0,0,0,0,0,0,0,9,0,1,0,0,0,0,0,0,7,7,0,1,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,1,0,0,1,
+		1,1,0,0,0,1,0,0,0,1,1,1,0,0,0,1,0,0,0,1,1,1,0,0,0,1,0,0,0,1,1,1,0,0,0,1,0,0,0,1,1,1,0,0,0,1,0,0,0,1,1,1,0,0,0,1,0,9,0,1,
+		1,0,1,0,0,1,0,0,1,0,0,0,1,0,0,1,0,0,1,0,7,0,1,0,0,1,0,0,1,0,0,0,1,0,0,1,0,0,1,0,9,0,1,0,0,1,0,0,1,0,0,0,1,0,0,1,0,0,1,1,
+		1,0,0,0,0,0,0,0,1,0,0,7,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,7,1,0,0,0,0,0,0,0,0,11,1,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,1,1,
+		1,0,0,7,0,1,0,0,0,1,0,0,0,0,0,3,0,0,0,1,0,9,0,11,0,1,0,0,0,1,0,0,0,0,0,1,0,0,0,1,0,0,7,7,0,1,0,0,0,1,0,7,0,0,0,1,7,0,11,1,
+		1,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,1,0,0,0,11,0,0,0,0,0,1,0,10,0,0,0,0,9,0,0,1,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,
+		1,0,0,0,1,1,1,0,0,0,1,0,0,0,1,1,1,0,0,0,1,0,0,0,1,1,1,0,0,0,1,0,0,0,1,1,1,0,0,0,1,0,0,0,1,1,1,0,0,0,1,0,0,0,1,1,1,0,0,1,
+		1,0,0,1,0,0,0,1,0,0,0,0,0,1,0,0,0,1,0,0,0,0,0,1,0,10,0,1,0,0,0,0,0,1,0,0,0,1,0,0,0,0,0,1,0,10,0,1,9,0,0,0,0,1,0,0,0,1,0,1,
+		1,0,0,0,0,9,0,1,0,0,1,0,0,0,0,0,0,1,0,0,1,0,0,0,0,0,0,1,0,0,1,0,0,0,0,0,0,1,0,0,1,0,0,0,0,0,0,1,0,0,1,7,0,0,0,11,0,1,10,1,
+		1,0,0,0,0,0,1,0,0,0,0,7,0,0,9,0,1,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,9,0,1,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,1,0,0,1,
+		1,1,0,0,0,1,0,0,0,1,1,1,0,0,0,1,0,0,0,1,1,1,0,0,0,1,0,0,0,1,1,1,0,0,0,1,0,0,0,1,1,1,0,0,0,1,0,11,0,1,1,1,0,0,0,1,0,9,0,1,
+		1,0,1,0,0,1,0,0,1,0,0,0,1,0,0,1,0,0,1,0,0,0,1,0,0,1,0,0,1,0,9,0,1,0,0,1,0,0,1,0,0,0,1,0,0,1,0,0,1,0,0,0,1,0,0,1,0,0,1,1,
+		1,0,0,11,0,0,0,0,1,0,0,7,0,0,0,0,0,0,1,9,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,1,0,0,0,10,0,0,0,0,0,1,1,
+		1,6,7,0,0,1,0,10,0,1,0,0,0,7,0,1,10,0,0,1,0,0,0,11,0,1,0,0,0,1,0,0,0,0,0,1,0,0,0,1,11,11,0,0,0,1,0,0,0,1,0,0,0,0,0,1,7,7,7,1,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+	},
+	// level.r
+	{
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		1,0,0,0,0,0,9,9,9,9,9,0,0,0,0,0,1,0,0,0,0,6,6,5,1,1,5,6,6,0,0,0,2,2,0,0,0,9,0,0,0,0,0,0,0,0,0,9,0,0,13,0,0,9,0,0,0,0,0,1,
+		1,0,0,0,0,0,9,9,9,9,9,0,0,0,0,0,1,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,2,2,0,0,9,7,9,0,0,0,0,0,0,0,9,7,9,0,0,0,9,7,9,0,0,13,0,1,
+		1,0,0,0,0,1,1,1,1,1,1,1,1,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,2,0,9,1,7,1,9,0,0,13,0,0,9,1,7,1,9,0,9,1,7,1,9,0,0,0,1,
+		1,0,0,0,0,1,0,0,0,0,0,11,11,1,0,0,1,0,0,0,0,0,0,1,1,1,1,0,0,0,0,0,2,2,9,7,7,7,7,7,9,0,0,0,9,7,7,7,7,7,10,7,7,7,7,7,9,0,0,1,
+		1,0,0,0,0,1,0,0,0,0,0,11,11,1,0,0,1,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,2,2,0,9,1,7,1,7,1,9,0,9,1,7,1,7,1,9,7,9,1,7,1,7,1,9,0,1,
+		1,0,0,0,0,1,0,0,1,1,1,11,11,1,0,0,1,0,0,0,0,0,0,1,1,1,1,0,0,0,0,0,2,2,0,0,9,7,7,7,7,7,10,7,7,7,7,7,9,7,7,7,9,7,7,7,7,7,9,1,
+		1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,2,0,0,0,9,1,7,1,9,7,9,1,7,1,9,1,1,7,1,1,9,1,7,1,9,0,1,
+		1,0,0,0,0,1,0,0,1,0,0,8,0,1,0,0,1,0,0,0,0,1,0,0,1,1,0,0,1,0,0,0,2,2,0,0,0,0,9,7,9,1,7,1,9,7,9,7,1,1,7,1,1,7,9,7,9,0,0,1,
+		1,0,0,0,0,1,0,0,1,0,8,0,8,1,0,0,1,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,2,2,0,0,0,0,0,10,7,7,7,7,7,10,7,7,7,7,7,7,7,7,7,10,0,0,0,1,
+		1,0,0,0,0,1,0,0,1,0,0,8,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,2,0,0,0,0,9,7,9,1,7,1,9,7,9,7,1,1,7,1,1,7,9,7,9,0,0,1,
+		1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,0,1,0,0,0,0,1,0,0,0,0,2,2,0,0,0,9,1,7,1,9,7,9,1,7,1,9,1,1,7,1,1,9,1,7,1,9,0,1,
+		1,0,0,0,0,1,10,10,1,1,1,1,1,1,0,0,1,0,0,0,0,0,1,0,0,0,0,1,0,0,0,0,2,2,0,0,9,7,7,7,7,7,10,7,7,7,7,7,9,7,7,7,9,7,7,7,7,7,9,1,
+		1,0,0,0,0,1,10,10,0,0,0,0,0,0,0,0,1,0,0,0,0,0,1,0,0,0,0,1,0,0,0,0,2,2,0,9,1,7,1,7,1,9,0,9,1,7,1,7,1,9,7,9,1,7,1,7,1,9,0,1,
+		1,0,0,0,0,1,10,10,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,2,9,7,7,7,7,7,9,0,0,0,9,7,7,7,7,7,10,7,7,7,7,7,9,0,0,1,
+		1,2,2,2,2,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,2,2,0,9,1,7,1,9,0,0,13,0,0,9,1,7,1,9,0,9,1,7,1,9,0,0,0,1,
+		1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,2,0,0,9,7,9,0,0,0,0,0,0,0,9,7,9,0,0,0,9,7,9,0,0,13,0,1,
+		1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,12,12,0,0,0,0,0,0,2,2,0,0,0,9,0,0,0,0,0,0,0,0,0,9,0,0,13,0,0,9,0,0,0,0,0,1,
+		1,0,0,0,0,0,0,0,1,1,0,1,1,0,0,0,0,0,0,0,0,0,0,0,12,12,0,0,0,0,0,0,2,2,0,0,1,1,1,0,0,1,1,1,0,0,1,1,1,0,0,1,1,1,0,0,0,0,0,1,
+		1,0,0,0,0,0,0,0,1,0,0,0,1,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,1,1,0,0,2,2,0,0,1,1,1,0,0,1,1,1,0,0,1,1,1,0,0,1,1,1,0,0,1,1,0,1,
+		1,0,0,0,0,0,0,0,0,0,3,0,0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0,1,1,0,0,2,2,0,0,1,1,1,0,0,1,1,1,0,0,1,1,1,0,0,1,1,1,0,0,1,4,0,1,
+		1,0,0,0,0,0,0,0,1,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+		1,0,0,0,0,0,0,0,1,1,0,1,1,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,2,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+		1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0,0,2,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+		1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,2,2,0,0,0,0,14,0,0,0,0,0,0,0,15,0,15,0,0,0,0,0,0,0,0,0,0,1,
+		1,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,0,1,1,0,0,0,0,0,0,2,2,0,0,0,14,8,14,0,0,0,0,0,0,0,8,0,0,0,0,0,0,0,0,0,0,0,1,
+		1,0,0,9,9,9,9,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,1,1,0,0,0,0,0,0,2,2,0,0,0,0,14,0,0,0,0,0,0,0,15,0,15,0,0,0,0,0,0,0,0,0,0,1,
+		1,9,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,1,1,0,0,0,0,1,1,0,0,0,0,0,0,2,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+		1,5,0,0,0,0,9,9,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,2,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+	},
+	// level.s
+	{
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,1,0,0,0,1,
+		1,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,1,0,0,0,1,
+		1,0,1,1,0,0,0,0,0,9,0,0,0,0,0,9,0,0,0,0,0,9,0,0,0,0,0,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,9,1,
+		1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,9,0,1,
+		1,0,0,0,0,0,0,0,0,0,0,0,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,9,0,0,1,
+		1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,1,
+		1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,9,0,0,0,9,0,0,0,1,1,0,0,0,0,1,1,1,1,1,1,1,1,0,0,0,0,0,0,1,1,1,1,0,0,0,1,0,0,0,1,
+		1,0,0,0,0,0,0,0,1,1,1,0,0,0,1,1,1,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,0,0,0,1,
+		1,0,0,0,0,0,0,0,0,1,1,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,1,1,0,0,1,1,1,1,0,0,0,0,0,1,0,0,9,1,
+		1,0,0,0,0,0,0,1,1,1,0,0,0,0,1,1,0,0,0,0,0,1,1,0,0,0,0,0,0,1,0,1,1,0,7,0,9,0,9,0,0,0,1,1,1,1,1,1,1,0,0,0,0,0,0,1,0,9,0,1,
+		1,0,0,0,0,0,0,1,1,0,0,0,0,0,1,1,1,0,0,0,0,1,1,0,0,0,0,0,0,0,0,1,0,0,0,0,0,9,0,0,0,0,0,0,1,1,1,1,0,0,0,0,0,0,0,1,9,0,0,1,
+		1,0,0,1,0,0,0,1,1,0,1,1,0,0,0,1,1,0,0,1,1,1,1,0,0,0,0,0,0,0,0,1,0,0,0,0,9,0,9,0,0,0,0,0,1,1,1,1,0,0,0,0,0,0,0,1,0,0,0,1,
+		1,0,0,1,1,0,0,1,1,0,1,1,0,0,1,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,0,0,0,0,0,0,1,0,0,0,1,
+		1,0,0,0,1,1,0,0,1,0,0,1,1,0,1,1,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,1,1,0,0,1,1,1,1,0,0,0,0,0,1,0,0,0,1,
+		1,0,0,0,0,1,1,0,1,0,0,1,1,0,1,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,1,0,0,0,0,1,1,1,1,0,0,0,0,1,0,0,0,1,
+		1,0,0,0,0,0,1,1,1,0,0,1,1,12,1,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,1,0,0,9,1,
+		1,0,0,0,0,0,0,1,1,0,4,1,1,1,1,0,0,0,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,9,0,1,
+		1,0,0,0,0,0,0,1,1,1,1,1,1,1,0,0,0,1,1,1,1,12,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,9,0,0,1,
+		1,0,0,0,0,0,0,0,0,1,1,1,1,1,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,1,7,0,0,1,
+		1,0,0,0,0,0,0,0,0,0,1,1,1,1,0,0,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,1,0,0,0,0,0,0,0,0,7,0,0,0,1,
+		1,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,1,0,0,0,0,0,0,0,0,0,7,0,0,0,1,
+		1,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,0,0,0,0,0,10,0,0,0,1,0,1,0,0,0,0,0,0,0,0,0,0,7,0,0,0,1,
+		1,0,0,0,1,11,1,1,11,0,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,7,0,0,1,
+		1,0,0,0,11,1,6,6,1,0,0,0,0,0,1,1,1,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,1,0,0,0,0,0,0,1,0,0,7,0,7,0,0,1,0,0,0,0,0,7,0,0,7,0,0,1,
+		1,0,0,0,1,11,1,1,11,0,0,0,0,0,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,1,10,1,0,0,0,0,0,0,0,1,0,1,1,0,1,1,0,1,0,0,0,0,0,0,7,7,0,0,0,1,
+		1,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,0,0,0,0,0,0,0,0,0,1,1,10,10,10,1,1,0,0,0,0,1,1,1,1,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,1,
+		1,0,0,0,7,7,7,7,7,0,0,0,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,1,1,10,1,1,0,0,0,0,0,0,1,0,1,1,0,1,1,0,1,0,0,0,0,0,0,0,0,0,3,0,1,
+		1,0,0,0,7,7,7,7,7,0,0,1,1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,1,1,0,1,0,1,1,0,0,0,0,1,0,1,0,0,0,0,0,1,0,1,0,0,0,0,0,0,0,0,0,0,1,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+	},
+	// level.t
+	{
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		1,1,1,6,1,1,1,1,1,1,6,6,1,1,1,12,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+		1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,14,0,0,0,0,0,0,1,0,14,0,0,0,0,0,0,1,
+		1,0,1,1,1,1,1,1,0,0,1,1,1,1,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,
+		1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,1,
+		1,0,1,1,1,1,1,1,1,1,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,
+		1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,14,0,1,0,0,0,0,0,0,14,0,1,
+		1,0,0,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+		1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,1,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		1,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,3,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+		1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,0,0,0,0,0,0,0,0,1,
+		1,0,0,0,0,1,1,1,1,1,1,1,1,1,0,0,0,1,1,1,1,1,1,1,1,1,1,1,0,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,1,1,1,1,1,1,1,0,0,0,0,0,0,0,1,
+		1,0,0,0,0,0,1,1,7,0,7,0,0,0,1,0,1,1,0,10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,0,1,1,0,1,1,1,1,9,9,1,1,1,0,0,0,0,0,0,1,
+		1,0,0,0,0,0,0,0,1,1,0,0,14,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,1,1,1,9,9,9,9,1,1,0,0,0,0,0,0,1,
+		1,0,0,0,0,0,0,0,0,0,1,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,9,9,9,1,1,0,0,0,0,0,0,1,
+		1,0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,0,7,0,0,1,0,0,0,9,9,1,1,0,0,0,0,0,0,1,
+		1,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,7,0,0,1,0,7,7,0,9,1,1,0,0,0,0,0,0,1,
+		1,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,1,0,0,0,0,0,0,0,1,1,0,0,0,0,1,0,0,0,0,0,1,1,0,0,0,0,0,0,1,
+		1,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,1,0,0,0,0,1,1,1,0,0,0,0,0,0,1,
+		1,0,0,1,0,0,0,0,0,0,1,0,0,0,1,1,0,0,0,1,1,0,0,0,0,0,0,1,0,14,0,1,0,0,0,0,0,0,0,0,0,1,0,0,0,1,0,0,0,0,1,1,0,0,0,7,0,0,0,1,
+		1,0,0,1,7,7,7,7,7,7,1,1,1,0,0,1,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,1,1,0,0,0,7,7,7,0,0,1,
+		1,0,0,1,7,7,7,7,7,7,1,0,1,0,0,1,1,0,0,0,1,1,0,0,0,0,0,1,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,7,0,0,0,1,
+		1,0,0,1,7,7,7,7,7,7,1,1,1,0,0,0,1,0,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,1,
+		1,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,7,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+		1,0,0,1,0,0,0,0,0,0,1,0,0,14,0,0,0,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,7,7,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+		1,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,1,1,9,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,7,1,1,7,0,0,0,0,0,0,1,1,10,10,1,1,0,1,
+		1,0,0,1,0,14,12,12,14,0,1,0,0,0,0,1,1,9,9,9,9,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,7,1,1,0,0,0,0,0,0,1,10,0,0,10,1,0,1,
+		1,0,0,1,0,0,0,0,0,0,1,0,0,0,1,1,1,1,9,9,9,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,0,1,1,1,1,0,0,0,0,0,1,1,10,10,1,1,0,1,
+		1,4,0,1,1,1,1,1,1,1,1,0,0,0,0,1,1,9,9,9,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+	},
+	// level.u
+	{
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		1,5,0,7,7,7,7,7,0,7,7,7,7,7,0,7,7,7,7,7,0,7,1,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		1,0,13,0,7,7,7,0,13,0,7,7,7,0,13,0,7,7,7,0,13,0,1,0,3,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		1,7,0,7,7,0,7,7,0,7,7,0,7,7,0,7,7,0,7,7,0,7,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,0,9,0,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+		1,7,7,7,0,13,0,7,7,7,0,13,0,7,7,7,0,13,0,7,7,7,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,0,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+		1,7,0,7,7,0,7,7,0,7,7,0,7,7,0,7,7,0,7,7,0,7,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,1,1,1,1,1,1,1,1,1,1,1,9,9,1,
+		1,0,13,0,7,7,7,0,13,0,7,7,7,0,13,0,7,7,7,0,13,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,1,1,1,1,1,1,1,1,1,1,1,9,9,1,
+		1,7,0,7,7,0,7,7,0,7,7,0,7,7,0,7,7,0,7,7,0,7,1,10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,9,1,
+		1,7,7,7,0,13,0,7,7,7,0,13,0,7,7,7,0,13,0,7,7,7,1,0,10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,9,1,
+		1,7,0,7,7,0,7,7,0,7,7,0,7,7,0,7,7,0,7,7,0,7,1,10,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		1,0,13,0,7,7,7,0,13,0,7,7,7,0,13,0,7,7,7,0,13,0,1,0,10,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,5,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		1,7,0,7,7,7,7,7,0,7,7,7,7,7,0,7,7,7,7,7,0,7,7,10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,2,1,1,0,0,0,0,0,0,0,0,0,0,10,1,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,0,1,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,1,1,1,1,1,1,1,1,1,1,1,0,10,1,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,1,1,1,1,1,1,1,1,1,1,1,10,0,1,
+		1,0,11,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,1,
+		1,11,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,0,1,
+		1,0,11,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		1,11,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		1,0,11,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,11,0,1,
+		1,11,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,11,1,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,1,1,1,1,1,1,1,1,1,1,1,11,0,1,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,1,1,1,1,1,1,1,1,1,1,1,0,11,1,
+		1,12,0,14,0,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,11,0,1,
+		1,0,0,0,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,11,1,
+		1,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		1,0,6,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,1,1,1,1,1,1,1,1,1,1,0,0,0,1,
+		1,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,1,
+		1,0,14,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+	},
+	// level.v
+	{
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		1,4,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,10,1,0,1,10,1,0,1,10,1,0,1,10,1,0,1,10,1,0,1,10,1,0,1,10,1,0,1,10,1,0,1,12,1,11,1,0,1,12,1,9,1,
+		1,0,1,0,15,0,1,0,1,0,1,0,14,0,1,0,1,0,1,10,1,0,1,10,1,0,1,10,1,0,1,10,1,0,1,10,1,0,1,10,1,0,1,10,1,0,1,10,1,0,1,0,1,0,13,0,1,12,1,1,
+		1,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,10,1,0,1,10,1,0,1,10,1,0,1,10,1,0,1,10,1,0,1,10,1,0,1,10,1,0,1,10,1,0,1,0,1,0,1,0,1,12,1,
+		1,0,15,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,10,1,0,1,0,1,0,1,0,1,1,
+		1,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,9,1,0,1,9,1,0,1,9,1,0,1,9,1,0,1,9,1,0,1,9,1,0,1,9,1,0,1,9,1,0,1,9,1,0,1,0,1,0,13,0,1,
+		1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,1,
+		1,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,11,1,
+		1,0,14,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,9,1,0,1,9,1,0,1,9,1,0,1,9,1,0,1,9,1,0,1,9,1,0,1,0,1,11,1,0,1,0,1,0,1,11,1,0,1,0,1,1,
+		1,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,9,0,0,0,0,0,0,0,0,0,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,12,1,
+		1,10,1,0,1,0,1,0,1,10,1,0,1,9,1,0,1,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,1,0,1,0,1,0,1,11,1,0,1,0,1,0,1,0,1,1,
+		1,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,11,1,
+		1,10,1,0,1,10,1,0,1,10,1,0,1,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,11,1,0,1,0,1,0,1,11,1,0,1,11,1,1,
+		1,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,
+		1,10,1,0,1,10,1,0,1,0,1,0,1,0,1,0,1,9,0,0,0,0,0,0,0,0,0,0,6,0,6,0,0,0,0,0,0,0,0,0,0,9,1,0,1,0,1,0,1,11,1,0,1,0,1,0,1,0,1,1,
+		1,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,9,0,0,0,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,0,0,0,9,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,11,1,
+		1,10,1,0,1,10,1,0,1,10,1,0,1,9,1,0,1,0,0,0,0,0,0,0,0,0,0,0,6,0,6,0,0,0,0,0,0,0,0,0,0,0,1,0,1,11,1,0,1,0,1,0,1,11,1,0,1,11,1,1,
+		1,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,
+		1,10,1,0,1,10,1,0,1,10,1,0,1,0,1,0,1,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,1,0,1,0,1,0,1,11,1,0,1,0,1,0,1,0,1,1,
+		1,1,10,1,10,1,0,1,0,1,0,1,0,1,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,11,1,
+		1,10,1,0,1,0,1,10,1,0,1,0,1,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,11,1,0,1,0,1,0,1,11,1,0,1,11,1,1,
+		1,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,0,0,0,0,0,0,0,0,0,9,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,
+		1,10,1,0,1,0,1,0,1,10,1,0,1,9,1,0,1,9,1,0,1,9,1,0,1,9,1,0,1,9,1,0,1,9,1,0,1,9,1,0,1,9,1,0,1,0,1,0,1,11,1,0,1,0,1,0,1,0,1,1,
+		1,1,10,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,11,1,
+		1,6,1,10,1,0,1,0,1,0,1,10,1,9,1,0,1,9,1,0,1,9,1,0,1,9,1,0,1,9,1,0,1,9,1,0,1,9,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,11,1,1,
+		1,1,6,1,10,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,11,1,8,1,
+		1,6,1,6,1,10,1,0,1,0,1,10,1,0,1,10,1,0,1,10,1,0,1,10,1,0,1,10,1,0,1,10,1,0,1,10,1,0,1,10,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,11,1,8,1,1,
+		1,1,6,1,6,1,10,1,0,1,0,1,0,1,0,1,10,1,0,1,10,1,0,1,10,1,0,1,10,1,0,1,10,1,0,1,10,1,0,1,10,1,0,1,0,1,0,1,0,1,0,1,0,1,11,1,8,1,7,1,
+		1,6,1,6,1,6,1,10,1,10,1,10,1,10,1,0,1,10,1,0,1,10,1,0,1,10,1,0,1,10,1,0,1,10,1,0,1,10,1,0,1,10,1,0,1,0,1,11,1,11,1,11,1,11,1,8,1,7,1,1,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+	},
+	// level.w
+	{
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		1,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,1,
+		1,0,0,0,0,0,0,0,11,11,0,0,0,0,0,0,0,0,0,0,11,0,0,0,0,0,11,11,0,0,0,0,0,7,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,11,0,1,
+		1,0,0,0,0,0,0,0,11,11,0,0,0,1,1,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,7,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+		1,7,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,1,0,1,1,1,0,1,0,0,0,1,1,1,0,0,0,0,7,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+		1,7,7,0,0,0,0,0,0,0,0,0,0,1,0,11,0,1,0,1,0,1,0,1,0,0,0,1,0,1,0,11,0,0,7,0,1,0,0,0,0,0,0,0,0,0,0,10,10,10,10,10,0,0,0,0,0,0,0,1,
+		1,0,7,7,7,7,0,0,0,11,0,0,0,1,0,0,0,1,0,1,1,1,0,0,1,1,0,1,1,1,0,0,0,0,7,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+		1,0,0,0,0,7,7,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,7,0,1,0,0,0,0,0,9,9,9,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+		1,0,0,0,0,0,7,7,7,7,7,7,7,7,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+		1,0,0,0,0,0,0,0,0,0,0,0,0,0,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,7,0,0,0,0,0,0,9,0,0,1,1,1,1,1,0,0,0,1,1,1,0,0,0,0,1,
+		1,0,0,0,0,0,0,0,0,0,0,0,0,0,7,7,7,7,7,7,7,7,7,0,0,0,0,0,1,1,1,1,0,7,0,0,0,0,0,0,0,9,0,0,0,1,0,0,0,1,0,1,0,0,0,1,0,0,0,1,
+		1,0,10,10,10,10,10,10,10,0,0,0,0,0,0,0,0,0,0,0,0,0,7,7,0,0,0,1,1,0,0,1,7,7,0,0,0,0,0,0,9,0,0,0,0,1,1,0,0,1,0,1,0,13,0,0,0,0,0,1,
+		1,0,10,0,0,0,0,0,10,10,10,0,0,0,0,0,0,0,0,0,0,0,0,7,7,7,1,1,0,0,7,7,7,1,0,0,0,0,0,0,0,0,0,0,0,1,0,1,1,0,0,1,0,0,1,1,0,0,0,1,
+		1,0,10,10,10,10,10,10,10,10,10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,7,0,0,12,7,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,1,0,0,0,1,0,0,0,1,
+		1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,0,0,0,7,7,0,7,12,0,0,0,1,1,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,1,1,0,0,0,0,1,
+		1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,7,7,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+		1,0,0,0,1,0,0,1,0,0,0,0,0,1,0,0,0,1,0,0,0,0,0,10,0,0,0,0,7,7,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,0,0,0,1,
+		1,0,0,0,1,1,13,1,0,0,0,0,0,1,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,7,7,1,1,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,1,0,0,0,1,
+		1,0,0,0,1,13,1,1,0,1,1,1,0,0,1,0,1,0,0,0,1,1,0,0,0,0,0,0,0,7,7,1,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,0,0,0,1,
+		1,0,0,0,1,0,0,1,0,1,0,1,0,0,1,13,1,0,0,1,0,1,0,0,0,0,0,0,0,7,7,0,0,0,0,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+		1,0,0,0,1,0,0,1,0,1,1,1,0,0,0,1,0,0,0,1,1,1,1,0,0,0,0,0,0,7,7,0,0,0,0,1,1,0,0,0,0,1,1,0,0,0,1,1,0,0,0,0,10,10,10,0,0,0,0,1,
+		1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,0,0,0,7,7,0,0,0,0,1,0,1,0,0,0,1,0,1,13,1,0,0,0,0,0,0,0,0,10,0,0,0,0,1,
+		1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,0,0,0,7,7,7,0,0,0,0,0,0,1,0,0,1,1,0,0,0,1,1,0,0,0,0,0,0,10,0,0,0,0,1,
+		1,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,10,10,0,0,0,0,7,7,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,1,
+		1,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,10,10,0,0,0,0,7,7,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,0,0,0,0,10,0,0,0,0,0,1,
+		1,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,10,10,10,0,0,0,7,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,10,10,10,0,0,1,
+		1,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,10,10,10,0,0,0,7,7,7,0,0,0,10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+		1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,7,7,0,0,0,10,10,0,0,0,0,0,0,10,10,0,0,0,0,0,0,0,0,0,0,0,0,1,
+		1,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,1,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+	},
+	// level.x
+	{
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,1,0,1,1,
+		1,0,0,0,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,0,0,10,0,0,0,10,0,0,9,0,1,
+		1,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,9,0,0,0,0,0,0,0,1,1,0,0,0,1,1,0,0,0,0,0,0,0,0,1,0,1,0,1,0,1,1,
+		1,0,9,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,1,0,0,1,0,0,0,0,0,0,0,0,10,0,0,0,9,0,1,
+		1,0,0,0,0,0,0,1,0,0,1,0,0,0,0,0,0,1,0,0,1,0,0,0,0,0,0,9,0,0,9,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,10,0,0,1,0,1,0,1,0,1,1,
+		1,0,0,0,9,0,0,1,0,15,0,1,1,1,1,1,1,0,15,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,12,0,12,0,0,0,0,0,0,0,0,0,10,0,0,0,0,10,0,0,1,
+		1,0,0,0,0,0,0,1,0,7,1,0,0,0,0,0,0,1,7,0,1,0,0,0,0,0,0,0,9,9,0,0,0,0,0,0,0,0,0,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+		1,0,9,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,1,0,1,1,0,0,0,0,0,0,0,10,0,0,10,0,0,0,0,1,
+		1,0,0,0,10,0,0,0,1,0,0,7,7,0,0,7,7,0,0,1,0,0,10,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,1,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+		1,0,0,10,0,10,0,0,1,0,0,0,0,0,0,0,0,0,0,1,0,10,0,10,0,0,0,0,0,0,0,1,1,0,1,0,0,0,0,0,1,0,0,0,0,0,1,0,1,1,0,0,0,0,0,0,0,0,0,1,
+		1,0,0,10,0,10,0,0,1,0,0,9,0,6,6,0,9,0,0,1,0,10,0,10,0,0,0,0,0,0,1,0,0,1,0,0,0,6,0,0,1,0,0,6,0,0,0,1,0,0,1,0,0,0,1,0,0,0,0,1,
+		1,0,0,0,10,0,0,0,1,0,0,0,0,6,6,0,0,0,0,1,0,0,10,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,11,0,1,0,11,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,1,
+		1,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,0,6,0,0,11,1,11,0,0,6,0,0,1,1,1,0,0,0,0,1,1,0,0,0,1,
+		1,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,0,0,0,11,0,1,0,11,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,1,
+		1,0,0,0,0,0,0,0,0,0,1,1,1,0,0,1,1,1,0,0,0,0,11,11,0,0,0,0,0,0,0,0,0,1,0,0,0,6,0,0,1,0,0,6,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,1,
+		1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,11,0,0,11,0,0,0,0,0,0,1,1,1,0,0,0,0,0,0,1,0,0,0,0,0,0,1,1,1,0,0,0,0,0,1,0,0,0,1,
+		1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,11,11,0,0,0,0,0,0,1,0,0,0,1,1,0,0,0,0,0,0,0,0,0,1,1,0,0,0,1,0,0,0,0,1,0,0,0,1,
+		1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,1,1,1,1,0,0,0,0,0,0,0,0,0,1,1,0,0,0,1,
+		1,1,1,0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,9,0,1,
+		1,0,0,0,0,0,0,1,1,1,1,1,1,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,9,0,9,1,
+		1,0,0,0,0,0,1,1,0,0,0,0,0,0,1,0,1,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,9,0,9,1,
+		1,0,0,0,0,0,0,1,1,1,1,1,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,9,9,9,9,0,0,0,0,9,9,0,0,0,0,0,0,9,0,9,1,
+		1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,9,9,9,9,0,0,0,0,9,9,0,0,0,1,0,0,0,9,0,1,
+		1,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,7,7,7,7,7,7,7,7,7,7,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,0,0,0,1,0,0,1,0,0,0,0,0,1,
+		1,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,7,7,7,7,7,7,7,7,7,7,7,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,1,0,0,1,1,0,1,0,0,0,0,0,1,
+		1,1,9,9,9,9,9,1,0,0,0,0,1,0,1,1,0,1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,1,0,1,1,0,0,0,0,1,
+		1,1,9,9,9,9,9,1,0,0,1,1,0,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,1,0,1,0,0,1,1,0,0,0,1,
+		1,1,1,1,1,1,1,1,0,0,1,0,0,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,1,0,0,0,0,1,0,0,0,1,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+	},
+	// level.y
+	{
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,12,15,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+		1,0,3,0,0,0,1,1,1,1,1,1,1,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,0,0,0,0,0,0,0,12,0,0,0,0,0,1,1,0,0,1,0,0,0,1,0,0,0,1,
+		1,0,0,0,0,0,1,0,0,1,0,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,12,1,0,1,12,1,0,0,1,
+		1,0,0,0,0,0,0,0,0,1,0,0,0,0,0,1,0,1,1,0,0,0,0,1,1,9,0,0,0,1,0,9,0,0,0,1,9,1,1,1,9,0,0,0,1,1,9,1,0,0,1,12,1,9,1,12,1,0,0,1,
+		1,0,0,0,0,0,0,0,0,1,0,0,0,0,0,1,1,0,0,1,0,0,1,6,6,1,0,0,0,1,1,1,0,0,0,0,1,6,6,6,1,0,0,1,6,6,1,1,0,0,0,1,0,9,0,1,0,0,0,1,
+		1,0,0,0,0,0,0,0,0,1,0,0,0,0,0,1,0,0,0,1,0,0,1,1,1,1,0,0,0,1,0,9,0,0,0,0,1,6,0,6,1,0,0,1,6,6,6,1,0,0,0,1,0,9,9,1,0,0,0,1,
+		1,8,8,8,0,0,0,0,0,1,0,0,0,0,0,1,0,0,0,1,0,0,1,9,9,9,0,0,0,1,0,0,0,1,0,0,1,6,0,6,1,0,0,1,6,6,6,1,0,0,0,0,0,0,9,0,0,0,0,1,
+		1,8,8,8,0,0,0,0,1,1,1,0,0,0,1,1,0,0,0,1,1,0,0,1,1,1,0,0,0,1,1,1,1,1,0,1,1,6,0,6,1,1,0,0,1,1,1,1,1,0,0,1,0,0,0,1,0,0,0,1,
+		1,8,8,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,1,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,11,1,
+		1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,0,0,10,10,0,0,0,10,10,0,0,0,0,0,10,10,0,0,0,0,0,0,10,10,0,0,0,0,0,10,10,0,0,0,0,0,0,10,1,
+		1,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,0,0,0,0,0,0,7,0,0,0,0,0,0,0,0,0,0,0,1,
+		1,10,9,10,10,6,7,0,0,10,0,7,0,11,0,0,10,10,0,0,10,0,0,0,10,10,0,0,6,6,0,0,0,0,0,0,6,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,0,1,
+		1,0,9,7,13,0,0,0,13,0,0,0,13,0,0,0,13,0,0,13,0,0,0,13,0,0,6,13,0,0,0,13,0,0,0,13,0,0,13,0,7,0,13,7,0,10,10,0,13,0,0,0,13,0,0,13,0,0,0,1,
+		1,9,9,0,7,0,7,7,0,0,0,7,7,0,0,7,7,0,0,7,7,0,0,0,7,0,0,0,7,7,7,0,0,0,10,0,0,0,0,0,0,7,0,0,0,0,10,0,0,0,0,0,0,0,0,0,0,0,0,1,
+		1,0,0,0,0,0,0,0,11,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,0,0,0,0,10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,0,0,0,0,7,0,0,0,1,
+		1,0,13,0,13,11,0,13,13,0,0,13,0,0,0,13,0,0,0,13,7,0,0,13,0,0,0,13,0,0,13,0,7,0,13,10,0,0,13,0,0,0,13,0,0,13,0,0,13,0,0,0,13,0,0,13,0,0,0,1,
+		1,0,0,0,0,0,0,0,0,7,7,0,7,7,0,0,0,7,0,0,7,0,0,0,0,0,6,0,0,0,6,0,0,10,10,10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,0,0,0,0,0,0,0,0,1,
+		1,0,0,0,0,11,0,0,0,0,0,0,0,0,0,0,0,7,0,0,8,0,6,6,0,0,6,0,7,0,6,6,0,0,0,0,0,0,0,7,0,0,0,7,7,0,0,0,0,0,0,10,0,0,0,0,0,0,0,1,
+		1,0,0,0,7,0,0,7,7,0,0,6,0,7,0,0,0,11,0,0,0,0,6,0,0,0,0,0,0,0,0,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,0,0,0,0,0,0,0,1,
+		1,0,14,0,0,0,14,14,0,0,7,6,6,7,0,0,0,0,14,14,0,0,0,14,14,0,0,0,14,14,0,0,7,7,0,0,0,14,14,0,0,7,0,14,0,0,0,0,0,0,14,14,0,0,0,0,14,0,0,1,
+		1,0,0,0,0,0,0,0,0,0,0,0,0,0,11,0,7,7,0,0,0,7,0,0,0,7,0,6,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,0,0,0,0,0,0,0,0,0,0,1,
+		1,0,0,0,0,0,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,0,0,0,0,0,0,0,0,7,0,0,0,8,0,0,0,0,0,1,
+		1,7,0,15,15,0,0,0,0,15,0,0,0,0,15,15,0,0,0,0,15,15,0,7,7,15,0,0,15,15,0,0,15,15,0,0,0,15,0,0,15,15,15,0,0,15,0,0,0,15,15,15,0,15,15,0,0,15,0,1,
+		1,0,0,0,0,0,0,0,0,0,0,11,0,0,0,0,0,10,10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,0,0,0,10,10,7,0,0,0,0,0,10,10,0,0,0,0,0,0,0,1,
+		1,0,0,0,0,0,7,0,0,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,6,0,0,0,6,6,0,0,10,0,0,0,0,10,0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,1,
+		1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,10,0,10,10,10,10,10,0,0,0,0,0,0,0,10,0,0,0,0,0,0,0,0,10,10,0,0,0,0,0,0,0,0,0,0,1,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+	},
+	// level.z
+	{
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+		1,7,0,12,12,7,7,12,12,7,12,12,12,12,7,7,7,12,12,7,7,12,12,7,7,12,12,7,12,12,12,12,7,12,7,7,12,12,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,1,
+		1,0,3,0,12,7,7,12,7,7,12,7,7,12,7,7,12,7,7,12,7,7,12,7,7,12,7,7,12,7,7,12,7,12,12,7,7,12,7,7,7,7,7,7,7,7,7,7,7,9,7,9,7,9,7,9,7,9,7,1,
+		1,7,0,7,12,12,12,12,7,7,12,12,7,7,7,7,12,12,12,12,7,7,12,7,7,12,7,7,12,12,7,7,7,12,7,12,7,12,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,1,
+		1,7,7,7,12,7,7,12,7,7,12,7,7,12,7,7,12,7,7,12,7,7,7,12,12,7,7,7,12,7,7,12,7,12,7,7,12,12,7,7,7,7,7,7,7,7,7,7,7,9,7,9,7,9,7,9,7,9,7,1,
+		1,7,7,12,12,7,7,12,12,7,12,12,12,12,7,12,12,7,7,12,12,7,7,12,12,7,7,7,12,12,12,12,7,12,12,7,7,12,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,1,
+		1,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,9,7,9,7,9,7,9,7,9,7,1,
+		1,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,1,
+		1,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,9,7,9,7,9,7,9,7,9,7,1,
+		1,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,1,
+		1,5,2,5,2,5,2,5,2,5,2,5,2,5,2,5,2,5,2,5,2,5,2,5,2,5,2,5,2,5,2,5,2,5,2,5,2,5,2,5,2,5,2,5,2,5,2,5,2,5,2,5,2,5,2,5,2,5,2,1,
+		1,2,5,2,5,2,5,2,5,2,5,2,5,2,5,2,5,2,5,2,5,2,5,2,5,2,5,2,5,2,5,2,5,2,5,2,5,2,5,2,5,2,5,2,5,2,5,2,5,2,5,2,5,2,5,2,5,2,5,1,
+		1,5,2,5,2,5,2,5,2,5,2,5,2,5,2,5,2,5,2,5,2,5,2,5,2,5,2,5,2,5,2,5,2,5,2,5,2,5,2,5,2,5,2,5,2,5,2,5,2,5,2,5,2,5,2,5,2,5,2,1,
+		1,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,1,
+		1,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,6,7,7,7,7,7,7,7,7,6,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,1,
+		1,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,6,6,6,6,6,6,6,6,6,6,6,6,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,1,
+		1,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,6,7,11,7,11,7,11,7,11,6,7,7,7,7,7,7,7,7,7,7,7,7,10,10,10,10,10,7,7,7,7,7,7,7,7,1,
+		1,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,6,11,7,11,6,6,7,11,7,6,7,7,7,7,7,7,7,7,7,7,7,10,10,10,10,10,10,10,7,7,7,7,7,7,7,1,
+		1,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,6,7,11,7,6,6,11,7,11,6,7,7,7,7,7,7,7,7,7,7,10,10,7,7,7,7,7,10,10,7,7,7,7,7,7,1,
+		1,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,6,11,7,11,7,11,7,11,7,6,7,7,7,7,7,7,7,7,7,7,10,7,7,10,7,10,7,7,10,7,7,7,7,7,7,1,
+		1,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,6,6,6,6,6,6,6,6,6,6,6,6,7,7,7,7,7,7,7,7,7,10,7,7,7,7,7,7,7,10,7,7,7,7,7,7,1,
+		1,8,8,8,8,8,8,8,8,8,8,7,7,7,7,7,7,7,7,7,7,7,7,7,6,7,7,7,7,7,7,7,7,6,7,7,7,7,7,7,7,7,7,7,10,7,10,10,7,10,10,7,10,7,7,7,7,7,7,1,
+		1,8,15,15,15,15,15,15,15,15,8,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,10,7,7,10,10,10,7,7,10,7,7,7,7,7,7,1,
+		1,8,15,14,14,14,14,14,14,15,8,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,10,7,7,7,7,7,10,7,7,7,7,7,7,7,1,
+		1,8,15,14,13,13,13,13,14,15,8,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,10,10,10,10,10,7,7,7,7,7,7,7,7,1,
+		1,8,15,14,13,13,13,13,14,15,8,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,1,
+		1,8,15,14,14,14,14,14,14,15,8,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,1,
+		1,8,15,15,15,15,15,15,15,15,8,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,4,7,1,
+		1,8,8,8,8,8,8,8,8,8,8,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,1,
+		1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+	},
+};
+
+// The monsters and generators of every level, each level's in row-major order
+static const LevelEntity kEmbeddedEntities[2704] =
+{
+	{14,1,9}, {16,1,9}, {33,1,9}, {34,1,9}, {35,1,9}, {36,1,9}, {37,1,9}, {38,1,9}, {55,1,9}, {56,1,9}, {57,1,9}, {58,1,9},
+	{2,2,10}, {13,2,9}, {15,2,9}, {26,4,9}, {54,4,13}, {6,5,10}, {8,5,10}, {10,5,10}, {12,5,10}, {14,5,10}, {16,5,10}, {18,5,10},
+	{26,5,9}, {26,6,9}, {6,7,10}, {8,7,10}, {10,7,10}, {12,7,10}, {14,7,10}, {16,7,10}, {18,7,10}, {6,9,10}, {8,9,10}, {10,9,10},
+	{12,9,10}, {14,9,10}, {16,9,10}, {18,9,10}, {50,10,9}, {52,10,9}, {6,11,10}, {8,11,10}, {10,11,10}, {12,11,10}, {14,11,10}, {16,11,10},
+	{18,11,10}, {49,11,9}, {51,11,9}, {6,13,10}, {8,13,10}, {10,13,10}, {12,13,10}, {14,13,10}, {16,13,10}, {18,13,10}, {50,13,9}, {24,14,9},
+	{28,14,9}, {21,16,10}, {13,17,11}, {50,20,9}, {50,21,9}, {45,27,11}, {26,28,9}, {30,28,9}, {35,28,10}, {36,28,10}, {37,28,10}, {38,28,10},
+	{44,28,11}, {27,1,9}, {30,1,9}, {42,1,9}, {46,1,9}, {40,5,9}, {48,5,9}, {50,5,9}, {6,6,9}, {7,6,9}, {7,7,9}, {53,7,9},
+	{12,9,10}, {14,9,10}, {42,9,9}, {44,9,9}, {13,10,10}, {15,10,10}, {12,15,11}, {13,15,11}, {14,15,11}, {51,15,9}, {12,16,11}, {13,16,11},
+	{14,16,11}, {42,16,9}, {12,17,11}, {13,17,11}, {49,17,9}, {46,20,9}, {30,21,10}, {32,21,10}, {51,21,9}, {44,22,9}, {6,23,9}, {7,23,9},
+	{8,23,9}, {9,23,9}, {10,23,9}, {11,23,9}, {12,23,9}, {13,23,9}, {29,23,10}, {31,23,10}, {33,23,10}, {46,24,9}, {30,25,10}, {32,25,10},
+	{42,26,9}, {49,27,9}, {23,1,9}, {24,1,9}, {25,1,9}, {26,1,9}, {27,1,9}, {28,1,9}, {29,1,9}, {30,1,9}, {31,1,9}, {32,1,9},
+	{33,1,9}, {34,1,9}, {35,1,9}, {36,1,9}, {37,1,9}, {38,1,9}, {39,1,9}, {18,2,13}, {23,2,9}, {24,2,9}, {25,2,9}, {26,2,9},
+	{27,2,9}, {28,2,9}, {29,2,9}, {30,2,9}, {31,2,9}, {32,2,9}, {33,2,9}, {34,2,9}, {35,2,9}, {36,2,9}, {37,2,9}, {38,2,9},
+	{39,2,9}, {15,7,13}, {23,7,9}, {24,7,9}, {25,7,9}, {26,7,9}, {27,7,9}, {28,7,9}, {29,7,9}, {30,7,9}, {31,7,9}, {32,7,9},
+	{33,7,9}, {34,7,9}, {35,7,9}, {36,7,9}, {37,7,9}, {38,7,9}, {39,7,9}, {41,7,10}, {42,7,10}, {43,7,10}, {44,7,10}, {45,7,10},
+	{46,7,10}, {47,7,10}, {53,7,10}, {54,7,10}, {55,7,10}, {56,7,10}, {57,7,10}, {58,7,10}, {23,8,9}, {24,8,9}, {25,8,9}, {26,8,9},
+	{27,8,9}, {28,8,9}, {29,8,9}, {30,8,9}, {31,8,9}, {32,8,9}, {33,8,9}, {34,8,9}, {35,8,9}, {36,8,9}, {37,8,9}, {38,8,9},
+	{39,8,9}, {41,8,10}, {42,8,10}, {43,8,10}, {44,8,10}, {45,8,10}, {46,8,10}, {54,8,10}, {55,8,10}, {56,8,10}, {57,8,10}, {58,8,10},
+	{29,10,9}, {30,10,9}, {31,10,9}, {9,13,14}, {11,13,14}, {25,13,9}, {35,13,9}, {24,14,9}, {25,14,9}, {35,14,9}, {36,14,9}, {25,15,9},
+	{35,15,9}, {41,17,9}, {42,17,9}, {43,17,9}, {44,17,9}, {45,17,9}, {46,17,9}, {47,17,9}, {53,17,9}, {54,17,9}, {55,17,9}, {56,17,9},
+	{57,17,9}, {58,17,9}, {29,18,9}, {30,18,9}, {31,18,9}, {41,18,9}, {42,18,9}, {43,18,9}, {44,18,9}, {45,18,9}, {46,18,9}, {47,18,9},
+	{53,18,9}, {54,18,9}, {55,18,9}, {56,18,9}, {57,18,9}, {58,18,9}, {26,20,10}, {27,20,10}, {33,20,10}, {34,20,10}, {41,20,11}, {42,20,11},
+	{43,20,11}, {44,20,11}, {26,21,10}, {27,21,10}, {33,21,10}, {34,21,10}, {41,21,11}, {42,21,11}, {43,21,11}, {44,21,11}, {16,22,15}, {41,27,11},
+	{42,27,11}, {43,27,11}, {44,27,11}, {41,28,11}, {42,28,11}, {43,28,11}, {44,28,11}, {14,1,9}, {16,1,9}, {33,1,9}, {34,1,9}, {35,1,9},
+	{36,1,9}, {37,1,9}, {38,1,9}, {55,1,9}, {56,1,9}, {57,1,9}, {58,1,9}, {2,2,10}, {13,2,9}, {15,2,9}, {26,4,9}, {54,4,13},
+	{6,5,10}, {8,5,10}, {10,5,10}, {12,5,10}, {14,5,10}, {16,5,10}, {18,5,10}, {26,5,9}, {26,6,9}, {6,7,10}, {8,7,10}, {10,7,10},
+	{12,7,10}, {14,7,10}, {16,7,10}, {18,7,10}, {6,9,10}, {8,9,10}, {10,9,10}, {12,9,10}, {14,9,10}, {16,9,10}, {18,9,10}, {50,10,9},
+	{52,10,9}, {6,11,10}, {8,11,10}, {10,11,10}, {12,11,10}, {14,11,10}, {16,11,10}, {18,11,10}, {49,11,9}, {51,11,9}, {6,13,10}, {8,13,10},
+	{10,13,10}, {12,13,10}, {14,13,10}, {16,13,10}, {18,13,10}, {50,13,9}, {24,14,9}, {28,14,9}, {21,16,10}, {13,17,11}, {50,20,9}, {50,21,9},
+	{45,27,11}, {26,28,9}, {30,28,9}, {35,28,10}, {36,28,10}, {37,28,10}, {38,28,10}, {44,28,11}, {3,2,10}, {5,2,9}, {11,2,11}, {13,2,10},
+	{19,2,9}, {21,2,11}, {27,2,10}, {29,2,9}, {35,2,11}, {37,2,10}, {43,2,11}, {45,2,9}, {51,2,10}, {53,2,9}, {58,2,11}, {2,3,10},
+	{6,3,9}, {10,3,11}, {14,3,10}, {18,3,9}, {22,3,11}, {26,3,10}, {30,3,9}, {34,3,11}, {38,3,10}, {42,3,11}, {46,3,9}, {50,3,10},
+	{54,3,9}, {58,3,11}, {1,4,10}, {7,4,9}, {9,4,11}, {15,4,10}, {17,4,9}, {23,4,11}, {25,4,10}, {31,4,9}, {33,4,11}, {39,4,10},
+	{41,4,11}, {47,4,9}, {49,4,10}, {55,4,9}, {57,4,11}, {1,6,10}, {7,6,11}, {9,6,9}, {15,6,10}, {17,6,11}, {23,6,10}, {25,6,11},
+	{31,6,9}, {33,6,11}, {39,6,9}, {41,6,11}, {47,6,10}, {49,6,11}, {55,6,9}, {57,6,10}, {2,7,10}, {6,7,11}, {10,7,9}, {14,7,10},
+	{18,7,11}, {22,7,10}, {26,7,11}, {30,7,9}, {34,7,11}, {38,7,9}, {42,7,11}, {46,7,10}, {50,7,11}, {54,7,9}, {58,7,10}, {3,8,10},
+	{5,8,11}, {11,8,9}, {13,8,10}, {19,8,11}, {21,8,10}, {27,8,11}, {29,8,9}, {35,8,11}, {37,8,9}, {43,8,11}, {45,8,10}, {51,8,11},
+	{53,8,9}, {58,8,10}, {3,10,9}, {5,10,9}, {11,10,11}, {13,10,10}, {19,10,10}, {21,10,9}, {27,10,11}, {29,10,10}, {35,10,9}, {37,10,10},
+	{43,10,10}, {45,10,9}, {51,10,9}, {53,10,10}, {58,10,11}, {2,11,9}, {6,11,9}, {10,11,11}, {14,11,10}, {18,11,10}, {22,11,9}, {26,11,11},
+	{30,11,10}, {34,11,9}, {38,11,10}, {42,11,10}, {46,11,9}, {50,11,9}, {54,11,10}, {58,11,11}, {1,12,9}, {7,12,9}, {9,12,11}, {15,12,10},
+	{17,12,10}, {23,12,9}, {25,12,11}, {31,12,10}, {33,12,9}, {39,12,10}, {41,12,10}, {47,12,9}, {49,12,9}, {55,12,10}, {57,12,11}, {1,14,11},
+	{7,14,10}, {9,14,9}, {15,14,10}, {17,14,11}, {23,14,9}, {25,14,10}, {31,14,9}, {33,14,10}, {39,14,11}, {41,14,9}, {47,14,9}, {49,14,11},
+	{55,14,9}, {57,14,9}, {2,15,11}, {6,15,10}, {10,15,9}, {14,15,10}, {18,15,11}, {22,15,9}, {26,15,10}, {30,15,9}, {34,15,10}, {38,15,11},
+	{42,15,9}, {46,15,9}, {50,15,11}, {54,15,9}, {58,15,9}, {3,16,11}, {5,16,10}, {11,16,9}, {13,16,10}, {19,16,11}, {21,16,9}, {27,16,10},
+	{29,16,9}, {35,16,10}, {37,16,11}, {43,16,9}, {45,16,9}, {51,16,11}, {53,16,9}, {58,16,9}, {3,18,10}, {5,18,11}, {11,18,11}, {13,18,9},
+	{19,18,10}, {21,18,9}, {35,18,9}, {37,18,10}, {43,18,10}, {45,18,11}, {51,18,9}, {53,18,11}, {58,18,10}, {2,19,10}, {6,19,11}, {10,19,11},
+	{14,19,9}, {18,19,10}, {22,19,9}, {34,19,9}, {38,19,10}, {42,19,10}, {46,19,11}, {50,19,9}, {54,19,11}, {58,19,10}, {1,20,10}, {7,20,11},
+	{9,20,11}, {15,20,9}, {17,20,10}, {23,20,9}, {33,20,9}, {39,20,10}, {41,20,10}, {47,20,11}, {49,20,9}, {55,20,11}, {57,20,10}, {1,22,9},
+	{7,22,9}, {9,22,10}, {15,22,9}, {17,22,11}, {23,22,10}, {25,22,9}, {31,22,10}, {33,22,9}, {39,22,11}, {41,22,10}, {47,22,11}, {49,22,10},
+	{55,22,9}, {57,22,10}, {2,23,9}, {6,23,9}, {10,23,10}, {14,23,9}, {18,23,11}, {22,23,10}, {26,23,9}, {30,23,10}, {34,23,9}, {38,23,11},
+	{42,23,10}, {46,23,11}, {50,23,10}, {54,23,9}, {58,23,10}, {3,24,9}, {5,24,9}, {11,24,10}, {13,24,9}, {19,24,11}, {21,24,10}, {27,24,9},
+	{29,24,10}, {35,24,9}, {37,24,11}, {43,24,10}, {45,24,11}, {51,24,10}, {53,24,9}, {58,24,10}, {3,26,11}, {5,26,10}, {11,26,10}, {13,26,11},
+	{19,26,10}, {21,26,9}, {27,26,11}, {29,26,10}, {35,26,9}, {37,26,11}, {43,26,10}, {45,26,9}, {51,26,9}, {53,26,10}, {58,26,11}, {2,27,11},
+	{6,27,10}, {10,27,10}, {14,27,11}, {18,27,10}, {22,27,9}, {26,27,11}, {30,27,10}, {34,27,9}, {38,27,11}, {42,27,10}, {46,27,9}, {50,27,9},
+	{54,27,10}, {58,27,11}, {1,28,11}, {7,28,10}, {9,28,10}, {15,28,11}, {17,28,10}, {23,28,9}, {25,28,11}, {31,28,10}, {33,28,9}, {39,28,11},
+	{41,28,10}, {47,28,9}, {49,28,9}, {55,28,10}, {57,28,11}, {12,1,11}, {13,1,11}, {28,1,9}, {29,1,9}, {30,1,9}, {35,1,10}, {36,1,10},
+	{37,1,10}, {38,1,10}, {39,1,10}, {54,1,9}, {55,1,9}, {56,1,9}, {57,1,9}, {1,2,10}, {3,2,10}, {5,2,10}, {7,2,10}, {22,2,9},
+	{23,2,9}, {27,2,9}, {28,2,9}, {29,2,9}, {30,2,9}, {39,2,10}, {53,2,9}, {54,2,9}, {21,3,9}, {22,3,9}, {24,3,9}, {26,3,9},
+	{27,3,9}, {39,3,10}, {48,3,9}, {52,3,9}, {2,4,10}, {4,4,10}, {6,4,10}, {20,4,9}, {21,4,9}, {39,4,10}, {47,4,9}, {51,4,9},
+	{52,4,9}, {12,5,9}, {14,5,9}, {16,5,9}, {20,5,9}, {39,5,10}, {44,5,9}, {47,5,9}, {1,6,10}, {4,6,15}, {7,6,10}, {10,6,9},
+	{13,6,14}, {20,6,9}, {27,6,15}, {39,6,10}, {44,6,9}, {45,6,9}, {46,6,9}, {47,6,9}, {18,7,9}, {19,7,9}, {20,7,9}, {39,7,10},
+	{18,8,9}, {19,8,9}, {19,9,9}, {20,9,9}, {27,9,10}, {28,9,10}, {33,9,10}, {34,9,10}, {38,9,10}, {39,9,10}, {44,9,10}, {45,9,10},
+	{50,9,10}, {51,9,10}, {58,9,10}, {20,10,15}, {27,10,10}, {29,10,10}, {32,10,10}, {34,10,10}, {35,10,10}, {37,10,10}, {38,10,10}, {39,10,10},
+	{40,10,10}, {43,10,10}, {45,10,10}, {46,10,10}, {49,10,10}, {50,10,10}, {51,10,10}, {52,10,10}, {55,10,10}, {56,10,10}, {57,10,10}, {58,10,10},
+	{28,11,10}, {29,11,10}, {30,11,10}, {31,11,10}, {35,11,10}, {36,11,10}, {37,11,10}, {40,11,10}, {41,11,10}, {42,11,10}, {46,11,10}, {47,11,10},
+	{48,11,10}, {49,11,10}, {52,11,10}, {53,11,10}, {54,11,10}, {55,11,10}, {58,11,10}, {2,12,9}, {4,12,9}, {6,12,9}, {1,13,9}, {3,13,9},
+	{5,13,9}, {17,13,10}, {23,13,10}, {24,13,10}, {28,13,10}, {29,13,10}, {36,13,10}, {37,13,10}, {43,13,10}, {45,13,10}, {46,13,10}, {54,13,10},
+	{55,13,10}, {56,13,10}, {2,14,9}, {4,14,9}, {6,14,9}, {15,14,10}, {17,14,10}, {18,14,10}, {22,14,10}, {23,14,10}, {25,14,10}, {28,14,10},
+	{31,14,10}, {32,14,10}, {35,14,10}, {36,14,10}, {38,14,10}, {41,14,10}, {42,14,10}, {43,14,10}, {45,14,10}, {46,14,10}, {47,14,10}, {50,14,10},
+	{51,14,10}, {52,14,10}, {56,14,10}, {57,14,10}, {58,14,10}, {1,15,9}, {3,15,9}, {5,15,9}, {15,15,10}, {18,15,10}, {19,15,10}, {21,15,10},
+	{22,15,10}, {26,15,10}, {31,15,10}, {33,15,10}, {34,15,10}, {35,15,10}, {38,15,10}, {40,15,10}, {42,15,10}, {43,15,10}, {45,15,10}, {47,15,10},
+	{48,15,10}, {49,15,10}, {50,15,10}, {53,15,10}, {55,15,10}, {56,15,10}, {58,15,10}, {8,16,10}, {9,16,10}, {10,16,10}, {11,16,10}, {12,16,10},
+	{13,16,10}, {19,16,10}, {20,16,10}, {21,16,10}, {22,16,10}, {27,16,10}, {31,16,10}, {32,16,10}, {34,16,10}, {38,16,10}, {39,16,10}, {43,16,10},
+	{44,16,10}, {48,16,10}, {49,16,10}, {53,16,10}, {54,16,10}, {55,16,10}, {56,16,10}, {57,16,10}, {58,16,10}, {15,17,10}, {19,17,10}, {20,17,10},
+	{22,17,10}, {24,17,10}, {25,17,10}, {26,17,10}, {28,17,10}, {29,17,10}, {15,18,10}, {17,18,10}, {18,18,10}, {19,18,10}, {22,18,10}, {23,18,10},
+	{24,18,10}, {26,18,10}, {27,18,10}, {28,18,10}, {29,18,10}, {30,18,10}, {33,18,10}, {22,19,10}, {23,19,10}, {26,19,10}, {27,19,10}, {31,19,10},
+	{32,19,10}, {33,19,10}, {53,20,11}, {54,20,11}, {55,20,11}, {7,21,9}, {52,21,11}, {56,21,11}, {7,22,9}, {38,22,15}, {56,22,11}, {7,23,9},
+	{56,23,11}, {55,24,11}, {1,25,9}, {2,25,9}, {3,25,9}, {4,25,9}, {5,25,9}, {10,25,13}, {15,25,9}, {16,25,9}, {17,25,9}, {18,25,9},
+	{19,25,9}, {20,25,9}, {23,25,9}, {24,25,9}, {34,25,11}, {54,25,11}, {1,26,9}, {5,26,9}, {12,26,13}, {14,26,9}, {15,26,9}, {19,26,9},
+	{20,26,9}, {24,26,9}, {25,26,9}, {26,26,9}, {27,26,9}, {28,26,9}, {54,26,11}, {1,27,9}, {2,27,9}, {10,27,13}, {15,27,9}, {16,27,9},
+	{34,27,11}, {2,28,9}, {3,28,9}, {15,28,9}, {16,28,9}, {34,28,11}, {8,1,9}, {8,2,9}, {8,3,9}, {13,3,9}, {15,3,9}, {17,3,9},
+	{25,3,9}, {34,3,9}, {35,3,9}, {36,3,9}, {38,3,9}, {43,3,9}, {44,3,9}, {45,3,9}, {46,3,9}, {53,3,9}, {54,3,9}, {55,3,9},
+	{56,3,9}, {8,4,9}, {1,5,9}, {2,5,9}, {3,5,9}, {4,5,9}, {5,5,9}, {6,5,9}, {7,5,9}, {8,5,9}, {35,10,10}, {36,10,10},
+	{37,10,10}, {43,10,9}, {44,10,9}, {45,10,9}, {47,10,9}, {48,10,9}, {54,10,9}, {55,10,9}, {56,10,9}, {21,15,13}, {29,15,13}, {44,17,10},
+	{47,17,10}, {48,17,10}, {54,17,10}, {55,17,10}, {56,17,10}, {58,17,10}, {53,19,10}, {21,20,13}, {29,20,13}, {10,23,15}, {19,23,15}, {21,23,14},
+	{29,23,14}, {35,24,11}, {36,24,11}, {37,24,11}, {38,24,11}, {44,24,11}, {45,24,11}, {46,24,11}, {35,25,11}, {38,25,11}, {46,25,11}, {53,25,10},
+	{54,25,10}, {55,25,10}, {35,26,11}, {37,26,11}, {38,26,11}, {44,26,11}, {45,26,11}, {46,26,11}, {53,26,10}, {54,26,10}, {55,26,10}, {35,27,11},
+	{36,27,11}, {37,27,11}, {38,27,11}, {53,27,10}, {54,27,10}, {55,27,10}, {10,28,15}, {19,28,15}, {21,28,14}, {29,28,14}, {4,3,14}, {5,3,14},
+	{6,3,14}, {7,3,14}, {8,3,14}, {9,3,14}, {10,3,14}, {11,3,14}, {3,4,14}, {4,4,14}, {5,4,14}, {6,4,14}, {7,4,14}, {8,4,14},
+	{9,4,14}, {10,4,14}, {11,4,14}, {12,4,14}, {19,4,13}, {33,4,13}, {3,5,14}, {4,5,14}, {7,5,14}, {8,5,14}, {11,5,14}, {12,5,14},
+	{3,6,14}, {4,6,14}, {7,6,14}, {8,6,14}, {11,6,14}, {12,6,14}, {3,7,14}, {4,7,14}, {7,7,14}, {8,7,14}, {11,7,14}, {12,7,14},
+	{3,8,14}, {4,8,14}, {5,8,14}, {6,8,14}, {9,8,14}, {10,8,14}, {11,8,14}, {12,8,14}, {6,9,14}, {9,9,14}, {6,10,14}, {7,10,14},
+	{8,10,14}, {9,10,14}, {19,10,14}, {26,10,13}, {33,10,14}, {6,11,14}, {7,11,14}, {8,11,14}, {9,11,14}, {49,11,14}, {3,12,14}, {4,12,14},
+	{5,12,14}, {10,12,14}, {11,12,14}, {12,12,14}, {6,13,14}, {7,13,14}, {8,13,14}, {9,13,14}, {51,13,14}, {3,14,14}, {4,14,14}, {5,14,14},
+	{10,14,14}, {11,14,14}, {12,14,14}, {41,14,14}, {53,15,14}, {43,16,14}, {55,17,14}, {45,18,14}, {57,19,14}, {47,20,14}, {38,22,14}, {49,22,14},
+	{51,24,14}, {19,26,9}, {20,26,9}, {21,26,9}, {22,26,9}, {23,26,9}, {24,26,9}, {25,26,9}, {26,26,9}, {27,26,9}, {28,26,9}, {29,26,9},
+	{30,26,9}, {31,26,9}, {32,26,9}, {33,26,9}, {17,28,10}, {18,28,10}, {19,28,10}, {20,28,10}, {21,28,10}, {22,28,10}, {23,28,10}, {24,28,10},
+	{25,28,10}, {26,28,10}, {27,28,10}, {28,28,10}, {29,28,10}, {30,28,10}, {31,28,10}, {32,28,10}, {33,28,10}, {34,28,10}, {35,28,10}, {16,1,9},
+	{17,1,9}, {28,1,9}, {29,1,9}, {30,1,9}, {31,1,9}, {32,1,9}, {33,1,9}, {34,1,9}, {51,1,10}, {16,2,9}, {17,2,9}, {28,2,9},
+	{34,2,9}, {16,3,9}, {17,3,9}, {28,3,9}, {29,3,9}, {30,3,9}, {31,3,9}, {32,3,9}, {33,3,9}, {34,3,9}, {16,4,9}, {17,4,9},
+	{31,4,9}, {2,5,15}, {9,5,13}, {16,5,9}, {17,5,9}, {31,5,9}, {53,5,10}, {55,5,10}, {16,6,9}, {17,6,9}, {53,6,10}, {55,6,10},
+	{16,7,9}, {17,7,9}, {31,7,9}, {16,8,9}, {17,8,9}, {1,9,15}, {3,9,15}, {16,9,9}, {17,9,9}, {31,9,9}, {9,10,13}, {16,10,9},
+	{17,10,9}, {16,11,9}, {17,11,9}, {31,11,9}, {16,12,9}, {17,12,9}, {2,13,15}, {16,13,9}, {17,13,9}, {16,14,9}, {17,14,9}, {9,15,13},
+	{16,15,9}, {17,15,9}, {16,16,9}, {17,16,9}, {16,17,9}, {17,17,9}, {31,17,9}, {2,18,14}, {16,18,9}, {17,18,9}, {9,19,13}, {16,19,9},
+	{17,19,9}, {31,19,9}, {16,20,9}, {17,20,9}, {16,21,9}, {17,21,9}, {31,21,9}, {9,22,13}, {16,22,9}, {17,22,9}, {50,22,10}, {51,22,10},
+	{52,22,10}, {53,22,10}, {54,22,10}, {2,23,13}, {23,23,11}, {25,23,11}, {27,23,11}, {29,23,10}, {31,23,10}, {33,23,10}, {35,23,10}, {37,23,9},
+	{39,23,9}, {41,23,9}, {43,23,9}, {24,24,11}, {26,24,11}, {28,24,11}, {30,24,10}, {32,24,10}, {34,24,10}, {36,24,10}, {38,24,9}, {40,24,9},
+	{42,24,9}, {44,24,9}, {23,25,11}, {25,25,11}, {27,25,11}, {29,25,10}, {31,25,10}, {33,25,10}, {35,25,10}, {37,25,9}, {39,25,9}, {41,25,9},
+	{43,25,9}, {24,26,11}, {26,26,11}, {28,26,11}, {30,26,10}, {32,26,10}, {34,26,10}, {36,26,10}, {38,26,9}, {40,26,9}, {42,26,9}, {44,26,9},
+	{23,27,11}, {25,27,11}, {27,27,11}, {29,27,10}, {31,27,10}, {33,27,10}, {35,27,10}, {37,27,9}, {39,27,9}, {41,27,9}, {43,27,9}, {24,28,11},
+	{26,28,11}, {28,28,11}, {30,28,10}, {32,28,10}, {34,28,10}, {36,28,10}, {38,28,9}, {40,28,9}, {42,28,9}, {44,28,9}, {2,1,9}, {22,1,9},
+	{28,1,9}, {30,1,9}, {36,1,9}, {40,1,9}, {46,1,9}, {6,3,9}, {12,3,9}, {18,3,9}, {2,7,9}, {25,7,9}, {33,7,9}, {58,7,9},
+	{23,10,13}, {35,10,11}, {45,10,9}, {53,10,9}, {2,11,10}, {20,13,10}, {42,13,10}, {58,13,10}, {15,14,10}, {23,14,13}, {35,14,13}, {13,16,10},
+	{23,18,14}, {35,18,13}, {2,19,10}, {12,19,10}, {50,19,10}, {23,22,14}, {35,22,13}, {44,23,10}, {15,25,11}, {46,25,10}, {23,26,15}, {35,26,14},
+	{20,27,11}, {58,27,10}, {1,28,11}, {7,28,11}, {21,1,9}, {22,1,9}, {21,2,9}, {23,2,9}, {24,2,9}, {25,2,9}, {21,8,15}, {22,8,15},
+	{21,9,15}, {22,9,15}, {4,12,10}, {5,12,10}, {8,12,10}, {9,12,10}, {26,12,11}, {15,15,11}, {12,19,11}, {35,19,9}, {6,22,10}, {6,23,10},
+	{6,24,10}, {12,24,9}, {17,24,13}, {6,25,10}, {6,26,10}, {17,26,13}, {2,27,10}, {6,27,10}, {7,28,10}, {10,28,10}, {11,28,10}, {12,28,10},
+	{13,28,10}, {5,1,11}, {6,1,10}, {7,1,9}, {52,1,9}, {53,1,10}, {54,1,11}, {5,2,11}, {6,2,10}, {7,2,9}, {52,2,9}, {53,2,10},
+	{54,2,11}, {5,3,11}, {6,3,10}, {7,3,9}, {52,3,9}, {53,3,10}, {54,3,11}, {5,4,11}, {6,4,10}, {7,4,9}, {52,4,9}, {53,4,10},
+	{54,4,11}, {1,5,11}, {2,5,11}, {3,5,11}, {4,5,11}, {5,5,11}, {6,5,10}, {7,5,9}, {52,5,9}, {53,5,10}, {54,5,11}, {55,5,11},
+	{56,5,11}, {57,5,11}, {58,5,11}, {1,6,10}, {2,6,10}, {3,6,10}, {4,6,10}, {5,6,10}, {6,6,10}, {7,6,9}, {52,6,9}, {53,6,10},
+	{54,6,10}, {55,6,10}, {56,6,10}, {57,6,10}, {58,6,10}, {1,7,9}, {2,7,9}, {3,7,9}, {4,7,9}, {5,7,9}, {6,7,9}, {7,7,9},
+	{52,7,9}, {53,7,9}, {54,7,9}, {55,7,9}, {56,7,9}, {57,7,9}, {58,7,9}, {1,22,9}, {2,22,9}, {3,22,9}, {4,22,9}, {5,22,9},
+	{6,22,9}, {7,22,9}, {52,22,9}, {53,22,9}, {54,22,9}, {55,22,9}, {56,22,9}, {57,22,9}, {58,22,9}, {1,23,10}, {2,23,10}, {3,23,10},
+	{4,23,10}, {5,23,10}, {6,23,10}, {7,23,9}, {52,23,9}, {53,23,10}, {54,23,10}, {55,23,10}, {56,23,10}, {57,23,10}, {58,23,10}, {1,24,11},
+	{2,24,11}, {3,24,11}, {4,24,11}, {5,24,11}, {6,24,10}, {7,24,9}, {52,24,9}, {53,24,10}, {54,24,11}, {55,24,11}, {56,24,11}, {57,24,11},
+	{58,24,11}, {5,25,11}, {6,25,10}, {7,25,9}, {52,25,9}, {53,25,10}, {54,25,11}, {5,26,11}, {6,26,10}, {7,26,9}, {52,26,9}, {53,26,10},
+	{54,26,11}, {5,27,11}, {6,27,10}, {7,27,9}, {52,27,9}, {53,27,10}, {54,27,11}, {5,28,11}, {6,28,10}, {7,28,9}, {52,28,9}, {53,28,10},
+	{54,28,11}, {1,1,9}, {5,1,9}, {23,1,10}, {23,2,10}, {8,3,13}, {18,3,13}, {23,3,10}, {28,3,13}, {38,3,13}, {48,3,13}, {52,3,9},
+	{58,3,13}, {3,4,14}, {23,4,10}, {33,4,13}, {43,4,13}, {1,5,9}, {5,5,9}, {41,5,11}, {45,5,11}, {58,7,9}, {3,8,13}, {7,8,15},
+	{13,8,13}, {18,8,9}, {23,8,13}, {28,8,9}, {33,8,13}, {43,8,13}, {53,8,13}, {48,9,9}, {45,11,10}, {51,11,10}, {8,13,13}, {12,13,14},
+	{18,13,13}, {23,13,9}, {28,13,13}, {38,13,13}, {48,13,13}, {58,13,13}, {41,15,10}, {55,15,10}, {37,17,10}, {39,17,10}, {47,17,10}, {49,17,10},
+	{3,18,13}, {7,18,15}, {13,18,13}, {23,18,13}, {33,18,13}, {43,18,13}, {48,18,10}, {53,18,13}, {37,19,10}, {39,19,10}, {47,19,10}, {49,19,10},
+	{56,19,10}, {1,21,9}, {5,21,9}, {21,21,10}, {25,21,10}, {33,21,11}, {3,22,14}, {8,23,13}, {18,23,13}, {28,23,13}, {31,23,11}, {38,23,13},
+	{48,23,13}, {58,23,13}, {15,24,9}, {1,25,9}, {5,25,9}, {14,25,9}, {21,25,10}, {25,25,10}, {35,25,11}, {38,26,10}, {28,27,13}, {36,27,10},
+	{3,28,13}, {13,28,13}, {16,28,9}, {23,28,13}, {33,28,13}, {38,28,10}, {43,28,13}, {46,28,10}, {53,28,13}, {10,1,13}, {16,1,13}, {19,1,14},
+	{22,1,14}, {24,1,14}, {27,1,14}, {47,1,13}, {50,1,13}, {29,2,14}, {34,2,15}, {53,2,13}, {56,4,13}, {29,13,9}, {30,13,9}, {34,13,9},
+	{35,13,9}, {42,13,9}, {53,13,10}, {8,14,10}, {10,14,10}, {15,14,10}, {17,14,10}, {52,14,10}, {53,14,10}, {54,14,10}, {42,15,9}, {52,15,10},
+	{53,15,10}, {54,15,10}, {42,16,9}, {53,16,10}, {12,22,11}, {13,22,11}, {22,22,11}, {25,22,11}, {33,22,11}, {34,22,11}, {35,22,11}, {6,23,11},
+	{7,23,11}, {11,23,11}, {14,23,11}, {21,23,11}, {26,23,11}, {33,23,11}, {35,23,11}, {6,24,11}, {7,24,11}, {35,24,11}, {6,25,11}, {7,25,11},
+	{33,25,11}, {35,25,11}, {33,26,11}, {34,26,11}, {35,26,11}, {6,1,11}, {6,5,11}, {29,12,9}, {19,13,13}, {20,13,13}, {28,13,9}, {30,13,9},
+	{19,14,13}, {20,14,13}, {29,14,9}, {31,14,9}, {30,15,9}, {44,15,10}, {45,15,10}, {53,15,10}, {56,15,10}, {29,16,9}, {52,16,10}, {57,16,10},
+	{30,17,9}, {42,17,10}, {47,17,10}, {52,17,10}, {57,17,10}, {58,17,10}, {29,18,9}, {9,19,10}, {10,19,10}, {30,19,9}, {39,19,9}, {40,19,9},
+	{8,20,10}, {9,20,10}, {11,20,10}, {29,20,9}, {31,20,9}, {38,20,9}, {39,20,9}, {40,20,9}, {41,20,9}, {49,20,9}, {50,20,9}, {6,21,10},
+	{7,21,10}, {8,21,10}, {10,21,10}, {11,21,10}, {28,21,9}, {30,21,9}, {38,21,9}, {39,21,9}, {40,21,9}, {41,21,9}, {49,21,9}, {50,21,9},
+	{9,22,10}, {10,22,10}, {29,22,9}, {39,22,9}, {40,22,9}, {39,23,9}, {40,23,9}, {39,25,9}, {40,25,9}, {39,26,9}, {40,26,9}, {38,27,9},
+	{39,27,9}, {40,27,9}, {41,27,9}, {19,28,11}, {20,28,11}, {38,28,9}, {39,28,9}, {40,28,9}, {41,28,9}, {48,28,9}, {51,28,9}, {29,3,9},
+	{56,3,13}, {29,4,9}, {35,7,10}, {47,7,10}, {15,8,9}, {23,8,9}, {24,8,9}, {25,8,9}, {30,8,9}, {35,8,10}, {39,8,10}, {47,8,10},
+	{14,9,9}, {25,9,9}, {47,9,10}, {53,9,10}, {55,9,10}, {39,10,10}, {47,10,10}, {43,11,10}, {43,15,11}, {6,17,9}, {7,18,9}, {19,18,9},
+	{6,22,9}, {13,22,9}, {25,22,9}, {34,22,10}, {34,23,10}, {46,23,10}, {47,23,10}, {48,23,10}, {55,23,10}, {5,24,9}, {7,24,9}, {12,24,9},
+	{24,24,9}, {34,24,10}, {53,25,10}, {54,25,10}, {6,1,11}, {32,1,9}, {1,2,9}, {12,2,10}, {28,2,10}, {19,3,10}, {38,3,11}, {48,3,9},
+	{5,5,9}, {39,5,10}, {12,6,9}, {23,6,9}, {49,6,10}, {1,8,10}, {31,8,10}, {27,9,11}, {40,9,9}, {47,9,11}, {13,10,9}, {21,10,10},
+	{53,10,9}, {37,11,10}, {5,14,9}, {32,14,9}, {56,14,10}, {13,15,9}, {24,15,9}, {57,16,9}, {40,17,9}, {37,18,11}, {21,19,9}, {23,19,11},
+	{58,19,11}, {24,20,11}, {32,20,10}, {37,20,9}, {25,22,10}, {45,22,10}, {48,22,9}, {5,23,9}, {55,23,11}, {58,23,10}, {14,24,9}, {34,24,9},
+	{47,25,11}, {57,25,9}, {30,26,9}, {3,27,11}, {19,27,9}, {52,27,10}, {7,28,10}, {16,28,10}, {23,28,11}, {40,28,11}, {41,28,11}, {6,1,9},
+	{7,1,9}, {8,1,9}, {9,1,9}, {10,1,9}, {37,1,9}, {47,1,9}, {50,1,13}, {53,1,9}, {6,2,9}, {7,2,9}, {8,2,9}, {9,2,9},
+	{10,2,9}, {36,2,9}, {38,2,9}, {46,2,9}, {48,2,9}, {52,2,9}, {54,2,9}, {57,2,13}, {35,3,9}, {39,3,9}, {42,3,13}, {45,3,9},
+	{49,3,9}, {51,3,9}, {55,3,9}, {11,4,11}, {12,4,11}, {34,4,9}, {40,4,9}, {44,4,9}, {50,4,10}, {56,4,9}, {11,5,11}, {12,5,11},
+	{35,5,9}, {41,5,9}, {43,5,9}, {49,5,9}, {51,5,9}, {57,5,9}, {11,6,11}, {12,6,11}, {36,6,9}, {42,6,10}, {48,6,9}, {52,6,9},
+	{58,6,9}, {37,7,9}, {41,7,9}, {43,7,9}, {47,7,9}, {53,7,9}, {57,7,9}, {38,8,9}, {40,8,9}, {44,8,9}, {46,8,9}, {54,8,9},
+	{56,8,9}, {39,9,10}, {45,9,10}, {55,9,10}, {38,10,9}, {40,10,9}, {44,10,9}, {46,10,9}, {54,10,9}, {56,10,9}, {37,11,9}, {41,11,9},
+	{43,11,9}, {47,11,9}, {53,11,9}, {57,11,9}, {6,12,10}, {7,12,10}, {36,12,9}, {42,12,10}, {48,12,9}, {52,12,9}, {58,12,9}, {6,13,10},
+	{7,13,10}, {35,13,9}, {41,13,9}, {43,13,9}, {49,13,9}, {51,13,9}, {57,13,9}, {6,14,10}, {7,14,10}, {34,14,9}, {40,14,9}, {44,14,9},
+	{50,14,10}, {56,14,9}, {35,15,9}, {39,15,9}, {42,15,13}, {45,15,9}, {49,15,9}, {51,15,9}, {55,15,9}, {36,16,9}, {38,16,9}, {46,16,9},
+	{48,16,9}, {52,16,9}, {54,16,9}, {57,16,13}, {37,17,9}, {47,17,9}, {50,17,13}, {53,17,9}, {38,24,14}, {46,24,15}, {48,24,15}, {37,25,14},
+	{39,25,14}, {3,26,9}, {4,26,9}, {5,26,9}, {6,26,9}, {38,26,14}, {46,26,15}, {48,26,15}, {1,27,9}, {6,28,9}, {7,28,9}, {8,28,9},
+	{9,3,9}, {15,3,9}, {21,3,9}, {58,3,9}, {57,4,9}, {12,5,9}, {56,5,9}, {20,7,9}, {24,7,9}, {58,9,9}, {36,10,9}, {38,10,9},
+	{57,10,9}, {37,11,9}, {56,11,9}, {36,12,9}, {38,12,9}, {58,16,9}, {57,17,9}, {56,18,9}, {32,22,10}, {38,22,10}, {5,23,11}, {8,23,11},
+	{4,24,11}, {5,25,11}, {8,25,11}, {30,25,10}, {29,26,10}, {30,26,10}, {31,26,10}, {30,27,10}, {43,2,14}, {52,2,14}, {48,6,14}, {57,6,14},
+	{19,12,10}, {39,12,10}, {48,12,9}, {49,12,9}, {12,13,14}, {47,13,9}, {48,13,9}, {49,13,9}, {50,13,9}, {48,14,9}, {49,14,9}, {50,14,9},
+	{49,15,9}, {50,15,9}, {50,16,9}, {29,19,14}, {13,24,14}, {18,25,9}, {54,25,10}, {55,25,10}, {5,26,14}, {8,26,14}, {17,26,9}, {18,26,9},
+	{19,26,9}, {20,26,9}, {53,26,10}, {56,26,10}, {18,27,9}, {19,27,9}, {20,27,9}, {54,27,10}, {55,27,10}, {17,28,9}, {18,28,9}, {19,28,9},
+	{20,28,9}, {43,28,9}, {2,2,13}, {8,2,13}, {14,2,13}, {20,2,13}, {38,3,9}, {40,3,9}, {42,3,9}, {5,4,13}, {11,4,13}, {17,4,13},
+	{39,4,9}, {41,4,9}, {57,5,9}, {58,5,9}, {2,6,13}, {8,6,13}, {14,6,13}, {20,6,13}, {57,6,9}, {58,6,9}, {23,7,10}, {57,7,9},
+	{58,7,9}, {5,8,13}, {11,8,13}, {17,8,13}, {24,8,10}, {57,8,9}, {58,8,9}, {23,9,10}, {2,10,13}, {8,10,13}, {14,10,13}, {20,10,13},
+	{24,10,10}, {23,11,10}, {58,11,10}, {24,12,10}, {57,12,10}, {58,13,10}, {57,14,10}, {2,15,11}, {58,15,10}, {1,16,11}, {57,16,10}, {2,17,11},
+	{1,18,11}, {2,19,11}, {57,19,11}, {1,20,11}, {58,20,11}, {57,21,11}, {58,22,11}, {3,23,14}, {57,23,11}, {58,24,11}, {2,28,14}, {18,1,10},
+	{22,1,10}, {26,1,10}, {30,1,10}, {34,1,10}, {38,1,10}, {42,1,10}, {46,1,10}, {52,1,11}, {58,1,9}, {4,2,15}, {12,2,14}, {19,2,10},
+	{23,2,10}, {27,2,10}, {31,2,10}, {35,2,10}, {39,2,10}, {43,2,10}, {47,2,10}, {54,2,13}, {20,3,10}, {24,3,10}, {28,3,10}, {32,3,10},
+	{36,3,10}, {40,3,10}, {44,3,10}, {48,3,10}, {2,4,15}, {49,4,10}, {18,5,9}, {22,5,9}, {26,5,9}, {30,5,9}, {34,5,9}, {38,5,9},
+	{42,5,9}, {46,5,9}, {50,5,9}, {57,5,13}, {58,7,11}, {2,8,14}, {19,8,9}, {23,8,9}, {27,8,9}, {31,8,9}, {35,8,9}, {39,8,9},
+	{45,8,11}, {53,8,11}, {30,9,9}, {1,10,10}, {9,10,10}, {13,10,9}, {17,10,9}, {41,10,9}, {49,10,11}, {58,11,11}, {1,12,10}, {5,12,10},
+	{9,12,10}, {45,12,11}, {53,12,11}, {57,12,11}, {1,14,10}, {5,14,10}, {17,14,9}, {41,14,9}, {49,14,11}, {18,15,9}, {40,15,9}, {58,15,11},
+	{1,16,10}, {5,16,10}, {9,16,10}, {13,16,9}, {45,16,11}, {53,16,11}, {57,16,11}, {1,18,10}, {5,18,10}, {9,18,10}, {17,18,9}, {41,18,9},
+	{49,18,11}, {2,19,10}, {4,19,10}, {58,19,11}, {1,20,10}, {7,20,10}, {45,20,11}, {53,20,11}, {57,20,11}, {28,21,9}, {1,22,10}, {9,22,10},
+	{13,22,9}, {17,22,9}, {21,22,9}, {25,22,9}, {29,22,9}, {33,22,9}, {37,22,9}, {41,22,9}, {49,22,11}, {2,23,10}, {58,23,11}, {3,24,10},
+	{11,24,10}, {13,24,9}, {17,24,9}, {21,24,9}, {25,24,9}, {29,24,9}, {33,24,9}, {37,24,9}, {57,24,11}, {4,25,10}, {56,25,11}, {5,26,10},
+	{11,26,10}, {15,26,10}, {19,26,10}, {23,26,10}, {27,26,10}, {31,26,10}, {35,26,10}, {39,26,10}, {55,26,11}, {6,27,10}, {16,27,10}, {20,27,10},
+	{24,27,10}, {28,27,10}, {32,27,10}, {36,27,10}, {40,27,10}, {54,27,11}, {7,28,10}, {9,28,10}, {11,28,10}, {13,28,10}, {17,28,10}, {21,28,10},
+	{25,28,10}, {29,28,10}, {33,28,10}, {37,28,10}, {41,28,10}, {47,28,11}, {49,28,11}, {51,28,11}, {53,28,11}, {8,2,11}, {9,2,11}, {20,2,11},
+	{26,2,11}, {27,2,11}, {57,2,11}, {8,3,11}, {9,3,11}, {15,5,11}, {31,5,11}, {47,5,10}, {48,5,10}, {49,5,10}, {50,5,10}, {51,5,10},
+	{9,6,11}, {41,7,9}, {42,7,9}, {43,7,9}, {44,7,9}, {41,9,9}, {41,10,9}, {2,11,10}, {3,11,10}, {4,11,10}, {5,11,10}, {6,11,10},
+	{7,11,10}, {8,11,10}, {40,11,9}, {53,11,13}, {2,12,10}, {8,12,10}, {9,12,10}, {10,12,10}, {2,13,10}, {3,13,10}, {4,13,10}, {5,13,10},
+	{6,13,10}, {7,13,10}, {8,13,10}, {9,13,10}, {10,13,10}, {23,16,10}, {6,17,13}, {5,18,13}, {15,19,13}, {52,20,10}, {53,20,10}, {54,20,10},
+	{25,21,10}, {44,21,13}, {54,21,10}, {25,22,10}, {54,22,10}, {25,23,10}, {26,23,10}, {25,24,10}, {26,24,10}, {53,24,10}, {25,25,10}, {26,25,10},
+	{27,25,10}, {53,25,10}, {54,25,10}, {55,25,10}, {56,25,10}, {25,26,10}, {26,26,10}, {27,26,10}, {37,26,10}, {37,27,10}, {38,27,10}, {45,27,10},
+	{46,27,10}, {4,2,9}, {50,2,10}, {54,2,10}, {57,2,9}, {28,3,9}, {29,3,9}, {2,4,9}, {53,4,10}, {57,4,9}, {27,5,9}, {30,5,9},
+	{49,5,10}, {4,6,9}, {9,6,15}, {18,6,15}, {51,6,10}, {56,6,10}, {28,7,9}, {29,7,9}, {2,8,9}, {51,8,10}, {54,8,10}, {4,9,10},
+	{22,9,10}, {3,10,10}, {5,10,10}, {21,10,10}, {23,10,10}, {3,11,10}, {5,11,10}, {11,11,9}, {16,11,9}, {21,11,10}, {23,11,10}, {4,12,10},
+	{22,12,10}, {38,12,11}, {42,12,11}, {39,13,11}, {41,13,11}, {38,14,11}, {42,14,11}, {22,15,11}, {23,15,11}, {21,16,11}, {24,16,11}, {22,17,11},
+	{23,17,11}, {57,19,9}, {56,20,9}, {58,20,9}, {56,21,9}, {58,21,9}, {39,22,9}, {40,22,9}, {41,22,9}, {42,22,9}, {43,22,9}, {48,22,9},
+	{49,22,9}, {56,22,9}, {58,22,9}, {39,23,9}, {40,23,9}, {41,23,9}, {42,23,9}, {43,23,9}, {48,23,9}, {49,23,9}, {57,23,9}, {2,26,9},
+	{3,26,9}, {4,26,9}, {5,26,9}, {6,26,9}, {2,27,9}, {3,27,9}, {4,27,9}, {5,27,9}, {6,27,9}, {41,1,15}, {25,4,9}, {31,4,9},
+	{36,4,9}, {40,4,9}, {46,4,9}, {53,4,9}, {53,5,9}, {31,6,9}, {53,6,9}, {54,6,9}, {23,7,9}, {24,7,9}, {25,7,9}, {54,7,9},
+	{58,9,10}, {58,10,11}, {20,11,10}, {23,11,10}, {24,11,10}, {28,11,10}, {29,11,10}, {35,11,10}, {36,11,10}, {43,11,10}, {44,11,10}, {50,11,10},
+	{51,11,10}, {58,11,10}, {40,13,10}, {1,14,10}, {2,14,9}, {3,14,10}, {4,14,10}, {9,14,10}, {13,14,11}, {16,14,10}, {17,14,10}, {20,14,10},
+	{24,14,10}, {25,14,10}, {2,15,9}, {4,15,13}, {8,15,13}, {12,15,13}, {16,15,13}, {19,15,13}, {23,15,13}, {27,15,13}, {31,15,13}, {35,15,13},
+	{38,15,13}, {42,15,13}, {45,15,10}, {46,15,10}, {48,15,13}, {52,15,13}, {55,15,13}, {1,16,9}, {2,16,9}, {34,16,10}, {46,16,10}, {8,17,11},
+	{35,17,10}, {2,18,13}, {4,18,13}, {5,18,11}, {7,18,13}, {8,18,13}, {11,18,13}, {15,18,13}, {19,18,13}, {23,18,13}, {27,18,13}, {30,18,13},
+	{34,18,13}, {35,18,10}, {38,18,13}, {42,18,13}, {45,18,13}, {48,18,13}, {52,18,13}, {55,18,13}, {33,19,10}, {34,19,10}, {35,19,10}, {5,20,11},
+	{51,20,10}, {17,21,11}, {51,21,10}, {2,22,14}, {6,22,14}, {7,22,14}, {18,22,14}, {19,22,14}, {23,22,14}, {24,22,14}, {28,22,14}, {29,22,14},
+	{37,22,14}, {38,22,14}, {43,22,14}, {50,22,14}, {51,22,14}, {56,22,14}, {14,23,11}, {3,25,15}, {4,25,15}, {9,25,15}, {14,25,15}, {15,25,15},
+	{20,25,15}, {21,25,15}, {25,25,15}, {28,25,15}, {29,25,15}, {32,25,15}, {33,25,15}, {37,25,15}, {40,25,15}, {41,25,15}, {42,25,15}, {45,25,15},
+	{49,25,15}, {50,25,15}, {51,25,15}, {53,25,15}, {54,25,15}, {57,25,15}, {11,26,11}, {17,26,10}, {18,26,10}, {38,26,10}, {42,26,10}, {43,26,10},
+	{50,26,10}, {51,26,10}, {38,27,10}, {43,27,10}, {23,28,10}, {24,28,10}, {26,28,10}, {27,28,10}, {28,28,10}, {29,28,10}, {30,28,10}, {38,28,10},
+	{47,28,10}, {48,28,10}, {49,2,9}, {51,2,9}, {53,2,9}, {55,2,9}, {57,2,9}, {49,4,9}, {51,4,9}, {53,4,9}, {55,4,9}, {57,4,9},
+	{49,6,9}, {51,6,9}, {53,6,9}, {55,6,9}, {57,6,9}, {49,8,9}, {51,8,9}, {53,8,9}, {55,8,9}, {57,8,9}, {26,16,11}, {28,16,11},
+	{30,16,11}, {32,16,11}, {46,16,10}, {47,16,10}, {48,16,10}, {49,16,10}, {50,16,10}, {25,17,11}, {27,17,11}, {31,17,11}, {45,17,10}, {46,17,10},
+	{47,17,10}, {48,17,10}, {49,17,10}, {50,17,10}, {51,17,10}, {26,18,11}, {30,18,11}, {32,18,11}, {44,18,10}, {45,18,10}, {51,18,10}, {52,18,10},
+	{25,19,11}, {27,19,11}, {29,19,11}, {31,19,11}, {44,19,10}, {47,19,10}, {49,19,10}, {52,19,10}, {44,20,10}, {52,20,10}, {44,21,10}, {46,21,10},
+	{47,21,10}, {49,21,10}, {50,21,10}, {52,21,10}, {2,22,15}, {3,22,15}, {4,22,15}, {5,22,15}, {6,22,15}, {7,22,15}, {8,22,15}, {9,22,15},
+	{44,22,10}, {47,22,10}, {48,22,10}, {49,22,10}, {52,22,10}, {2,23,15}, {3,23,14}, {4,23,14}, {5,23,14}, {6,23,14}, {7,23,14}, {8,23,14},
+	{9,23,15}, {45,23,10}, {51,23,10}, {2,24,15}, {3,24,14}, {4,24,13}, {5,24,13}, {6,24,13}, {7,24,13}, {8,24,14}, {9,24,15}, {46,24,10},
+	{47,24,10}, {48,24,10}, {49,24,10}, {50,24,10}, {2,25,15}, {3,25,14}, {4,25,13}, {5,25,13}, {6,25,13}, {7,25,13}, {8,25,14}, {9,25,15},
+	{2,26,15}, {3,26,14}, {4,26,14}, {5,26,14}, {6,26,14}, {7,26,14}, {8,26,14}, {9,26,15}, {2,27,15}, {3,27,15}, {4,27,15}, {5,27,15},
+	{6,27,15}, {7,27,15}, {8,27,15}, {9,27,15},
+};
+
+// Where each lock group starts in kEmbeddedLockCells, plus an end per level
+static const WORD kEmbeddedLockGroupStart[144] =
+{
+	0, 4, 5, 6, 6, 24, 24, 26, 28, 31, 36, 39, 42, 45, 48, 48,
+	52, 53, 54, 54, 57, 59, 59, 67, 68, 75, 82, 85, 90, 91, 91, 92,
+	93, 95, 96, 97, 99, 101, 103, 105, 107, 109, 110, 111, 113, 114, 115, 117,
+	119, 121, 123, 125, 126, 127, 128, 129, 131, 133, 135, 137, 139, 140, 142, 143,
+	144, 145, 145, 147, 149, 151, 153, 153, 174, 180, 180, 181, 182, 183, 183, 185,
+	185, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196, 197, 198, 199,
+	200, 201, 202, 203, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215,
+	216, 217, 218, 219, 220, 221, 221, 279, 337, 337, 340, 346, 346, 346, 346, 402,
+	406, 406, 406, 406, 408, 411, 413, 415, 417, 419, 419, 419, 419, 419, 419, 506,
+};
+
+// Lock cells as y * 60 + x, group by group
+static const WORD kEmbeddedLockCells[506] =
+{
+	663, 723, 783, 843, 776, 778, 714, 774, 834, 894, 954, 1014, 1074, 1134, 1194, 1254,
+	1314, 1374, 1434, 1494, 1554, 1614, 1674, 1734, 260, 320, 280, 340, 549, 550, 551, 588,
+	589, 590, 591, 592, 1149, 1150, 1151, 1169, 1170, 1171, 1189, 1190, 1191, 1420, 1480, 1540,
+	663, 723, 783, 843, 776, 778, 364, 424, 484, 837, 838, 429, 430, 431, 432, 433,
+	434, 435, 436, 623, 794, 854, 914, 974, 1034, 1094, 1154, 796, 856, 916, 976, 1036,
+	1096, 1156, 1292, 1352, 1412, 1441, 1442, 1443, 1444, 1445, 1498, 189, 200, 210, 211, 221,
+	230, 364, 424, 375, 435, 385, 445, 396, 456, 406, 466, 414, 474, 609, 620, 630,
+	631, 641, 650, 785, 845, 795, 855, 805, 865, 825, 885, 835, 895, 1029, 1100, 1121,
+	1130, 1264, 1324, 1274, 1334, 1285, 1345, 1306, 1366, 1314, 1374, 1509, 1530, 1531, 1541, 1550,
+	1580, 519, 520, 759, 760, 1656, 1716, 1695, 1696, 81, 141, 201, 261, 321, 381, 441,
+	501, 561, 621, 681, 741, 801, 861, 921, 981, 1041, 1101, 1161, 1221, 1281, 1425, 1485,
+	1545, 1605, 1665, 1725, 501, 981, 1461, 1673, 1674, 186, 196, 206, 216, 226, 236, 485,
+	495, 505, 515, 525, 535, 786, 796, 806, 816, 826, 836, 1085, 1095, 1105, 1115, 1125,
+	1135, 1386, 1396, 1406, 1416, 1426, 1436, 1685, 1695, 1705, 1715, 1725, 1735, 541, 542, 543,
+	544, 545, 546, 547, 548, 549, 550, 551, 552, 553, 554, 555, 556, 557, 558, 559,
+	560, 561, 562, 563, 564, 565, 566, 567, 568, 569, 570, 571, 572, 573, 574, 575,
+	576, 577, 578, 579, 580, 581, 582, 583, 584, 585, 586, 587, 588, 589, 590, 591,
+	592, 593, 594, 595, 596, 597, 598, 1141, 1142, 1143, 1144, 1145, 1146, 1147, 1148, 1149,
+	1150, 1151, 1152, 1153, 1154, 1155, 1156, 1157, 1158, 1159, 1160, 1161, 1162, 1163, 1164, 1165,
+	1166, 1167, 1168, 1169, 1170, 1171, 1172, 1173, 1174, 1175, 1176, 1177, 1178, 1179, 1180, 1181,
+	1182, 1183, 1184, 1185, 1186, 1187, 1188, 1189, 1190, 1191, 1192, 1193, 1194, 1195, 1196, 1197,
+	1198, 122, 182, 242, 1421, 1478, 1479, 1480, 1481, 1541, 92, 93, 152, 153, 212, 213,
+	272, 273, 332, 333, 392, 393, 452, 453, 512, 513, 572, 573, 632, 633, 692, 693,
+	752, 753, 812, 813, 872, 873, 932, 933, 992, 993, 1052, 1053, 1112, 1113, 1172, 1173,
+	1232, 1233, 1292, 1293, 1352, 1353, 1412, 1413, 1472, 1473, 1532, 1533, 1592, 1593, 1652, 1653,
+	1712, 1713, 901, 902, 903, 904, 345, 405, 585, 645, 705, 825, 885, 1065, 1125, 1305,
+	1365, 1545, 1605, 602, 604, 606, 608, 610, 612, 614, 616, 618, 620, 622, 624, 626,
+	628, 630, 632, 634, 636, 638, 640, 642, 644, 646, 648, 650, 652, 654, 656, 658,
+	661, 663, 665, 667, 669, 671, 673, 675, 677, 679, 681, 683, 685, 687, 689, 691,
+	693, 695, 697, 699, 701, 703, 705, 707, 709, 711, 713, 715, 717, 722, 724, 726,
+	728, 730, 732, 734, 736, 738, 740, 742, 744, 746, 748, 750, 752, 754, 756, 758,
+	760, 762, 764, 766, 768, 770, 772, 774, 776, 778,
+};
+
+// Start, monsters, generators, keys, locks, entities, lock groups
+static const LevelInfo kEmbeddedLevelInfo[26] =
+{
+	{ 33, 17, 72, 1, 2, 6, kEmbeddedEntities + 0, 73, kEmbeddedLockGroupStart + 0, 3, kEmbeddedLockCells }, // level.a
+	{ 57, 2, 49, 0, 1, 18, kEmbeddedEntities + 73, 49, kEmbeddedLockGroupStart + 4, 1, kEmbeddedLockCells }, // level.b
+	{ 30, 14, 156, 5, 8, 24, kEmbeddedEntities + 122, 161, kEmbeddedLockGroupStart + 6, 8, kEmbeddedLockCells }, // level.c
+	{ 33, 17, 72, 1, 2, 6, kEmbeddedEntities + 283, 73, kEmbeddedLockGroupStart + 15, 3, kEmbeddedLockCells }, // level.d
+	{ 30, 20, 309, 0, 1, 5, kEmbeddedEntities + 356, 309, kEmbeddedLockGroupStart + 19, 2, kEmbeddedLockCells }, // level.e
+	{ 34, 22, 293, 8, 6, 32, kEmbeddedEntities + 665, 301, kEmbeddedLockGroupStart + 22, 7, kEmbeddedLockCells }, // level.f
+	{ 25, 10, 76, 12, 28, 54, kEmbeddedEntities + 966, 88, kEmbeddedLockGroupStart + 30, 35, kEmbeddedLockCells }, // level.g
+	{ 26, 4, 34, 87, 4, 8, kEmbeddedEntities + 1054, 121, kEmbeddedLockGroupStart + 66, 4, kEmbeddedLockCells }, // level.h
+	{ 31, 14, 144, 11, 1, 27, kEmbeddedEntities + 1175, 155, kEmbeddedLockGroupStart + 71, 2, kEmbeddedLockCells }, // level.i
+	{ 57, 2, 33, 9, 1, 3, kEmbeddedEntities + 1330, 42, kEmbeddedLockGroupStart + 74, 3, kEmbeddedLockCells }, // level.j
+	{ 9, 6, 27, 6, 1, 2, kEmbeddedEntities + 1372, 33, kEmbeddedLockGroupStart + 78, 1, kEmbeddedLockCells }, // level.k
+	{ 20, 15, 132, 0, 0, 0, kEmbeddedEntities + 1405, 132, kEmbeddedLockGroupStart + 80, 0, kEmbeddedLockCells }, // level.l
+	{ 57, 27, 48, 44, 2, 36, kEmbeddedEntities + 1537, 92, kEmbeddedLockGroupStart + 81, 36, kEmbeddedLockCells }, // level.m
+	{ 2, 2, 44, 12, 2, 116, kEmbeddedEntities + 1629, 56, kEmbeddedLockGroupStart + 118, 2, kEmbeddedLockCells }, // level.n
+	{ 57, 24, 74, 4, 2, 9, kEmbeddedEntities + 1685, 78, kEmbeddedLockGroupStart + 121, 2, kEmbeddedLockCells }, // level.o
+	{ 8, 4, 40, 1, 0, 0, kEmbeddedEntities + 1763, 41, kEmbeddedLockGroupStart + 124, 0, kEmbeddedLockCells }, // level.p
+	{ 15, 19, 55, 0, 0, 0, kEmbeddedEntities + 1804, 55, kEmbeddedLockGroupStart + 125, 0, kEmbeddedLockCells }, // level.q
+	{ 10, 20, 119, 14, 3, 60, kEmbeddedEntities + 1859, 133, kEmbeddedLockGroupStart + 126, 2, kEmbeddedLockCells }, // level.r
+	{ 57, 27, 32, 0, 0, 0, kEmbeddedEntities + 1992, 32, kEmbeddedLockGroupStart + 129, 0, kEmbeddedLockCells }, // level.s
+	{ 28, 9, 33, 9, 0, 0, kEmbeddedEntities + 2024, 42, kEmbeddedLockGroupStart + 130, 0, kEmbeddedLockCells }, // level.t
+	{ 24, 2, 37, 20, 2, 13, kEmbeddedEntities + 2066, 57, kEmbeddedLockGroupStart + 131, 6, kEmbeddedLockCells }, // level.u
+	{ 29, 15, 148, 6, 0, 0, kEmbeddedEntities + 2123, 154, kEmbeddedLockGroupStart + 138, 0, kEmbeddedLockCells }, // level.v
+	{ 19, 14, 71, 5, 0, 0, kEmbeddedEntities + 2277, 76, kEmbeddedLockGroupStart + 139, 0, kEmbeddedLockCells }, // level.w
+	{ 13, 3, 78, 2, 0, 0, kEmbeddedEntities + 2353, 80, kEmbeddedLockGroupStart + 140, 0, kEmbeddedLockCells }, // level.x
+	{ 2, 2, 79, 70, 0, 0, kEmbeddedEntities + 2433, 149, kEmbeddedLockGroupStart + 141, 0, kEmbeddedLockCells }, // level.y
+	{ 2, 2, 74, 48, 87, 87, kEmbeddedEntities + 2582, 122, kEmbeddedLockGroupStart + 142, 1, kEmbeddedLockCells }, // level.z
+};
+
+#endif // EMBEDDED_LEVELS_H
@@ -0,0 +1,106 @@
+// LevelUnpack.h
+//
+// Expands the 4-bit packed level format (two cells per byte, low nibble
+// first) into one byte per cell, a whole 30-byte row at a time.
+//
+// Plain C so the same file can be used by the C++ and Objective-C ports.
+// Identical copies live in dandy-c++, dandy-360 and dandy-ios/Dandy.
+// The SIMD path is picked at compile time: AVX2 or SSE2 on x86, NEON on
+// ARM, and a portable scalar loop everywhere else.
+
+#ifndef LEVEL_UNPACK_H
+#define LEVEL_UNPACK_H
+
+#if defined(_MSC_VER)
+#define LEVEL_UNPACK_INLINE static __inline
+#else
+#define LEVEL_UNPACK_INLINE static inline
+#endif
+
+#if defined(__AVX2__)
+#define LEVEL_UNPACK_AVX2 1
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define LEVEL_UNPACK_SSE2 1
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define LEVEL_UNPACK_NEON 1
+#include <arm_neon.h>
+#endif
+
+#define LEVEL_UNPACK_ROW_BYTES 30
+#define LEVEL_UNPACK_ROW_CELLS 60
+
+// Reference version, one byte at a time.
+LEVEL_UNPACK_INLINE void LevelUnpackRowScalar(unsigned char* cells, const unsigned char* packed)
+{
+	int i;
+	for(i = 0; i < LEVEL_UNPACK_ROW_BYTES; i++)
+	{
+		unsigned char b = packed[i];
+		cells[2 * i] = (unsigned char) (b & 0xf);
+		cells[2 * i + 1] = (unsigned char) (b >> 4);
+	}
+}
+
+// A row is 30 bytes, so it is done as two overlapping 16-byte halves:
+// bytes 0..15 make cells 0..31 and bytes 14..29 make cells 28..59.
+// Neither half reads or writes outside the row.
+LEVEL_UNPACK_INLINE void LevelUnpackRow(unsigned char* cells, const unsigned char* packed)
+{
+#if defined(LEVEL_UNPACK_AVX2)
+	const __m256i lowMask = _mm256_set1_epi16(0x000f);
+	const __m256i highMask = _mm256_set1_epi16(0x0f00);
+	int half;
+	for(half = 0; half < 2; half++)
+	{
+		int offset = half * (LEVEL_UNPACK_ROW_BYTES - 16);
+		// Widen each byte to a word, then move the high nibble up into the
+		// word's second byte: little endian gives low, high in memory.
+		__m256i w = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*) (packed + offset)));
+		__m256i c = _mm256_or_si256(_mm256_and_si256(w, lowMask),
+			_mm256_and_si256(_mm256_slli_epi16(w, 4), highMask));
+		_mm256_storeu_si256((__m256i*) (cells + 2 * offset), c);
+	}
+#elif defined(LEVEL_UNPACK_SSE2)
+	const __m128i mask = _mm_set1_epi8(0x0f);
+	int half;
+	for(half = 0; half < 2; half++)
+	{
+		int offset = half * (LEVEL_UNPACK_ROW_BYTES - 16);
+		__m128i b = _mm_loadu_si128((const __m128i*) (packed + offset));
+		__m128i lo = _mm_and_si128(b, mask);
+		__m128i hi = _mm_and_si128(_mm_srli_epi16(b, 4), mask);
+		_mm_storeu_si128((__m128i*) (cells + 2 * offset), _mm_unpacklo_epi8(lo, hi));
+		_mm_storeu_si128((__m128i*) (cells + 2 * offset + 16), _mm_unpackhi_epi8(lo, hi));
+	}
+#elif defined(LEVEL_UNPACK_NEON)
+	const uint8x16_t mask = vdupq_n_u8(0x0f);
+	int half;
+	for(half = 0; half < 2; half++)
+	{
+		int offset = half * (LEVEL_UNPACK_ROW_BYTES - 16);
+		uint8x16_t b = vld1q_u8(packed + offset);
+		uint8x16x2_t c;
+		c.val[0] = vandq_u8(b, mask);
+		c.val[1] = vshrq_n_u8(b, 4);
+		// Interleaving store writes low, high, low, high...
+		vst2q_u8(cells + 2 * offset, c);
+	}
+#else
+	LevelUnpackRowScalar(cells, packed);
+#endif
+}
+
+LEVEL_UNPACK_INLINE void LevelUnpack(unsigned char* cells, const unsigned char* packed, int rows)
+{
+	int y;
+	for(y = 0; y < rows; y++)
+	{
+		LevelUnpackRow(cells, packed);
+		cells += LEVEL_UNPACK_ROW_CELLS;
+		packed += LEVEL_UNPACK_ROW_BYTES;
+	}
+}
+
+#endif // LEVEL_UNPACK_H
@@ -0,0 +1,62 @@
+// MapLayout.h
+//
+// Where cell (x, y) of a Map lives in its cell array. Map picks one of
+// these at compile time: row-major by default, or 8x8 tiles when
+// DANDY_TILED_MAP is defined. Only the index math lives here, so it can
+// be shared with bench\MapLayoutBench.cpp.
+
+#ifndef MAP_LAYOUT_H
+#define MAP_LAYOUT_H
+
+// One row after another, the same as the level files.
+struct RowMajorLayout
+{
+	static const bool IsRowMajor = true;
+
+	void Init(unsigned long width, unsigned long height)
+	{
+		stride = width;
+		size = width * height;
+	}
+
+	unsigned long Index(unsigned long x, unsigned long y) const
+	{
+		return y * stride + x;
+	}
+
+	unsigned long stride;
+	unsigned long size;	// Cells to allocate
+};
+
+// 8x8 blocks of cells, each one row-major inside and exactly one 64-byte
+// cache line, with the blocks themselves row-major. The 8 neighbours of a
+// cell are in the same block 9 times out of 16 and in at most 4 blocks,
+// where row-major touches 3 rows a whole map width apart. Rows of blocks
+// are padded to a power of two cells so Index is only shifts and masks.
+struct TiledLayout
+{
+	static const bool IsRowMajor = false;
+	static const unsigned long kShift = 3;
+	static const unsigned long kMask = (1 << kShift) - 1;
+
+	void Init(unsigned long width, unsigned long height)
+	{
+		rowShift = kShift;
+		while((1UL << rowShift) < width)
+		{
+			rowShift++;
+		}
+		size = ((height + kMask) & ~kMask) << rowShift;
+	}
+
+	unsigned long Index(unsigned long x, unsigned long y) const
+	{
+		return ((y & ~kMask) << rowShift) | ((x & ~kMask) << kShift)
+			| ((y & kMask) << kShift) | (x & kMask);
+	}
+
+	unsigned long rowShift;	// log2 of the padded width
+	unsigned long size;	// Cells to allocate
+};
+
+#endif // MAP_LAYOUT_H
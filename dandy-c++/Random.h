@@ -0,0 +1,71 @@
+// Random.h
+//
+// PCG32 (O'Neill's permuted congruential generator, XSH RR output): 64
+// bits of state, 32 bits out per step. Each World owns one, so a game
+// seeded the same way plays out the same way, and two worlds never share
+// a sequence or take a lock the way rand() does.
+//
+// The state is two plain words so a snapshot can copy it as it is.
+// Identical copies live in dandy-c++ and dandy-360.
+
+#ifndef RANDOM_H
+#define RANDOM_H
+
+#if defined(_MSC_VER)
+typedef unsigned __int64 RandomWord;
+#else
+typedef unsigned long long RandomWord;
+#endif
+
+class Random
+{
+public:
+	// Arbitrary defaults, not the reference implementation's. Recorded
+	// games use kDefaultStream, so changing it changes how each seed plays.
+	static const unsigned int kDefaultSeedHigh = 0x853c4927;
+	static const unsigned int kDefaultSeedLow = 0x44b12dab;
+	static const unsigned int kDefaultStream = 0xda3e39cb;
+
+	Random()
+	{
+		Seed(((RandomWord) kDefaultSeedHigh << 32) | kDefaultSeedLow, kDefaultStream);
+	}
+
+	// Different streams give unrelated sequences for the same seed
+	void Seed(RandomWord seed, RandomWord stream)
+	{
+		state = 0;
+		inc = (stream << 1) | 1;
+		Next();
+		state += seed;
+		Next();
+	}
+
+	unsigned int Next()
+	{
+		RandomWord old = state;
+		state = old * Multiplier() + inc;
+		unsigned int xorShifted = (unsigned int) ((((old >> 18) ^ old) >> 27) & 0xffffffff);
+		unsigned int rot = (unsigned int) (old >> 59);
+		return (xorShifted >> rot) | (xorShifted << ((32 - rot) & 31));
+	}
+
+	// 0 to range - 1. Plain modulo: the bias is below 1 in 10^8 for the
+	// small ranges the game asks for.
+	unsigned int Range(unsigned int range)
+	{
+		return Next() % range;
+	}
+
+	static RandomWord Multiplier()
+	{
+		// 6364136223846793005, without a 64-bit literal suffix VS2003 and
+		// gcc agree on
+		return ((RandomWord) 0x5851f42d << 32) | 0x4c957f2d;
+	}
+
+	RandomWord state;
+	RandomWord inc;	// Always odd; picks the stream
+};
+
+#endif // RANDOM_H
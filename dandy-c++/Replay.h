@@ -0,0 +1,356 @@
+// Replay.h
+//
+// A recorded game: how it started, then every pad's buttons each tick,
+// run-length encoded, with a hash of the world every hashInterval ticks.
+// World::Update reads no clock, so the same start and the same buttons
+// play out the same way, and playback can tell from the hashes exactly
+// where a game stopped matching its recording. Dandy.exe records with
+// -record <file> and plays back, without drawing, with -play <file>.
+//
+// Portable, so tools can read and write replays without the DirectX SDK.
+//
+// The file, integers little-endian:
+//
+//    0  4  "DRPC"
+//    4  1  kVersion
+//    5  1  starting level
+//    6  1  players (World::numPlayers)
+//    7  1  0
+//    8  8  seed     } as passed to Random::Seed
+//   16  8  stream   }
+//   24  4  build hash of the recording Dandy.exe
+//   28  2  hashInterval in ticks, 0 for no hashes
+//   30  2  0
+//   32  4  ticks
+//   36     records, until the end of the file
+//
+// Each record starts with a varint (7 bits a byte, low first) whose low 2
+// bits are its kind:
+//
+//   kRun   v >> 6 ticks (at least 1) with the same buttons. Bits 2-5 say
+//          which pads changed since the last run; one byte follows for
+//          each, in pad order. Every pad starts with nothing pressed.
+//   kHash  4 bytes of World::StateHash follow, taken after the ticks so
+//          far.
+//
+// dandy-gb's replays (bench/replay.h) use the same records, plus one for
+// players joining mid-game.
+
+#ifndef REPLAY_H
+#define REPLAY_H
+
+#include <string.h>
+#include <vector>
+
+#include "Random.h"
+
+const int kReplayPads = 4; // World::PlayerCount
+
+struct ReplayHeader
+{
+	ReplayHeader()
+	{
+		level = 0;
+		players = 0;
+		seed = 0;
+		stream = 0;
+		buildHash = 0;
+		hashInterval = 0;
+		ticks = 0;
+	}
+
+	unsigned char level;
+	unsigned char players;
+	RandomWord seed;
+	RandomWord stream;
+	unsigned int buildHash;
+	unsigned short hashInterval;
+	unsigned int ticks;
+};
+
+// FNV-1a, for state and build hashes
+inline unsigned int ReplayHash(unsigned int hash, const void* data, size_t size)
+{
+	const unsigned char* bytes = (const unsigned char*) data;
+	for(size_t i = 0; i < size; i++)
+	{
+		hash = (hash ^ bytes[i]) * 16777619u;
+	}
+	return hash;
+}
+
+const unsigned int kReplayHashStart = 2166136261u;
+
+class Replay
+{
+public:
+	static const unsigned char kVersion = 1;
+	static const unsigned int kHeaderSize = 36;
+	static const unsigned short kHashInterval = 60; // Once a second
+
+	enum Record
+	{
+		kRun = 0,
+		kHash = 2	// dandy-gb's 1 is a player joining, which can't happen here
+	};
+
+protected:
+	static void Put(std::vector<unsigned char>& out, RandomWord v, int bytes)
+	{
+		for(int i = 0; i < bytes; i++)
+		{
+			out.push_back((unsigned char) (v >> (i * 8)));
+		}
+	}
+
+	static RandomWord Get(const unsigned char* in, int bytes)
+	{
+		RandomWord v = 0;
+		for(int i = bytes - 1; i >= 0; i--)
+		{
+			v = (v << 8) | in[i];
+		}
+		return v;
+	}
+};
+
+class ReplayWriter : public Replay
+{
+public:
+	ReplayWriter()
+	{
+		runTicks = 0;
+		runChanged = 0;
+		memset(held, 0, sizeof(held));
+	}
+
+	// header.ticks is counted by Tick
+	void Begin(const ReplayHeader& h)
+	{
+		header = h;
+		header.ticks = 0;
+		data.clear();
+		data.resize(kHeaderSize);
+		runTicks = 0;
+		runChanged = 0;
+		memset(held, 0, sizeof(held));
+	}
+
+	// The buttons the pads had this tick
+	void Tick(const unsigned char buttons[kReplayPads])
+	{
+		unsigned int changed = 0;
+		for(int i = 0; i < kReplayPads; i++)
+		{
+			if(buttons[i] != held[i])
+			{
+				changed |= 1 << i;
+			}
+		}
+		if(changed)
+		{
+			Flush();
+			memcpy(held, buttons, sizeof(held));
+			runChanged = changed;
+		}
+		runTicks++;
+		header.ticks++;
+	}
+
+	// Whether a hash is due after the tick just recorded
+	bool HashDue() const
+	{
+		return header.hashInterval != 0 && header.ticks % header.hashInterval == 0;
+	}
+
+	void Hash(unsigned int hash)
+	{
+		Flush();
+		PutVarint(kHash);
+		Put(data, hash, 4);
+	}
+
+	// The finished replay. Recording can carry on after it.
+	const std::vector<unsigned char>& End()
+	{
+		Flush();
+		std::vector<unsigned char> head;
+		head.push_back('D');
+		head.push_back('R');
+		head.push_back('P');
+		head.push_back('C');
+		head.push_back((unsigned char) kVersion);
+		head.push_back(header.level);
+		head.push_back(header.players);
+		head.push_back(0);
+		Put(head, header.seed, 8);
+		Put(head, header.stream, 8);
+		Put(head, header.buildHash, 4);
+		Put(head, header.hashInterval, 2);
+		Put(head, 0, 2);
+		Put(head, header.ticks, 4);
+		memcpy(&data[0], &head[0], kHeaderSize);
+		return data;
+	}
+
+private:
+	void PutVarint(RandomWord v)
+	{
+		do
+		{
+			unsigned char b = (unsigned char) (v & 0x7f);
+			v >>= 7;
+			data.push_back(v ? (unsigned char) (b | 0x80) : b);
+		} while(v);
+	}
+
+	void Flush()
+	{
+		if(runTicks == 0)
+		{
+			return;
+		}
+		PutVarint(((RandomWord) runTicks << 6) | (runChanged << 2) | kRun);
+		for(int i = 0; i < kReplayPads; i++)
+		{
+			if(runChanged & (1 << i))
+			{
+				data.push_back(held[i]);
+			}
+		}
+		runTicks = 0;
+		runChanged = 0;
+	}
+
+	ReplayHeader header;
+	std::vector<unsigned char> data;
+	unsigned char held[kReplayPads];	// Buttons of the run being recorded
+	unsigned int runChanged;
+	unsigned int runTicks;
+};
+
+class ReplayReader : public Replay
+{
+public:
+	enum Event
+	{
+		kTick,		// buttons holds the next tick's
+		kHashCheck,	// hash holds the state hash after the ticks so far
+		kEnd,
+		kBad		// Malformed or cut short
+	};
+
+	ReplayReader()
+	{
+		data = NULL;
+		size = 0;
+		pos = 0;
+		runLeft = 0;
+		ticks = 0;
+		memset(held, 0, sizeof(held));
+	}
+
+	// data must outlive the reader. Returns false if it isn't a replay.
+	bool Open(const unsigned char* d, size_t s)
+	{
+		data = d;
+		size = s;
+		pos = kHeaderSize;
+		runLeft = 0;
+		ticks = 0;
+		memset(held, 0, sizeof(held));
+		if(size < kHeaderSize || memcmp(data, "DRPC", 4) != 0 || data[4] != kVersion)
+		{
+			return false;
+		}
+		header.level = data[5];
+		header.players = data[6];
+		header.seed = Get(data + 8, 8);
+		header.stream = Get(data + 16, 8);
+		header.buildHash = (unsigned int) Get(data + 24, 4);
+		header.hashInterval = (unsigned short) Get(data + 28, 2);
+		header.ticks = (unsigned int) Get(data + 32, 4);
+		return header.players >= 1 && header.players <= kReplayPads;
+	}
+
+	const ReplayHeader& Header() const
+	{
+		return header;
+	}
+
+	Event Next(unsigned char buttons[kReplayPads], unsigned int& hash)
+	{
+		while(runLeft == 0)
+		{
+			if(pos == size)
+			{
+				return ticks == header.ticks ? kEnd : kBad;
+			}
+			RandomWord v;
+			if(!GetVarint(v))
+			{
+				return kBad;
+			}
+			if((v & 3) == kHash)
+			{
+				if(pos + 4 > size)
+				{
+					return kBad;
+				}
+				hash = (unsigned int) Get(data + pos, 4);
+				pos += 4;
+				return kHashCheck;
+			}
+			if((v & 3) != kRun || (v >> 6) == 0 || (v >> 6) > header.ticks - ticks)
+			{
+				return kBad;
+			}
+			for(int i = 0; i < kReplayPads; i++)
+			{
+				if(v & (4 << i))
+				{
+					if(pos == size)
+					{
+						return kBad;
+					}
+					held[i] = data[pos++];
+				}
+			}
+			runLeft = (unsigned int) (v >> 6);
+		}
+		runLeft--;
+		ticks++;
+		memcpy(buttons, held, sizeof(held));
+		return kTick;
+	}
+
+private:
+	bool GetVarint(RandomWord& v)
+	{
+		v = 0;
+		for(int shift = 0; shift < 64; shift += 7)
+		{
+			if(pos == size)
+			{
+				return false;
+			}
+			unsigned char b = data[pos++];
+			v |= (RandomWord) (b & 0x7f) << shift;
+			if(!(b & 0x80))
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
+	ReplayHeader header;
+	const unsigned char* data;
+	size_t size;
+	size_t pos;
+	unsigned char held[kReplayPads];
+	unsigned int runLeft;	// Ticks left in the current run
+	unsigned int ticks;		// Ticks handed out so far
+};
+
+#endif // REPLAY_H
@@ -0,0 +1,227 @@
+// MapLayoutBench.cpp
+//
+// Compares the row-major and 8x8 tiled map layouts from MapLayout.h on
+// big maps, using the access patterns the game has:
+//
+//   sweep     every cell in row order, probing its 8 neighbours (DoMonsters)
+//   scattered random cells, probing their 8 neighbours (monsters and
+//             arrows spread over a big map)
+//   columns   every cell in column order (View::DrawToTexture)
+//
+// Portable, so it builds without the DirectX SDK. From the dandy-c++
+// directory:
+//
+//   g++ -O2 -o MapLayoutBench bench/MapLayoutBench.cpp && ./MapLayoutBench
+//   cl /O2 /EHsc bench\MapLayoutBench.cpp && MapLayoutBench.exe
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <vector>
+
+#include "../MapLayout.h"
+
+static const int kOffsets[8][2] =
+{
+	{0,-1},{1,-1},{1,0},{1,1},{0,1},{-1,1},{-1,0},{-1,-1}
+};
+
+static unsigned long gRandom = 12345;
+
+static unsigned long Random()
+{
+	// Numerical Recipes LCG; good enough for picking cells
+	gRandom = gRandom * 1664525 + 1013904223;
+	return gRandom >> 8;
+}
+
+template <class Layout>
+class BenchMap
+{
+public:
+	BenchMap(unsigned long width, unsigned long height)
+	{
+		this->width = width;
+		this->height = height;
+		layout.Init(width, height);
+		cells.resize(layout.size);
+	}
+
+	unsigned char Get(unsigned long x, unsigned long y) const
+	{
+		return cells[layout.Index(x, y)];
+	}
+
+	void Set(unsigned long x, unsigned long y, unsigned char v)
+	{
+		cells[layout.Index(x, y)] = v;
+	}
+
+	unsigned long width;
+	unsigned long height;
+	Layout layout;
+	std::vector<unsigned char> cells;
+};
+
+// Same contents in every layout: walls round the edge, then mostly space
+// and wall with the odd monster, like the real levels.
+template <class Layout>
+static void Fill(BenchMap<Layout>& map)
+{
+	gRandom = 12345;
+	for(unsigned long y = 0; y < map.height; y++)
+	{
+		for(unsigned long x = 0; x < map.width; x++)
+		{
+			unsigned char v = 1;
+			if(x > 0 && y > 0 && x < map.width - 1 && y < map.height - 1)
+			{
+				unsigned long r = Random() % 100;
+				v = (unsigned char) (r < 60 ? 0 : r < 90 ? 1 : 9 + r % 3);
+			}
+			map.Set(x, y, v);
+		}
+	}
+}
+
+template <class Layout>
+static unsigned long ProbeNeighbours(const BenchMap<Layout>& map, unsigned long x, unsigned long y)
+{
+	unsigned long spaces = 0;
+	for(int dir = 0; dir < 8; dir++)
+	{
+		spaces += map.Get(x + kOffsets[dir][0], y + kOffsets[dir][1]) == 0;
+	}
+	return spaces;
+}
+
+template <class Layout>
+static unsigned long Sweep(const BenchMap<Layout>& map)
+{
+	unsigned long sum = 0;
+	for(unsigned long y = 1; y < map.height - 1; y++)
+	{
+		for(unsigned long x = 1; x < map.width - 1; x++)
+		{
+			if(map.Get(x, y) >= 9)
+			{
+				sum += ProbeNeighbours(map, x, y);
+			}
+		}
+	}
+	return sum;
+}
+
+template <class Layout>
+static unsigned long Scattered(const BenchMap<Layout>& map, const std::vector<unsigned long>& points)
+{
+	unsigned long sum = 0;
+	for(size_t i = 0; i < points.size(); i += 2)
+	{
+		sum += ProbeNeighbours(map, points[i], points[i + 1]);
+	}
+	return sum;
+}
+
+template <class Layout>
+static unsigned long Columns(const BenchMap<Layout>& map)
+{
+	unsigned long sum = 0;
+	for(unsigned long x = 0; x < map.width; x++)
+	{
+		for(unsigned long y = 0; y < map.height; y++)
+		{
+			sum += map.Get(x, y);
+		}
+	}
+	return sum;
+}
+
+static double Seconds()
+{
+	return (double) clock() / CLOCKS_PER_SEC;
+}
+
+struct Result
+{
+	double sweep;		// ns per cell
+	double scattered;	// ns per probe
+	double columns;		// ns per cell
+	unsigned long check;
+};
+
+template <class Layout>
+static Result Run(unsigned long size, const std::vector<unsigned long>& points, int passes)
+{
+	BenchMap<Layout> map(size, size);
+	Fill(map);
+
+	Result r;
+	unsigned long check = 0;
+	double cells = (double) size * size * passes;
+
+	double start = Seconds();
+	for(int pass = 0; pass < passes; pass++)
+	{
+		check += Sweep(map);
+	}
+	r.sweep = (Seconds() - start) * 1e9 / cells;
+
+	// The point list is the same length whatever the map size
+	const int kScatteredPasses = 4;
+	start = Seconds();
+	for(int pass = 0; pass < kScatteredPasses; pass++)
+	{
+		check += Scattered(map, points);
+	}
+	r.scattered = (Seconds() - start) * 1e9 / ((double) points.size() / 2 * kScatteredPasses);
+
+	start = Seconds();
+	for(int pass = 0; pass < passes; pass++)
+	{
+		check += Columns(map);
+	}
+	r.columns = (Seconds() - start) * 1e9 / cells;
+
+	r.check = check;
+	return r;
+}
+
+int main(int argc, char** argv)
+{
+	static const unsigned long kSizes[] = { 60, 1024, 4096 };
+	static const int kNumSizes = sizeof(kSizes) / sizeof(kSizes[0]);
+	static const unsigned long kNumPoints = 1 << 20;
+
+	printf("%6s  %-9s %12s %15s %12s\n", "size", "layout", "sweep ns/cell", "scattered ns/probe", "columns ns/cell");
+	for(int i = 0; i < kNumSizes; i++)
+	{
+		unsigned long size = kSizes[i];
+		int passes = (int) (4096UL * 4096UL / (size * size));
+		if(passes < 1)
+		{
+			passes = 1;
+		}
+
+		std::vector<unsigned long> points;
+		gRandom = 54321;
+		for(unsigned long p = 0; p < kNumPoints; p++)
+		{
+			points.push_back(1 + Random() % (size - 2));
+			points.push_back(1 + Random() % (size - 2));
+		}
+
+		Result rowMajor = Run<RowMajorLayout>(size, points, passes);
+		Result tiled = Run<TiledLayout>(size, points, passes);
+		if(rowMajor.check != tiled.check)
+		{
+			printf("Layouts disagree on a %lux%lu map\n", size, size);
+			return 1;
+		}
+		printf("%6lu  %-9s %12.2f %15.2f %12.2f\n", size, "row-major",
+			rowMajor.sweep, rowMajor.scattered, rowMajor.columns);
+		printf("%6lu  %-9s %12.2f %15.2f %12.2f\n", size, "tiled 8x8",
+			tiled.sweep, tiled.scattered, tiled.columns);
+	}
+	return 0;
+}
@@ -0,0 +1,133 @@
+// UnpackBench.cpp
+//
+// Compares LevelUnpack against the original nibble-at-a-time loop from
+// Map::LoadLevel, over all 26 levels. Portable, so it builds without the
+// DirectX SDK. From the dandy-c++ directory:
+//
+//   g++ -O2 -o UnpackBench bench/UnpackBench.cpp && ./UnpackBench
+//   g++ -O2 -mavx2 -o UnpackBench bench/UnpackBench.cpp && ./UnpackBench
+//   cl /O2 /EHsc bench\UnpackBench.cpp && UnpackBench.exe
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "../LevelUnpack.h"
+
+static const int kWidth = 60;
+static const int kHeight = 30;
+static const int kNumCells = kWidth * kHeight;
+static const int kPackedSize = kNumCells / 2;
+static const int kNumLevels = 26;
+
+static unsigned char gPacked[kNumLevels][kPackedSize];
+
+// The loop Map::LoadLevel used before LevelUnpack, minus the fgetc.
+static void UnpackOriginal(unsigned char* cell, const unsigned char* packed)
+{
+	for(int y = 0; y < kHeight; y++)
+	{
+		for(int x = 0; x < kWidth; x += 2)
+		{
+			int inb = *packed++;
+			cell[y*kWidth+x] = (unsigned char) (inb & 0xf);
+			cell[y*kWidth+x+1] = (unsigned char) ((inb >> 4) & 0xf);
+		}
+	}
+}
+
+static void UnpackKernel(unsigned char* cell, const unsigned char* packed)
+{
+	LevelUnpack(cell, packed, kHeight);
+}
+
+static bool LoadLevels()
+{
+	for(int i = 0; i < kNumLevels; i++)
+	{
+		char fileName[64];
+		sprintf(fileName, "levels/level.%c", i + 'a');
+		FILE* in = fopen(fileName, "rb");
+		if(!in)
+		{
+			sprintf(fileName, "../levels/level.%c", i + 'a');
+			in = fopen(fileName, "rb");
+		}
+		if(!in)
+		{
+			printf("Could not open level.%c\n", i + 'a');
+			return false;
+		}
+		size_t read = fread(gPacked[i], 1, kPackedSize, in);
+		fclose(in);
+		if(read != (size_t) kPackedSize)
+		{
+			printf("level.%c is too short\n", i + 'a');
+			return false;
+		}
+	}
+	return true;
+}
+
+static double Seconds()
+{
+	return (double) clock() / CLOCKS_PER_SEC;
+}
+
+// Returns ns per level. sink keeps the compiler from dropping the work.
+static double Time(void (*unpack)(unsigned char*, const unsigned char*), int passes, unsigned& sink)
+{
+	static unsigned char cells[kNumCells];
+	double start = Seconds();
+	for(int pass = 0; pass < passes; pass++)
+	{
+		for(int i = 0; i < kNumLevels; i++)
+		{
+			unpack(cells, gPacked[i]);
+			sink += cells[(pass + i) % kNumCells];
+		}
+	}
+	double elapsed = Seconds() - start;
+	return elapsed * 1e9 / ((double) passes * kNumLevels);
+}
+
+int main(int argc, char** argv)
+{
+	if(!LoadLevels())
+	{
+		return 1;
+	}
+
+	for(int i = 0; i < kNumLevels; i++)
+	{
+		unsigned char a[kNumCells];
+		unsigned char b[kNumCells];
+		UnpackOriginal(a, gPacked[i]);
+		UnpackKernel(b, gPacked[i]);
+		if(memcmp(a, b, kNumCells) != 0)
+		{
+			printf("Mismatch on level %c\n", i + 'a');
+			return 1;
+		}
+	}
+
+	const char* path = "scalar";
+#if defined(LEVEL_UNPACK_AVX2)
+	path = "AVX2";
+#elif defined(LEVEL_UNPACK_SSE2)
+	path = "SSE2";
+#elif defined(LEVEL_UNPACK_NEON)
+	path = "NEON";
+#endif
+
+	int passes = 20000;
+	unsigned sink = 0;
+	double original = Time(UnpackOriginal, passes, sink);
+	double kernel = Time(UnpackKernel, passes, sink);
+
+	printf("All %d levels match.\n", kNumLevels);
+	printf("original loop: %8.1f ns/level\n", original);
+	printf("LevelUnpack (%s): %8.1f ns/level  (%.1fx)\n", path, kernel, original / kernel);
+	printf("(sink %u)\n", sink);
+	return 0;
+}
@@ -0,0 +1,159 @@
+import os
+
+# Paths
+current_dir = os.path.dirname(os.path.abspath(__file__))
+levels_dir = os.path.normpath(os.path.join(current_dir, "../levels"))
+output_header_path = os.path.normpath(os.path.join(current_dir, "../EmbeddedLevels.h"))
+
+# The levels are decoded here rather than by the compiler: VC++ 2003 has no
+# constexpr, and a table of one byte per cell lets Map::LoadLevel be a memcpy.
+NUM_LEVELS = 26
+WIDTH = 60
+HEIGHT = 30
+PACKED_LEVEL_SIZE = WIDTH * HEIGHT // 2
+
+
+def read_level(index):
+    path = os.path.join(levels_dir, "level.%c" % (ord("a") + index))
+    with open(path, "rb") as f:
+        data = f.read()
+    if len(data) != PACKED_LEVEL_SIZE:
+        raise ValueError(f"{path} is {len(data)} bytes, expected {PACKED_LEVEL_SIZE}")
+    return data
+
+
+def unpack(data):
+    # Two cells per byte, low nibble first, same as LevelUnpack.h
+    cells = []
+    for b in data:
+        cells.append(b & 0xF)
+        cells.append(b >> 4)
+    return cells
+
+
+# Tile values, as in the MapData enum
+LOCK = 2
+UP = 3
+KEY = 5
+MONSTERS = (9, 10, 11)
+GENERATORS = (13, 14, 15)
+
+
+def find_start(cells):
+    # First up staircase in row-major order, the same one Map::Find finds
+    for i, c in enumerate(cells):
+        if c == UP:
+            return i % WIDTH, i // WIDTH
+    raise ValueError("level has no up staircase")
+
+
+def find_lock_groups(cells):
+    # 8-way connected groups of locks, numbered by their first cell and each
+    # listed in row-major order, just like Map::FindLockGroups
+    group_of = {}
+    groups = []
+    for i, c in enumerate(cells):
+        if c != LOCK or i in group_of:
+            continue
+        group = []
+        stack = [i]
+        group_of[i] = len(groups)
+        while stack:
+            n = stack.pop()
+            group.append(n)
+            x, y = n % WIDTH, n // WIDTH
+            for dy in (-1, 0, 1):
+                for dx in (-1, 0, 1):
+                    nx, ny = x + dx, y + dy
+                    m = ny * WIDTH + nx
+                    if 0 <= nx < WIDTH and 0 <= ny < HEIGHT and cells[m] == LOCK and m not in group_of:
+                        group_of[m] = len(groups)
+                        stack.append(m)
+        groups.append(sorted(group))
+    return groups
+
+
+def write_table(lines, decl, items, per_line):
+    lines.append(decl)
+    lines.append("{")
+    for i in range(0, len(items), per_line):
+        lines.append("\t" + " ".join(items[i:i + per_line]))
+    lines.append("};")
+    lines.append("")
+
+
+def main():
+    print(f"Reading levels from {levels_dir}...")
+    lines = [
+        "// EmbeddedLevels.h",
+        "//",
+        "// Generated by tools/make_level_header.py from levels/level.a..z.",
+        "// Do not edit; change the level files and run the script again.",
+        "",
+        "#ifndef EMBEDDED_LEVELS_H",
+        "#define EMBEDDED_LEVELS_H",
+        "",
+        f"const static DWORD kEmbeddedLevelCount = {NUM_LEVELS};",
+        "",
+        f"static const BYTE kEmbeddedLevels[{NUM_LEVELS}][{WIDTH * HEIGHT}] =",
+        "{",
+    ]
+    entities = []
+    lock_starts = []
+    lock_cells = []
+    infos = []
+    for i in range(NUM_LEVELS):
+        cells = unpack(read_level(i))
+        name = f"level.{chr(ord('a') + i)}"
+        lines.append(f"\t// {name}")
+        lines.append("\t{")
+        for y in range(HEIGHT):
+            row = cells[y * WIDTH:(y + 1) * WIDTH]
+            lines.append("\t\t" + ",".join(str(c) for c in row) + ",")
+        lines.append("\t},")
+
+        up_x, up_y = find_start(cells)
+        first_entity = len(entities)
+        for n, c in enumerate(cells):
+            if c in MONSTERS or c in GENERATORS:
+                entities.append(f"{{{n % WIDTH},{n // WIDTH},{c}}},")
+        groups = find_lock_groups(cells)
+        first_group = len(lock_starts)
+        for group in groups:
+            lock_starts.append(f"{len(lock_cells)},")
+            lock_cells += [f"{n}," for n in group]
+        lock_starts.append(f"{len(lock_cells)},")
+        counts = [sum(cells.count(t) for t in MONSTERS), sum(cells.count(t) for t in GENERATORS),
+                  cells.count(KEY), cells.count(LOCK)]
+        infos.append(f"\t{{ {up_x}, {up_y}, {', '.join(map(str, counts))}, "
+                     f"kEmbeddedEntities + {first_entity}, {len(entities) - first_entity}, "
+                     f"kEmbeddedLockGroupStart + {first_group}, {len(groups)}, "
+                     f"kEmbeddedLockCells }}, // {name}")
+    lines += [
+        "};",
+        "",
+        "// The monsters and generators of every level, each level's in row-major order",
+    ]
+    write_table(lines, f"static const LevelEntity kEmbeddedEntities[{len(entities)}] =", entities, 12)
+    lines.append("// Where each lock group starts in kEmbeddedLockCells, plus an end per level")
+    write_table(lines, f"static const WORD kEmbeddedLockGroupStart[{len(lock_starts)}] =", lock_starts, 16)
+    lines.append("// Lock cells as y * 60 + x, group by group")
+    write_table(lines, f"static const WORD kEmbeddedLockCells[{len(lock_cells)}] =", lock_cells, 16)
+    lines += [
+        "// Start, monsters, generators, keys, locks, entities, lock groups",
+        f"static const LevelInfo kEmbeddedLevelInfo[{NUM_LEVELS}] =",
+        "{",
+    ] + infos + [
+        "};",
+        "",
+        "#endif // EMBEDDED_LEVELS_H",
+        "",
+    ]
+
+    print(f"Writing {NUM_LEVELS} levels to {output_header_path}...")
+    with open(output_header_path, "w", newline="\n") as f:
+        f.write("\n".join(lines))
+
+
+if __name__ == "__main__":
+    main()
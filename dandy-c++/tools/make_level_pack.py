@@ -0,0 +1,56 @@
+import os
+import struct
+import zlib
+
+# Paths
+current_dir = os.path.dirname(os.path.abspath(__file__))
+levels_dir = os.path.normpath(os.path.join(current_dir, "../levels"))
+output_pack_path = os.path.join(levels_dir, "levels.pak")
+
+# Pack layout (all fields little-endian DWORDs, matching LevelPack in Dandy.cpp):
+#   header:  magic "DPAK", version, level count
+#   entries: one (offset, size, adler32) triple per level, offsets from start of file
+#   data:    the 4-bit packed levels, back to back
+PACK_MAGIC = b"DPAK"
+PACK_VERSION = 1
+NUM_LEVELS = 26
+PACKED_LEVEL_SIZE = 60 * 30 // 2
+
+HEADER_FORMAT = "<4sII"
+ENTRY_FORMAT = "<III"
+
+
+def read_levels():
+    levels = []
+    for i in range(NUM_LEVELS):
+        path = os.path.join(levels_dir, "level.%c" % (ord("a") + i))
+        with open(path, "rb") as f:
+            data = f.read()
+        if len(data) != PACKED_LEVEL_SIZE:
+            raise ValueError(f"{path} is {len(data)} bytes, expected {PACKED_LEVEL_SIZE}")
+        levels.append(data)
+    return levels
+
+
+def main():
+    print(f"Reading levels from {levels_dir}...")
+    levels = read_levels()
+
+    data_offset = struct.calcsize(HEADER_FORMAT) + struct.calcsize(ENTRY_FORMAT) * len(levels)
+
+    header = struct.pack(HEADER_FORMAT, PACK_MAGIC, PACK_VERSION, len(levels))
+    entries = []
+    offset = data_offset
+    for data in levels:
+        entries.append(struct.pack(ENTRY_FORMAT, offset, len(data), zlib.adler32(data) & 0xFFFFFFFF))
+        offset += len(data)
+
+    print(f"Writing {len(levels)} levels ({offset} bytes) to {output_pack_path}...")
+    with open(output_pack_path, "wb") as f:
+        f.write(header)
+        f.write(b"".join(entries))
+        f.write(b"".join(levels))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,237 @@
+/*
+ * Batch runner CLI: plays a batch of headless games on every core and
+ * reports games/sec (see batch_runner.h).
+ *
+ *   batch_runner [-t threads] [-n games] [-k ticks] [-p players] [-g] [-v]
+ *   batch_runner [-t threads] [-g] [-v] -f jobs.txt
+ *
+ * Without -f it makes n jobs: job i starts on level i % 26 with generator
+ * seed i + 1 and random inputs seeded with i + 1. A job file has one job
+ * per line, '#' starting a comment:
+ *
+ *   seed level players ticks input
+ *
+ * where input is "idle", "random:<seed>", or the path of a recording with
+ * MAX_PLAYERS button bytes per tick. -g stops each game at its first game
+ * over. -v prints one line per game, in job order, so the output of two
+ * runs can be compared whatever the thread counts.
+ *
+ * Run from the dandy-gb directory:
+ *
+ *   make batch
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "batch_runner.h"
+
+#define DEFAULT_GAMES    1024
+#define DEFAULT_TICKS    3600 // One minute at 60 Hz
+#define MAX_RECORDINGS   64
+
+typedef struct {
+    char path[256];
+    uint8_t* data;
+    uint32_t num_ticks;
+} Recording;
+
+static Recording recordings[MAX_RECORDINGS];
+static uint32_t num_recordings;
+
+// Each recording is loaded once and shared by every job that names it
+static const Recording* load_recording(const char* path) {
+    for (uint32_t i = 0; i < num_recordings; ++i) {
+        if (strcmp(recordings[i].path, path) == 0) {
+            return &recordings[i];
+        }
+    }
+    if (num_recordings == MAX_RECORDINGS || strlen(path) >= sizeof(recordings[0].path)) {
+        return NULL;
+    }
+    FILE* f = fopen(path, "rb");
+    if (!f) {
+        return NULL;
+    }
+    fseek(f, 0, SEEK_END);
+    long size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    Recording* rec = &recordings[num_recordings];
+    rec->data = (uint8_t*)malloc(size > 0 ? (size_t)size : 1);
+    if (!rec->data || size < 0 || fread(rec->data, 1, (size_t)size, f) != (size_t)size) {
+        free(rec->data);
+        fclose(f);
+        return NULL;
+    }
+    fclose(f);
+    strcpy(rec->path, path);
+    rec->num_ticks = (uint32_t)(size / MAX_PLAYERS);
+    num_recordings++;
+    return rec;
+}
+
+static BatchJob* read_job_file(const char* path, uint32_t* num_jobs) {
+    FILE* f = fopen(path, "r");
+    if (!f) {
+        fprintf(stderr, "Can't open %s\n", path);
+        return NULL;
+    }
+    uint32_t capacity = 256;
+    uint32_t count = 0;
+    BatchJob* jobs = (BatchJob*)malloc(sizeof(BatchJob) * capacity);
+    char line[512];
+    uint32_t line_no = 0;
+    while (jobs && fgets(line, sizeof(line), f)) {
+        line_no++;
+        char* hash = strchr(line, '#');
+        if (hash) {
+            *hash = '\0';
+        }
+        unsigned seed, level, players, ticks;
+        char input[300];
+        int fields = sscanf(line, "%u %u %u %u %299s", &seed, &level, &players, &ticks, input);
+        if (fields <= 0) {
+            continue;
+        }
+        if (fields != 5 || level >= DANDY_NUM_LEVELS || players < 1 || players > MAX_PLAYERS) {
+            fprintf(stderr, "%s:%u: expected 'seed level players ticks input'\n", path, line_no);
+            free(jobs);
+            jobs = NULL;
+            break;
+        }
+        if (count == capacity) {
+            capacity *= 2;
+            BatchJob* grown = (BatchJob*)realloc(jobs, sizeof(BatchJob) * capacity);
+            if (!grown) {
+                free(jobs);
+                jobs = NULL;
+                break;
+            }
+            jobs = grown;
+        }
+        BatchJob* job = &jobs[count];
+        memset(job, 0, sizeof(*job));
+        job->seed = (uint16_t)seed;
+        job->level = (uint8_t)level;
+        job->players = (uint8_t)players;
+        job->ticks = ticks;
+        if (strcmp(input, "idle") == 0) {
+            job->input.kind = BATCH_INPUT_IDLE;
+        } else if (strncmp(input, "random:", 7) == 0) {
+            job->input.kind = BATCH_INPUT_RANDOM;
+            job->input.seed = (uint32_t)strtoul(input + 7, NULL, 0);
+        } else {
+            const Recording* rec = load_recording(input);
+            if (!rec) {
+                fprintf(stderr, "%s:%u: can't load recording %s\n", path, line_no, input);
+                free(jobs);
+                jobs = NULL;
+                break;
+            }
+            job->input.kind = BATCH_INPUT_RECORDED;
+            job->input.data = rec->data;
+            job->input.num_ticks = rec->num_ticks;
+        }
+        count++;
+    }
+    fclose(f);
+    *num_jobs = count;
+    return jobs;
+}
+
+static void usage(void) {
+    fprintf(stderr,
+        "usage: batch_runner [-t threads] [-n games] [-k ticks] [-p players] [-g] [-v]\n"
+        "       batch_runner [-t threads] [-g] [-v] -f jobs.txt\n");
+}
+
+int main(int argc, char** argv) {
+    uint32_t threads = 0;
+    uint32_t games = DEFAULT_GAMES;
+    uint32_t ticks = DEFAULT_TICKS;
+    uint32_t players = 1;
+    bool stop_at_game_over = false;
+    bool verbose = false;
+    const char* job_file = NULL;
+    int opt;
+    while ((opt = getopt(argc, argv, "t:n:k:p:f:gv")) != -1) {
+        switch (opt) {
+        case 't': threads = (uint32_t)strtoul(optarg, NULL, 0); break;
+        case 'n': games = (uint32_t)strtoul(optarg, NULL, 0); break;
+        case 'k': ticks = (uint32_t)strtoul(optarg, NULL, 0); break;
+        case 'p': players = (uint32_t)strtoul(optarg, NULL, 0); break;
+        case 'f': job_file = optarg; break;
+        case 'g': stop_at_game_over = true; break;
+        case 'v': verbose = true; break;
+        default: usage(); return 2;
+        }
+    }
+    if (players < 1 || players > MAX_PLAYERS) {
+        usage();
+        return 2;
+    }
+
+    BatchJob* jobs;
+    uint32_t num_jobs;
+    if (job_file) {
+        jobs = read_job_file(job_file, &num_jobs);
+        if (!jobs) {
+            return 1;
+        }
+    } else {
+        num_jobs = games;
+        jobs = (BatchJob*)calloc(num_jobs ? num_jobs : 1, sizeof(BatchJob));
+        if (!jobs) {
+            return 1;
+        }
+        for (uint32_t i = 0; i < num_jobs; ++i) {
+            jobs[i].seed = (uint16_t)(i + 1);
+            jobs[i].level = (uint8_t)(i % DANDY_NUM_LEVELS);
+            jobs[i].players = (uint8_t)players;
+            jobs[i].ticks = ticks;
+            jobs[i].input.kind = BATCH_INPUT_RANDOM;
+            jobs[i].input.seed = i + 1;
+        }
+    }
+    for (uint32_t i = 0; i < num_jobs; ++i) {
+        jobs[i].stop_at_game_over = stop_at_game_over;
+    }
+
+    BatchResult* results = (BatchResult*)calloc(num_jobs ? num_jobs : 1, sizeof(BatchResult));
+    BatchStats stats;
+    if (!results || batch_run(jobs, results, num_jobs, threads, &stats) != 0) {
+        fprintf(stderr, "Out of memory\n");
+        return 1;
+    }
+
+    if (verbose) {
+        printf("# job seed level players ticks final max deaths warps game_overs scores hash\n");
+        for (uint32_t i = 0; i < num_jobs; ++i) {
+            const BatchResult* r = &results[i];
+            printf("%u %u %u %u %u %u %u %u %u %u %u,%u,%u,%u %08x\n",
+                   i, jobs[i].seed, jobs[i].level, jobs[i].players, r->ticks,
+                   r->final_level, r->max_level, r->deaths, r->warps, r->game_overs,
+                   r->score[0], r->score[1], r->score[2], r->score[3], r->state_hash);
+        }
+    }
+
+    uint32_t deaths = 0;
+    uint32_t game_overs = 0;
+    for (uint32_t i = 0; i < num_jobs; ++i) {
+        deaths += results[i].deaths;
+        game_overs += results[i].game_overs;
+    }
+    double seconds = stats.seconds > 0 ? stats.seconds : 1e-9;
+    printf("%u games, %llu ticks on %u threads in %.3f s: %.1f games/s, %.0f ticks/s "
+           "(%u steals, %u deaths, %u game overs)\n",
+           num_jobs, (unsigned long long)stats.ticks, stats.threads, stats.seconds,
+           num_jobs / seconds, stats.ticks / seconds, stats.steals, deaths, game_overs);
+
+    free(results);
+    free(jobs);
+    for (uint32_t i = 0; i < num_recordings; ++i) {
+        free(recordings[i].data);
+    }
+    return 0;
+}
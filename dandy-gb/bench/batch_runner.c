@@ -0,0 +1,317 @@
+/*
+ * Batch runner: see batch_runner.h.
+ *
+ * This file is also the HAL for the games it runs. Nothing is drawn; the
+ * sound hook counts deaths and stair warps for the game's result.
+ */
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "batch_runner.h"
+
+#ifdef DANDY_SINGLE_CONTEXT
+#error "The batch runner needs one DandyContext per game; build without DANDY_SINGLE_CONTEXT"
+#endif
+
+#define BATCH_CACHE_LINE 64
+
+/* --- One game --- */
+
+typedef struct {
+    DandyContext ctx;    // First, so the HAL can get from ctx to the game
+    uint16_t deaths;
+    uint16_t warps;
+} BatchGame;
+
+void hal_draw_tile(DANDY_CTX_ uint8_t x, uint8_t y, uint8_t tile_id) {
+    (void)ctx; (void)x; (void)y; (void)tile_id;
+}
+
+void hal_update_hud(DANDY_CTX) {
+    (void)ctx;
+}
+
+void hal_clear_sprites(DANDY_CTX_ uint8_t vp_left, uint8_t vp_top) {
+    (void)ctx; (void)vp_left; (void)vp_top;
+}
+
+void hal_set_sprite(DANDY_CTX_ uint8_t sprite_idx, uint8_t x, uint8_t y, uint8_t tile_id, uint8_t flags) {
+    (void)ctx; (void)sprite_idx; (void)x; (void)y; (void)tile_id; (void)flags;
+}
+
+void hal_play_sound(DANDY_CTX_ uint8_t sound_id) {
+    BatchGame* game = (BatchGame*)ctx;
+    if (sound_id == SOUND_DIE) {
+        game->deaths++;
+    } else if (sound_id == SOUND_WARP) {
+        game->warps++;
+    }
+}
+
+static const uint8_t random_combos[16] = {
+    0,
+    BUTTON_LEFT, BUTTON_RIGHT, BUTTON_UP, BUTTON_DOWN,
+    BUTTON_LEFT | BUTTON_UP, BUTTON_RIGHT | BUTTON_UP,
+    BUTTON_LEFT | BUTTON_DOWN, BUTTON_RIGHT | BUTTON_DOWN,
+    BUTTON_FIRE, BUTTON_LEFT | BUTTON_FIRE, BUTTON_RIGHT | BUTTON_FIRE,
+    BUTTON_UP | BUTTON_FIRE, BUTTON_DOWN | BUTTON_FIRE,
+    BUTTON_BOMB, BUTTON_FIRE | BUTTON_BOMB
+};
+
+void batch_random_inputs(uint32_t* state, uint8_t held[MAX_PLAYERS]) {
+    for (uint8_t p = 0; p < MAX_PLAYERS; ++p) {
+        uint32_t x = *state;
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+        *state = x;
+        if ((x & 15) == 0) {
+            held[p] = random_combos[(x >> 4) & 15];
+        }
+    }
+}
+
+static uint32_t fnv1a(uint32_t hash, const void* data, size_t size) {
+    const uint8_t* bytes = (const uint8_t*)data;
+    for (size_t i = 0; i < size; ++i) {
+        hash = (hash ^ bytes[i]) * 16777619u;
+    }
+    return hash;
+}
+
+static uint8_t alive_players(const DandyContext* ctx) {
+    uint8_t alive = 0;
+    for (uint8_t p = 0; p < MAX_PLAYERS; ++p) {
+        if (ctx->player_joined[p] && ctx->player_health[p] > 0) {
+            alive++;
+        }
+    }
+    return alive;
+}
+
+void batch_run_job(const BatchJob* job, BatchResult* result) {
+    BatchGame game;
+    DandyContext* ctx = &game.ctx;
+    uint8_t inputs[MAX_PLAYERS] = {0};
+    uint32_t random_state = job->input.seed ? job->input.seed : 1;
+
+    memset(result, 0, sizeof(*result));
+    dandy_init(ctx);
+    dandy_seed(ctx, job->seed);
+    // dandy_load_level leaves current_level alone; set it so the stairs
+    // lead on from the job's level
+    ctx->current_level = job->level < DANDY_NUM_LEVELS ? job->level : 0;
+    dandy_load_level(ctx, ctx->current_level);
+    for (uint8_t p = 1; p < job->players && p < MAX_PLAYERS; ++p) {
+        dandy_join_player(ctx, p);
+    }
+    game.deaths = 0;
+    game.warps = 0;
+    result->max_level = ctx->current_level;
+
+    uint32_t tick;
+    for (tick = 0; tick < job->ticks; ++tick) {
+        if (job->input.kind == BATCH_INPUT_RANDOM) {
+            batch_random_inputs(&random_state, inputs);
+        } else if (job->input.kind == BATCH_INPUT_RECORDED) {
+            if (tick < job->input.num_ticks) {
+                memcpy(inputs, job->input.data + tick * MAX_PLAYERS, MAX_PLAYERS);
+            } else {
+                memset(inputs, 0, sizeof(inputs));
+            }
+        }
+
+        // A step that kills every player left alive ends the game; the
+        // core resets to level 0 before returning, so count it here
+        uint8_t alive = alive_players(ctx);
+        uint16_t deaths = game.deaths;
+        dandy_step(ctx, inputs);
+        if (alive && game.deaths - deaths >= alive) {
+            result->game_overs++;
+            if (job->stop_at_game_over) {
+                ++tick;
+                break;
+            }
+        }
+        if (ctx->current_level > result->max_level) {
+            result->max_level = ctx->current_level;
+        }
+    }
+
+    result->ticks = tick;
+    result->final_level = ctx->current_level;
+    result->deaths = game.deaths;
+    result->warps = game.warps;
+    for (uint8_t p = 0; p < MAX_PLAYERS; ++p) {
+        result->health[p] = ctx->player_health[p];
+        result->score[p] = ctx->player_score[p];
+    }
+    uint32_t hash = 2166136261u;
+    hash = fnv1a(hash, ctx->map, sizeof(ctx->map));
+    hash = fnv1a(hash, &ctx->current_level, 1);
+    hash = fnv1a(hash, ctx->player_x, sizeof(ctx->player_x));
+    hash = fnv1a(hash, ctx->player_y, sizeof(ctx->player_y));
+    hash = fnv1a(hash, ctx->player_health, sizeof(ctx->player_health));
+    hash = fnv1a(hash, ctx->player_score, sizeof(ctx->player_score));
+    result->state_hash = hash;
+}
+
+/* --- Work-stealing pool --- */
+
+// A deque is a contiguous range of job indices, [head, tail). The owner
+// takes jobs from the tail, thieves take the front half. Jobs are whole
+// games, thousands of ticks each, so a mutex per deque costs nothing
+// measurable and keeps the pool simple.
+typedef struct {
+    pthread_mutex_t lock;
+    uint32_t head;
+    uint32_t tail;
+    uint32_t steals;
+    uint64_t ticks;
+    uint32_t index;
+    struct BatchPool* pool;
+} __attribute__((aligned(BATCH_CACHE_LINE))) BatchWorker;
+
+typedef struct BatchPool {
+    const BatchJob* jobs;
+    BatchResult* results;
+    BatchWorker* workers;
+    uint32_t num_workers;
+} BatchPool;
+
+static bool take_own(BatchWorker* worker, uint32_t* job) {
+    bool found = false;
+    pthread_mutex_lock(&worker->lock);
+    if (worker->head < worker->tail) {
+        *job = --worker->tail;
+        found = true;
+    }
+    pthread_mutex_unlock(&worker->lock);
+    return found;
+}
+
+// Moves the front half (rounded up) of a victim's jobs to thief, which is
+// empty. Jobs are never added once the batch starts, so a thief that
+// finds every deque empty can stop.
+static bool steal(BatchWorker* thief) {
+    BatchPool* pool = thief->pool;
+    for (uint32_t i = 1; i < pool->num_workers; ++i) {
+        BatchWorker* victim = &pool->workers[(thief->index + i) % pool->num_workers];
+        uint32_t head = 0;
+        uint32_t count = 0;
+        pthread_mutex_lock(&victim->lock);
+        if (victim->head < victim->tail) {
+            count = (victim->tail - victim->head + 1) / 2;
+            head = victim->head;
+            victim->head += count;
+        }
+        pthread_mutex_unlock(&victim->lock);
+        if (count) {
+            pthread_mutex_lock(&thief->lock);
+            thief->head = head;
+            thief->tail = head + count;
+            thief->steals++;
+            pthread_mutex_unlock(&thief->lock);
+            return true;
+        }
+    }
+    return false;
+}
+
+static void* worker_main(void* arg) {
+    BatchWorker* worker = (BatchWorker*)arg;
+    BatchPool* pool = worker->pool;
+    for (;;) {
+        uint32_t job;
+        if (!take_own(worker, &job)) {
+            if (!steal(worker)) {
+                break;
+            }
+            continue;
+        }
+        batch_run_job(&pool->jobs[job], &pool->results[job]);
+        worker->ticks += pool->results[job].ticks;
+    }
+    return NULL;
+}
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+int batch_run(const BatchJob* jobs, BatchResult* results, uint32_t num_jobs,
+              uint32_t num_threads, BatchStats* stats) {
+    if (num_threads == 0) {
+        long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+        num_threads = cpus > 0 ? (uint32_t)cpus : 1;
+    }
+    if (num_jobs && num_threads > num_jobs) {
+        num_threads = num_jobs;
+    }
+    if (num_threads == 0) {
+        num_threads = 1;
+    }
+
+    BatchPool pool;
+    pool.jobs = jobs;
+    pool.results = results;
+    pool.num_workers = num_threads;
+    pool.workers = (BatchWorker*)aligned_alloc(BATCH_CACHE_LINE, sizeof(BatchWorker) * num_threads);
+    pthread_t* threads = (pthread_t*)malloc(sizeof(pthread_t) * num_threads);
+    if (!pool.workers || !threads) {
+        free(pool.workers);
+        free(threads);
+        return -1;
+    }
+
+    // Contiguous slices to start with, so neighbouring jobs (often the same
+    // level) stay on one core until someone steals
+    for (uint32_t w = 0; w < num_threads; ++w) {
+        BatchWorker* worker = &pool.workers[w];
+        pthread_mutex_init(&worker->lock, NULL);
+        worker->head = (uint32_t)((uint64_t)num_jobs * w / num_threads);
+        worker->tail = (uint32_t)((uint64_t)num_jobs * (w + 1) / num_threads);
+        worker->steals = 0;
+        worker->ticks = 0;
+        worker->index = w;
+        worker->pool = &pool;
+    }
+
+    double start = now_seconds();
+    uint32_t started = 0;
+    for (uint32_t w = 1; w < num_threads; ++w) {
+        if (pthread_create(&threads[w], NULL, worker_main, &pool.workers[w]) != 0) {
+            break;
+        }
+        started = w;
+    }
+    // The calling thread is worker 0. If some threads failed to start,
+    // their slices are stolen like any others.
+    worker_main(&pool.workers[0]);
+    for (uint32_t w = 1; w <= started; ++w) {
+        pthread_join(threads[w], NULL);
+    }
+    double seconds = now_seconds() - start;
+
+    if (stats) {
+        stats->threads = started + 1;
+        stats->steals = 0;
+        stats->ticks = 0;
+        stats->seconds = seconds;
+        for (uint32_t w = 0; w < num_threads; ++w) {
+            stats->steals += pool.workers[w].steals;
+            stats->ticks += pool.workers[w].ticks;
+        }
+    }
+    for (uint32_t w = 0; w < num_threads; ++w) {
+        pthread_mutex_destroy(&pool.workers[w].lock);
+    }
+    free(pool.workers);
+    free(threads);
+    return 0;
+}
@@ -0,0 +1,77 @@
+/*
+ * Batch runner: plays many headless games across all cores.
+ *
+ * Each job is one game: a generator seed, a starting level, a number of
+ * players, a tick count and an input source. batch_run() spreads the jobs
+ * over a pool of threads, each of which owns one DandyContext and a deque
+ * of job indices. A thread whose deque runs dry steals half of another
+ * thread's remaining jobs, so a few long games at the end of one deque
+ * don't leave the other cores idle.
+ *
+ * Games don't share any state, so a job's result doesn't depend on the
+ * thread count or on which thread ran it.
+ */
+#ifndef BATCH_RUNNER_H
+#define BATCH_RUNNER_H
+
+#include <stdint.h>
+#include "dandy_core.h"
+
+typedef enum {
+    BATCH_INPUT_IDLE,     // No buttons pressed
+    BATCH_INPUT_RANDOM,   // batch_random_inputs() from input.seed
+    BATCH_INPUT_RECORDED  // MAX_PLAYERS bytes per tick from input.data
+} BatchInputKind;
+
+typedef struct {
+    BatchInputKind kind;
+    uint32_t seed;
+    // BATCH_INPUT_RECORDED: num_ticks ticks of MAX_PLAYERS button bytes,
+    // then no buttons. Shared read-only between jobs.
+    const uint8_t* data;
+    uint32_t num_ticks;
+} BatchInput;
+
+typedef struct {
+    uint16_t seed;       // Passed to dandy_seed
+    uint8_t level;
+    uint8_t players;     // 1 to MAX_PLAYERS, joined in order
+    uint32_t ticks;      // At most this many
+    bool stop_at_game_over;
+    BatchInput input;
+} BatchJob;
+
+typedef struct {
+    uint32_t ticks;
+    uint8_t final_level;
+    uint8_t max_level;   // Furthest level reached
+    uint16_t deaths;     // SOUND_DIE events
+    uint16_t warps;      // SOUND_WARP events (stairs)
+    uint16_t game_overs; // Every joined player dead; the core restarts at level 0
+    int16_t health[MAX_PLAYERS];
+    uint16_t score[MAX_PLAYERS];
+    uint32_t state_hash; // FNV-1a of the final map and player state
+} BatchResult;
+
+typedef struct {
+    uint32_t threads;
+    uint32_t steals;     // Successful steals, over all threads
+    uint64_t ticks;
+    double seconds;      // Wall time of the whole batch
+} BatchStats;
+
+// Runs every job, writing results[i] for jobs[i]. num_threads 0 means one
+// per online CPU. stats may be NULL. The calling thread is one of the
+// workers. Returns 0, or -1 if out of memory.
+int batch_run(const BatchJob* jobs, BatchResult* results, uint32_t num_jobs,
+              uint32_t num_threads, BatchStats* stats);
+
+// Runs one job on the calling thread
+void batch_run_job(const BatchJob* job, BatchResult* result);
+
+// The BATCH_INPUT_RANDOM source: each tick every player has a 1 in 16
+// chance of switching to a new button combination, which it then holds.
+// state is an xorshift32 word (seed it non-zero), held the current combos.
+void batch_random_inputs(uint32_t* state, uint8_t held[MAX_PLAYERS]);
+
+#endif // BATCH_RUNNER_H
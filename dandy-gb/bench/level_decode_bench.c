@@ -0,0 +1,297 @@
+/*
+ * Level decode benchmark.
+ *
+ * Decodes all 26 levels from each of the repo's level formats, many times
+ * over, and reports ns/level, bytes/level and TSC cycles/tile:
+ *
+ *   packed4  4-bit packed level.a..z from dandy-c++/levels (900 bytes each)
+ *   b2       Scheme B2 streams from src/levels.c, using the engine's decoder
+ *   js       the character grids in dandy-js/levels.js (1800 chars each)
+ *
+ * Before timing, every format is decoded once and checked against the JS
+ * grids, which are the source src/levels.c is generated from. A B2
+ * mismatch is an error. packed4 mismatches are reported, but not treated
+ * as errors, because the level files are a separate copy of the data and
+ * have drifted from levels.js in a few places.
+ *
+ * Run from the dandy-gb directory:
+ *
+ *   make bench_decode
+ *
+ * Built twice, once with the host's table decoder and once with
+ * -DDANDY_BITSERIAL_DECODER for the GameBoy's bit-serial decoder.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define BENCH_HAVE_TSC 1
+#endif
+
+/* decode_level_b2 is static, so pull the engine in directly. */
+#include "dandy_core.c"
+
+#define BENCH_PASSES       2000
+#define BENCH_NUM_FORMATS  3
+#define LEVEL_CELLS        (DANDY_LEVEL_WIDTH * DANDY_LEVEL_HEIGHT)
+
+static const char js_encoding[] = " *DudKF$i123mnop";
+
+static uint8_t packed4_levels[DANDY_NUM_LEVELS][LEVEL_CELLS / 2];
+static char js_levels[DANDY_NUM_LEVELS][LEVEL_CELLS];
+static uint8_t js_char_to_tile[256];
+static uint8_t reference_maps[DANDY_NUM_LEVELS][MAP_SIZE];
+static DandyContext bench_ctx;
+
+/* --- Decoders: each one writes a full 60x30 map into the padded bench_ctx.map --- */
+
+static void decode_packed4(uint8_t level_idx) {
+    const uint8_t* src = packed4_levels[level_idx];
+    uint8_t x;
+    uint8_t y;
+    memset(bench_ctx.map, TILE_WALL, MAP_SIZE);
+    for (y = 0; y < DANDY_LEVEL_HEIGHT; ++y) {
+        uint8_t* row = bench_ctx.map + MAP_POS(0, y);
+        for (x = 0; x < DANDY_LEVEL_WIDTH; x += 2) {
+            uint8_t b = *src++;
+            row[x] = b & 0x0F;
+            row[x + 1] = b >> 4;
+        }
+    }
+}
+
+static void decode_b2(uint8_t level_idx) {
+    /* Same as dandy_load_level, minus the player and arrow setup */
+    memset(bench_ctx.map, TILE_WALL, MAP_SIZE);
+    decode_level_b2(&bench_ctx, dandy_levels[level_idx], dandy_level_sizes[level_idx]);
+}
+
+static void decode_js(uint8_t level_idx) {
+    const char* src = js_levels[level_idx];
+    uint8_t x;
+    uint8_t y;
+    memset(bench_ctx.map, TILE_WALL, MAP_SIZE);
+    for (y = 0; y < DANDY_LEVEL_HEIGHT; ++y) {
+        uint8_t* row = bench_ctx.map + MAP_POS(0, y);
+        for (x = 0; x < DANDY_LEVEL_WIDTH; ++x) {
+            row[x] = js_char_to_tile[(uint8_t)*src++];
+        }
+    }
+}
+
+static uint16_t size_packed4(uint8_t level_idx) {
+    (void)level_idx;
+    return LEVEL_CELLS / 2;
+}
+
+static uint16_t size_b2(uint8_t level_idx) {
+    return dandy_level_sizes[level_idx];
+}
+
+static uint16_t size_js(uint8_t level_idx) {
+    (void)level_idx;
+    return LEVEL_CELLS;
+}
+
+typedef struct {
+    const char* name;
+    void (*decode)(uint8_t level_idx);
+    uint16_t (*size)(uint8_t level_idx);
+    bool must_match;
+} LevelFormat;
+
+static const LevelFormat formats[BENCH_NUM_FORMATS] = {
+    { "packed4", decode_packed4, size_packed4, false },
+    { "b2",      decode_b2,      size_b2,      true  },
+    { "js",      decode_js,      size_js,      true  },
+};
+
+/* --- Loading the source data --- */
+
+static bool load_packed4(void) {
+    char path[64];
+    uint8_t i;
+    for (i = 0; i < DANDY_NUM_LEVELS; ++i) {
+        FILE* f;
+        size_t got;
+        snprintf(path, sizeof(path), "../dandy-c++/levels/level.%c", 'a' + i);
+        f = fopen(path, "rb");
+        if (!f) {
+            fprintf(stderr, "Could not open %s\n", path);
+            return false;
+        }
+        got = fread(packed4_levels[i], 1, sizeof(packed4_levels[i]), f);
+        fclose(f);
+        if (got != sizeof(packed4_levels[i])) {
+            fprintf(stderr, "%s is too short\n", path);
+            return false;
+        }
+    }
+    return true;
+}
+
+/* Pulls the 60-character quoted rows out of levels.js, like convert_levels.py */
+static bool load_js(void) {
+    FILE* f = fopen("../dandy-js/levels.js", "rb");
+    char* text;
+    long length;
+    long pos;
+    uint16_t rows = 0;
+    uint16_t i;
+
+    if (!f) {
+        fprintf(stderr, "Could not open ../dandy-js/levels.js\n");
+        return false;
+    }
+    fseek(f, 0, SEEK_END);
+    length = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    text = (char*)malloc((size_t)length + 1);
+    if (!text || fread(text, 1, (size_t)length, f) != (size_t)length) {
+        fclose(f);
+        free(text);
+        return false;
+    }
+    fclose(f);
+    text[length] = '\0';
+
+    for (pos = 0; pos < length && rows < DANDY_NUM_LEVELS * DANDY_LEVEL_HEIGHT; ++pos) {
+        if (text[pos] == '"') {
+            char* end = strchr(text + pos + 1, '"');
+            if (!end) {
+                break;
+            }
+            if (end - (text + pos + 1) == DANDY_LEVEL_WIDTH) {
+                memcpy(js_levels[rows / DANDY_LEVEL_HEIGHT] + (rows % DANDY_LEVEL_HEIGHT) * DANDY_LEVEL_WIDTH,
+                       text + pos + 1, DANDY_LEVEL_WIDTH);
+                rows++;
+            }
+            pos = end - text;
+        }
+    }
+    free(text);
+
+    if (rows != DANDY_NUM_LEVELS * DANDY_LEVEL_HEIGHT) {
+        fprintf(stderr, "levels.js has %u level rows, expected %u\n",
+                rows, DANDY_NUM_LEVELS * DANDY_LEVEL_HEIGHT);
+        return false;
+    }
+
+    memset(js_char_to_tile, TILE_SPACE, sizeof(js_char_to_tile));
+    for (i = 0; i < sizeof(js_encoding) - 1; ++i) {
+        js_char_to_tile[(uint8_t)js_encoding[i]] = (uint8_t)i;
+    }
+    return true;
+}
+
+/* --- Verification and timing --- */
+
+static bool verify_formats(void) {
+    bool ok = true;
+    uint8_t f;
+    uint8_t i;
+
+    for (i = 0; i < DANDY_NUM_LEVELS; ++i) {
+        decode_js(i);
+        memcpy(reference_maps[i], bench_ctx.map, MAP_SIZE);
+    }
+
+    for (f = 0; f < BENCH_NUM_FORMATS; ++f) {
+        for (i = 0; i < DANDY_NUM_LEVELS; ++i) {
+            uint16_t diffs = 0;
+            uint16_t t;
+            formats[f].decode(i);
+            for (t = 0; t < MAP_SIZE; ++t) {
+                if (bench_ctx.map[t] != reference_maps[i][t]) {
+                    diffs++;
+                }
+            }
+            if (diffs) {
+                printf("%s: level %c differs from levels.js in %u tiles%s\n",
+                       formats[f].name, 'a' + i, diffs,
+                       formats[f].must_match ? " (decoder error)" : " (source data differs)");
+                if (formats[f].must_match) {
+                    ok = false;
+                }
+            }
+        }
+    }
+    return ok;
+}
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static uint64_t now_cycles(void) {
+#ifdef BENCH_HAVE_TSC
+    return __rdtsc();
+#else
+    return 0;
+#endif
+}
+
+static void time_format(const LevelFormat* format, unsigned* sink) {
+    uint32_t total_bytes = 0;
+    double start_ns;
+    double elapsed_ns;
+    uint64_t start_cycles;
+    uint64_t elapsed_cycles;
+    double levels = (double)BENCH_PASSES * DANDY_NUM_LEVELS;
+    uint16_t pass;
+    uint8_t i;
+
+    for (i = 0; i < DANDY_NUM_LEVELS; ++i) {
+        total_bytes += format->size(i);
+    }
+
+    start_ns = now_ns();
+    start_cycles = now_cycles();
+    for (pass = 0; pass < BENCH_PASSES; ++pass) {
+        for (i = 0; i < DANDY_NUM_LEVELS; ++i) {
+            format->decode(i);
+            *sink += bench_ctx.map[(pass + i) % MAP_SIZE];
+        }
+    }
+    elapsed_cycles = now_cycles() - start_cycles;
+    elapsed_ns = now_ns() - start_ns;
+
+    printf("%-8s %10.1f %12.1f", format->name, elapsed_ns / levels,
+           (double)total_bytes / DANDY_NUM_LEVELS);
+#ifdef BENCH_HAVE_TSC
+    printf(" %14.3f\n", (double)elapsed_cycles / (levels * LEVEL_CELLS));
+#else
+    (void)elapsed_cycles;
+    printf(" %14s\n", "n/a");
+#endif
+}
+
+int main(void) {
+    unsigned sink = 0;
+    uint8_t f;
+
+    if (!load_packed4() || !load_js()) {
+        return 1;
+    }
+    if (!verify_formats()) {
+        return 1;
+    }
+
+#ifdef DANDY_TABLE_DECODER
+    printf("B2 decoder: table-driven (host)\n");
+#else
+    printf("B2 decoder: bit-serial (GameBoy)\n");
+#endif
+    printf("%d levels x %d passes\n\n", DANDY_NUM_LEVELS, BENCH_PASSES);
+    printf("%-8s %10s %12s %14s\n", "format", "ns/level", "bytes/level", "cycles/tile");
+    for (f = 0; f < BENCH_NUM_FORMATS; ++f) {
+        time_format(&formats[f], &sink);
+    }
+    printf("\n(sink %u)\n", sink);
+    return 0;
+}
@@ -0,0 +1,583 @@
+/*
+ * Experimental lockstep engine: see lockstep.h.
+ *
+ * A tick runs in the same phases as dandy_step, each phase across a block
+ * of LOCKSTEP_WIDTH games before the next:
+ *
+ *   1. clamp player positions                      vector
+ *   2. for each player: decode buttons, fire,      vector
+ *      turn, move timers; then bombs, map writes   per game
+ *      and moves
+ *   3. arrow steps and viewport checks; then the   vector, per game
+ *      map side of every arrow
+ *   4. camera viewports; then monsters and         vector, per game
+ *      generators
+ *   5. game over check; then end_game              vector, per game
+ *
+ * Within a game the core's order is kept exactly: a phase's vector part
+ * only computes things the per-game part before it can't change (player 1
+ * reaching the stairs moves player 2, so phase 2 runs player by player).
+ * The per-game parts are the core's own functions (player_events,
+ * move_arrow, move_visible_monsters and end_game, which dandy_step reaches
+ * the same way), run on the game's DandyContext, where the rest of its
+ * state (map, entity masks, RNG, door groups) lives. The context's player
+ * fields are kept equal to the lanes, except move timers and old buttons,
+ * which only the vector parts use: a vector part only changes a player's
+ * fields when it hands that player to a per-game part, which copies them
+ * in first, and each per-game part copies back what the core can change.
+ */
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__AVX2__)
+#define LOCKSTEP_AVX2 1
+#include <immintrin.h>
+#endif
+
+#include "lockstep.h"
+
+/* The per-game paths call the core's private helpers, so pull it in */
+#include "dandy_core.c"
+
+#ifdef DANDY_SINGLE_CONTEXT
+#error "The lockstep engine needs one DandyContext per game; build without DANDY_SINGLE_CONTEXT"
+#endif
+
+#define LOCKSTEP_ALIGN 32
+
+/* Per-arrow events from the vector half of phase 3 */
+#define ARROW_ACTIVE 1
+#define ARROW_OUT    2 // Leaves its player's viewport
+
+/* Lane-interleaved fields: field[p * lanes + game] */
+enum {
+    F_JOINED, F_X, F_Y, F_HEALTH, F_SCORE, F_BOMBS, F_KEYS, F_DIR, F_TIMER,
+    F_OLD_BUTTONS, F_ARROW_X, F_ARROW_Y, F_ARROW_DIR,
+    F_BUTTONS, F_VP_LEFT, F_VP_TOP, F_ARROW_NX, F_ARROW_NY, F_ARROW_EVENTS,
+    F_COUNT
+};
+
+struct DandyLockstep {
+    uint32_t games;
+    uint32_t lanes;       // games rounded up to LOCKSTEP_WIDTH
+    DandyContext* ctx;    // One per game
+    uint8_t* live;        // Put, so stepped
+    int16_t* block;       // All the lane fields, one allocation
+    int16_t* joined;
+    int16_t* x;
+    int16_t* y;
+    int16_t* health;
+    int16_t* score;       // uint16_t bits
+    int16_t* bombs;
+    int16_t* keys;
+    int16_t* dir;
+    int16_t* timer;
+    int16_t* old_buttons;
+    int16_t* arrow_x;
+    int16_t* arrow_y;
+    int16_t* arrow_dir;
+    int16_t* buttons;     // This tick's inputs
+    int16_t* vp_left;     // Camera viewports, for the monsters
+    int16_t* vp_top;
+    int16_t* arrow_nx;    // Where each arrow is headed
+    int16_t* arrow_ny;
+    int16_t* arrow_events;
+    int16_t* events;      // Per game, PLAYER_EVENT_* for the player being processed
+    int16_t* game_over;   // Per game
+};
+
+DandyLockstep* dandy_lockstep_create(uint32_t games) {
+    DandyLockstep* ls = (DandyLockstep*)calloc(1, sizeof(DandyLockstep));
+    if (!ls) {
+        return NULL;
+    }
+    ls->games = games;
+    ls->lanes = (games + LOCKSTEP_WIDTH - 1) / LOCKSTEP_WIDTH * LOCKSTEP_WIDTH;
+    if (ls->lanes == 0) {
+        ls->lanes = LOCKSTEP_WIDTH;
+    }
+    // Each field is a whole number of vectors, so every one is aligned
+    size_t field = (size_t)MAX_PLAYERS * ls->lanes;
+    size_t bytes = (field * F_COUNT + 2 * ls->lanes) * sizeof(int16_t);
+    ls->block = (int16_t*)aligned_alloc(LOCKSTEP_ALIGN, bytes);
+    ls->ctx = (DandyContext*)calloc(ls->lanes, sizeof(DandyContext));
+    ls->live = (uint8_t*)calloc(ls->lanes, 1);
+    if (!ls->block || !ls->ctx || !ls->live) {
+        dandy_lockstep_destroy(ls);
+        return NULL;
+    }
+    memset(ls->block, 0, bytes);
+    int16_t** fields[F_COUNT] = {
+        &ls->joined, &ls->x, &ls->y, &ls->health, &ls->score, &ls->bombs, &ls->keys,
+        &ls->dir, &ls->timer, &ls->old_buttons, &ls->arrow_x, &ls->arrow_y, &ls->arrow_dir,
+        &ls->buttons, &ls->vp_left, &ls->vp_top, &ls->arrow_nx, &ls->arrow_ny, &ls->arrow_events
+    };
+    for (uint32_t f = 0; f < F_COUNT; ++f) {
+        *fields[f] = ls->block + f * field;
+    }
+    ls->events = ls->block + F_COUNT * field;
+    ls->game_over = ls->events + ls->lanes;
+    // Empty lanes have no players, so the vector phases leave them alone
+    for (uint32_t i = 0; i < field; ++i) {
+        ls->arrow_dir[i] = -1;
+    }
+    return ls;
+}
+
+void dandy_lockstep_destroy(DandyLockstep* ls) {
+    if (!ls) {
+        return;
+    }
+    free(ls->block);
+    free(ls->ctx);
+    free(ls->live);
+    free(ls);
+}
+
+/* --- Moving a game's player fields between the lanes and a DandyContext --- */
+
+// The player fields the core's per-game functions read or write: for one
+// player, or every player
+static void player_to_ctx(const DandyLockstep* ls, uint32_t g, uint8_t p, DandyContext* ctx) {
+    uint32_t i = p * ls->lanes + g;
+    ctx->player_joined[p] = ls->joined[i] != 0;
+    ctx->player_x[p] = (uint8_t)ls->x[i];
+    ctx->player_y[p] = (uint8_t)ls->y[i];
+    ctx->player_health[p] = ls->health[i];
+    ctx->player_score[p] = (uint16_t)ls->score[i];
+    ctx->player_bombs[p] = (uint8_t)ls->bombs[i];
+    ctx->player_keys[p] = (uint8_t)ls->keys[i];
+    ctx->player_dir[p] = (int8_t)ls->dir[i];
+    ctx->arrow_x[p] = (uint8_t)ls->arrow_x[i];
+    ctx->arrow_y[p] = (uint8_t)ls->arrow_y[i];
+    ctx->arrow_dir[p] = (int8_t)ls->arrow_dir[i];
+}
+
+static void players_to_ctx(const DandyLockstep* ls, uint32_t g, DandyContext* ctx) {
+    for (uint8_t p = 0; p < MAX_PLAYERS; ++p) {
+        player_to_ctx(ls, g, p, ctx);
+    }
+}
+
+static void players_from_ctx(DandyLockstep* ls, uint32_t g, const DandyContext* ctx) {
+    for (uint8_t p = 0; p < MAX_PLAYERS; ++p) {
+        uint32_t i = p * ls->lanes + g;
+        ls->joined[i] = ctx->player_joined[p];
+        ls->x[i] = ctx->player_x[p];
+        ls->y[i] = ctx->player_y[p];
+        ls->health[i] = ctx->player_health[p];
+        ls->score[i] = (int16_t)ctx->player_score[p];
+        ls->bombs[i] = ctx->player_bombs[p];
+        ls->keys[i] = ctx->player_keys[p];
+        ls->dir[i] = ctx->player_dir[p];
+        ls->arrow_x[i] = ctx->arrow_x[p];
+        ls->arrow_y[i] = ctx->arrow_y[p];
+        ls->arrow_dir[i] = ctx->arrow_dir[p];
+    }
+}
+
+// Every player field, move timers and old buttons too
+static void lanes_to_ctx(const DandyLockstep* ls, uint32_t g, DandyContext* ctx) {
+    players_to_ctx(ls, g, ctx);
+    for (uint8_t p = 0; p < MAX_PLAYERS; ++p) {
+        uint32_t i = p * ls->lanes + g;
+        ctx->player_move_timer[p] = (uint8_t)ls->timer[i];
+        ctx->old_buttons[p] = (uint8_t)ls->old_buttons[i];
+    }
+}
+
+static void ctx_to_lanes(DandyLockstep* ls, uint32_t g, const DandyContext* ctx) {
+    players_from_ctx(ls, g, ctx);
+    for (uint8_t p = 0; p < MAX_PLAYERS; ++p) {
+        uint32_t i = p * ls->lanes + g;
+        ls->timer[i] = ctx->player_move_timer[p];
+        ls->old_buttons[i] = ctx->old_buttons[p];
+    }
+}
+
+void dandy_lockstep_put(DandyLockstep* ls, uint32_t game, const DandyContext* ctx) {
+    if (game >= ls->games) {
+        return;
+    }
+    ls->ctx[game] = *ctx;
+    ctx_to_lanes(ls, game, ctx);
+    // Clamp the copy's positions now, as phase 1 of the first step will
+    // clamp the lanes, so that the two agree from then on
+    DandyContext* copy = &ls->ctx[game];
+    for (uint8_t p = 0; p < MAX_PLAYERS; ++p) {
+        if (copy->player_joined[p]) {
+            if (copy->player_x[p] >= DANDY_LEVEL_WIDTH) copy->player_x[p] = DANDY_LEVEL_WIDTH - 1;
+            if (copy->player_y[p] >= DANDY_LEVEL_HEIGHT) copy->player_y[p] = DANDY_LEVEL_HEIGHT - 1;
+        }
+    }
+    ls->live[game] = 1;
+}
+
+void dandy_lockstep_get(const DandyLockstep* ls, uint32_t game, DandyContext* ctx) {
+    if (game >= ls->games) {
+        return;
+    }
+    *ctx = ls->ctx[game];
+    lanes_to_ctx(ls, game, ctx);
+}
+
+/* --- Vector kernels. Each takes the index of the first of LOCKSTEP_WIDTH
+   lanes; the plain versions do the same one lane at a time. --- */
+
+#if defined(LOCKSTEP_AVX2)
+
+#define V(ptr) (*(__m256i*)(ptr))
+
+// 16 lanes of table[idx], idx 0-15, sign-extended from 8 bits
+static __m256i lookup_s8(__m256i table, __m256i idx) {
+    // Index 0x80 in the high byte of each lane reads as 0
+    __m256i t = _mm256_shuffle_epi8(table, _mm256_or_si256(idx, _mm256_set1_epi16((int16_t)0x8000)));
+    return _mm256_srai_epi16(_mm256_slli_epi16(t, 8), 8);
+}
+
+static __m256i alive_mask(const DandyLockstep* ls, uint32_t i) {
+    __m256i zero = _mm256_setzero_si256();
+    return _mm256_andnot_si256(_mm256_cmpeq_epi16(V(ls->joined + i), zero),
+                               _mm256_cmpgt_epi16(V(ls->health + i), zero));
+}
+
+static void clamp_positions(DandyLockstep* ls, uint32_t i) {
+    __m256i joined = _mm256_cmpeq_epi16(V(ls->joined + i), _mm256_setzero_si256());
+    __m256i x = V(ls->x + i);
+    __m256i y = V(ls->y + i);
+    V(ls->x + i) = _mm256_blendv_epi8(_mm256_min_epi16(x, _mm256_set1_epi16(DANDY_LEVEL_WIDTH - 1)), x, joined);
+    V(ls->y + i) = _mm256_blendv_epi8(_mm256_min_epi16(y, _mm256_set1_epi16(DANDY_LEVEL_HEIGHT - 1)), y, joined);
+}
+
+static void decode_buttons(DandyLockstep* ls, uint32_t i, int16_t* events) {
+    __m256i zero = _mm256_setzero_si256();
+    __m256i minus1 = _mm256_set1_epi16(-1);
+    __m256i active = alive_mask(ls, i);
+    __m256i buttons = V(ls->buttons + i);
+    __m256i old = V(ls->old_buttons + i);
+    __m256i delta = _mm256_andnot_si256(old, buttons);
+    V(ls->old_buttons + i) = _mm256_blendv_epi8(old, buttons, active);
+
+    // Bombs: spend one here, the blast is per game
+    __m256i bombs = V(ls->bombs + i);
+    __m256i bomb = _mm256_andnot_si256(
+        _mm256_cmpeq_epi16(_mm256_and_si256(delta, _mm256_set1_epi16(BUTTON_BOMB)), zero),
+        _mm256_and_si256(active, _mm256_cmpgt_epi16(bombs, zero)));
+    V(ls->bombs + i) = _mm256_add_epi16(bombs, bomb);
+
+    // Fire: the arrow starts on the player, facing the way the player was
+    __m256i arrow_dir = V(ls->arrow_dir + i);
+    __m256i fire = _mm256_andnot_si256(
+        _mm256_cmpeq_epi16(_mm256_and_si256(buttons, _mm256_set1_epi16(BUTTON_FIRE)), zero),
+        _mm256_and_si256(active, _mm256_cmpeq_epi16(arrow_dir, minus1)));
+    V(ls->arrow_x + i) = _mm256_blendv_epi8(V(ls->arrow_x + i), V(ls->x + i), fire);
+    V(ls->arrow_y + i) = _mm256_blendv_epi8(V(ls->arrow_y + i), V(ls->y + i), fire);
+    V(ls->arrow_dir + i) = _mm256_blendv_epi8(arrow_dir, V(ls->dir + i), fire);
+
+    // Turn, and start a move if the timer is due
+    __m256i table = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)buttons_to_dir));
+    __m256i d = lookup_s8(table, _mm256_and_si256(buttons, _mm256_set1_epi16(0x0F)));
+    __m256i turn = _mm256_and_si256(active, _mm256_cmpgt_epi16(d, minus1));
+    V(ls->dir + i) = _mm256_blendv_epi8(V(ls->dir + i), d, turn);
+    __m256i timer = V(ls->timer + i);
+    __m256i move = _mm256_and_si256(turn, _mm256_cmpeq_epi16(timer, zero));
+    __m256i t = _mm256_blendv_epi8(timer, _mm256_set1_epi16(TICKS_PER_MOVE), move);
+    t = _mm256_add_epi16(t, _mm256_cmpgt_epi16(t, zero));
+    V(ls->timer + i) = _mm256_blendv_epi8(timer, t, active);
+
+    V(events) = _mm256_or_si256(
+        _mm256_or_si256(_mm256_and_si256(bomb, _mm256_set1_epi16(PLAYER_EVENT_BOMB)),
+                        _mm256_and_si256(fire, _mm256_set1_epi16(PLAYER_EVENT_FIRE))),
+        _mm256_or_si256(_mm256_and_si256(turn, _mm256_set1_epi16(PLAYER_EVENT_TURN)),
+                        _mm256_and_si256(move, _mm256_set1_epi16(PLAYER_EVENT_MOVE))));
+}
+
+// Player viewport corner for a target position: clamp(t - back, 0, max)
+static __m256i viewport_edge(__m256i t, int16_t back, int16_t max) {
+    __m256i v = _mm256_sub_epi16(t, _mm256_set1_epi16(back));
+    return _mm256_min_epi16(_mm256_max_epi16(v, _mm256_setzero_si256()), _mm256_set1_epi16(max));
+}
+
+static void step_arrows(DandyLockstep* ls, uint32_t i) {
+    __m256i zero = _mm256_setzero_si256();
+    __m256i arrow_dir = V(ls->arrow_dir + i);
+    __m256i active = _mm256_andnot_si256(_mm256_cmpeq_epi16(V(ls->joined + i), zero),
+                                         _mm256_xor_si256(_mm256_cmpeq_epi16(arrow_dir, _mm256_set1_epi16(-1)),
+                                                          _mm256_set1_epi16(-1)));
+    __m256i dir = _mm256_and_si256(arrow_dir, _mm256_set1_epi16(7));
+    __m256i dx_table = _mm256_broadcastsi128_si256(_mm_loadl_epi64((const __m128i*)dir_delta_x));
+    __m256i dy_table = _mm256_broadcastsi128_si256(_mm_loadl_epi64((const __m128i*)dir_delta_y));
+    __m256i nx = _mm256_add_epi16(V(ls->arrow_x + i), lookup_s8(dx_table, dir));
+    __m256i ny = _mm256_add_epi16(V(ls->arrow_y + i), lookup_s8(dy_table, dir));
+    __m256i left = viewport_edge(V(ls->x + i), 10, DANDY_LEVEL_WIDTH - 20);
+    __m256i top = viewport_edge(V(ls->y + i), 5, DANDY_LEVEL_HEIGHT - 10);
+    __m256i out = _mm256_or_si256(
+        _mm256_or_si256(_mm256_cmpgt_epi16(left, nx), _mm256_cmpgt_epi16(top, ny)),
+        _mm256_or_si256(_mm256_cmpgt_epi16(nx, _mm256_add_epi16(left, _mm256_set1_epi16(19))),
+                        _mm256_cmpgt_epi16(ny, _mm256_add_epi16(top, _mm256_set1_epi16(9)))));
+    V(ls->arrow_nx + i) = nx;
+    V(ls->arrow_ny + i) = ny;
+    V(ls->arrow_events + i) = _mm256_and_si256(active,
+        _mm256_or_si256(_mm256_set1_epi16(ARROW_ACTIVE), _mm256_and_si256(out, _mm256_set1_epi16(ARROW_OUT))));
+}
+
+// get_camera_target and the viewport clamp in move_monsters, for every
+// player of 16 games
+static void camera_viewports(DandyLockstep* ls, uint32_t g) {
+    __m256i zero = _mm256_setzero_si256();
+    __m256i one = _mm256_set1_epi16(1);
+    __m256i alive[MAX_PLAYERS];
+    for (uint8_t q = 0; q < MAX_PLAYERS; ++q) {
+        alive[q] = alive_mask(ls, q * ls->lanes + g);
+    }
+    for (uint8_t p = 0; p < MAX_PLAYERS; ++p) {
+        uint32_t i = p * ls->lanes + g;
+        __m256i sum_x = zero;
+        __m256i sum_y = zero;
+        __m256i count = zero;
+        for (uint8_t q = 0; q < MAX_PLAYERS; ++q) {
+            if (q != p) {
+                uint32_t j = q * ls->lanes + g;
+                sum_x = _mm256_add_epi16(sum_x, _mm256_and_si256(alive[q], V(ls->x + j)));
+                sum_y = _mm256_add_epi16(sum_y, _mm256_and_si256(alive[q], V(ls->y + j)));
+                count = _mm256_sub_epi16(count, alive[q]);
+            }
+        }
+        // Divide by 1, 2 or 3. Sums are below 180, where x * 21846 >> 16
+        // is exactly x / 3.
+        __m256i by2 = _mm256_cmpeq_epi16(count, _mm256_set1_epi16(2));
+        __m256i by3 = _mm256_cmpeq_epi16(count, _mm256_set1_epi16(3));
+        __m256i third = _mm256_set1_epi16(21846);
+        __m256i cx = _mm256_blendv_epi8(sum_x, _mm256_srli_epi16(sum_x, 1), by2);
+        __m256i cy = _mm256_blendv_epi8(sum_y, _mm256_srli_epi16(sum_y, 1), by2);
+        cx = _mm256_blendv_epi8(cx, _mm256_mulhi_epu16(sum_x, third), by3);
+        cy = _mm256_blendv_epi8(cy, _mm256_mulhi_epu16(sum_y, third), by3);
+        __m256i spectate = _mm256_and_si256(_mm256_cmpgt_epi16(one, V(ls->health + i)),
+                                            _mm256_cmpgt_epi16(count, zero));
+        V(ls->vp_left + i) = viewport_edge(_mm256_blendv_epi8(V(ls->x + i), cx, spectate), 10, DANDY_LEVEL_WIDTH - 20);
+        V(ls->vp_top + i) = viewport_edge(_mm256_blendv_epi8(V(ls->y + i), cy, spectate), 5, DANDY_LEVEL_HEIGHT - 10);
+    }
+}
+
+static void check_game_over(DandyLockstep* ls, uint32_t g) {
+    __m256i any = _mm256_setzero_si256();
+    for (uint8_t p = 0; p < MAX_PLAYERS; ++p) {
+        any = _mm256_or_si256(any, alive_mask(ls, p * ls->lanes + g));
+    }
+    V(ls->game_over + g) = _mm256_cmpeq_epi16(any, _mm256_setzero_si256());
+}
+
+#else
+
+static bool lane_alive(const DandyLockstep* ls, uint32_t i) {
+    return ls->joined[i] && ls->health[i] > 0;
+}
+
+static void clamp_positions(DandyLockstep* ls, uint32_t first) {
+    for (uint32_t i = first; i < first + LOCKSTEP_WIDTH; ++i) {
+        if (ls->joined[i]) {
+            if (ls->x[i] >= DANDY_LEVEL_WIDTH) ls->x[i] = DANDY_LEVEL_WIDTH - 1;
+            if (ls->y[i] >= DANDY_LEVEL_HEIGHT) ls->y[i] = DANDY_LEVEL_HEIGHT - 1;
+        }
+    }
+}
+
+static void decode_buttons(DandyLockstep* ls, uint32_t first, int16_t* events) {
+    for (uint32_t k = 0; k < LOCKSTEP_WIDTH; ++k) {
+        uint32_t i = first + k;
+        int16_t ev = 0;
+        if (lane_alive(ls, i)) {
+            int16_t buttons = ls->buttons[i];
+            int16_t delta = buttons & ~ls->old_buttons[i];
+            ls->old_buttons[i] = buttons;
+            if ((delta & BUTTON_BOMB) && ls->bombs[i] > 0) {
+                ls->bombs[i]--;
+                ev |= PLAYER_EVENT_BOMB;
+            }
+            if ((buttons & BUTTON_FIRE) && ls->arrow_dir[i] == -1) {
+                ls->arrow_x[i] = ls->x[i];
+                ls->arrow_y[i] = ls->y[i];
+                ls->arrow_dir[i] = ls->dir[i];
+                ev |= PLAYER_EVENT_FIRE;
+            }
+            int8_t d = buttons_to_dir[buttons & 0x0F];
+            if (d >= 0) {
+                ls->dir[i] = d;
+                ev |= PLAYER_EVENT_TURN;
+                if (ls->timer[i] == 0) {
+                    ls->timer[i] = TICKS_PER_MOVE;
+                    ev |= PLAYER_EVENT_MOVE;
+                }
+            }
+            if (ls->timer[i] > 0) {
+                ls->timer[i]--;
+            }
+        }
+        events[k] = ev;
+    }
+}
+
+static void step_arrows(DandyLockstep* ls, uint32_t first) {
+    for (uint32_t i = first; i < first + LOCKSTEP_WIDTH; ++i) {
+        int16_t dir = ls->arrow_dir[i] & 7;
+        int16_t nx = ls->arrow_x[i] + dir_delta_x[dir];
+        int16_t ny = ls->arrow_y[i] + dir_delta_y[dir];
+        int16_t left = clamp(ls->x[i] - 10, 0, DANDY_LEVEL_WIDTH - 20);
+        int16_t top = clamp(ls->y[i] - 5, 0, DANDY_LEVEL_HEIGHT - 10);
+        int16_t ev = 0;
+        if (ls->joined[i] && ls->arrow_dir[i] != -1) {
+            ev = ARROW_ACTIVE;
+            if (nx < left || ny < top || nx >= left + 20 || ny >= top + 10) {
+                ev |= ARROW_OUT;
+            }
+        }
+        ls->arrow_nx[i] = nx;
+        ls->arrow_ny[i] = ny;
+        ls->arrow_events[i] = ev;
+    }
+}
+
+static void camera_viewports(DandyLockstep* ls, uint32_t first) {
+    for (uint32_t g = first; g < first + LOCKSTEP_WIDTH; ++g) {
+        for (uint8_t p = 0; p < MAX_PLAYERS; ++p) {
+            uint32_t i = p * ls->lanes + g;
+            int16_t target_x = ls->x[i];
+            int16_t target_y = ls->y[i];
+            if (ls->health[i] <= 0) {
+                uint16_t sum_x = 0;
+                uint16_t sum_y = 0;
+                uint8_t count = 0;
+                for (uint8_t q = 0; q < MAX_PLAYERS; ++q) {
+                    uint32_t j = q * ls->lanes + g;
+                    if (q != p && lane_alive(ls, j)) {
+                        sum_x += ls->x[j];
+                        sum_y += ls->y[j];
+                        count++;
+                    }
+                }
+                if (count > 0) {
+                    target_x = sum_x / count;
+                    target_y = sum_y / count;
+                }
+            }
+            ls->vp_left[i] = clamp(target_x - 10, 0, DANDY_LEVEL_WIDTH - 20);
+            ls->vp_top[i] = clamp(target_y - 5, 0, DANDY_LEVEL_HEIGHT - 10);
+        }
+    }
+}
+
+static void check_game_over(DandyLockstep* ls, uint32_t first) {
+    for (uint32_t g = first; g < first + LOCKSTEP_WIDTH; ++g) {
+        bool any = false;
+        for (uint8_t p = 0; p < MAX_PLAYERS; ++p) {
+            any |= lane_alive(ls, p * ls->lanes + g);
+        }
+        ls->game_over[g] = any ? 0 : -1;
+    }
+}
+
+#endif
+
+/* --- Per game: the core's own functions, on the game's DandyContext --- */
+
+// Phase 2 for player p. decode_buttons has spent a bomb, fired, turned
+// or started a move, so bring the player's fields in first. A move may
+// take the stairs, which reloads the level and moves every player.
+static void game_player_events(DandyLockstep* ls, uint32_t g, uint8_t p, uint8_t events) {
+    DandyContext* ctx = &ls->ctx[g];
+    player_to_ctx(ls, g, p, ctx);
+    player_events(ctx, p, events);
+    if (events & PLAYER_EVENT_MOVE) {
+        players_from_ctx(ls, g, ctx);
+    }
+}
+
+static void game_move_arrows(DandyLockstep* ls, uint32_t g) {
+    DandyContext* ctx = &ls->ctx[g];
+    for (uint8_t p = 0; p < MAX_PLAYERS; ++p) {
+        uint32_t i = p * ls->lanes + g;
+        if (ls->arrow_events[i]) {
+            move_arrow(ctx, p, ls->arrow_nx[i], ls->arrow_ny[i], (ls->arrow_events[i] & ARROW_OUT) != 0);
+            ls->arrow_x[i] = ctx->arrow_x[p];
+            ls->arrow_y[i] = ctx->arrow_y[p];
+            ls->arrow_dir[i] = ctx->arrow_dir[p];
+        }
+    }
+}
+
+static void game_move_monsters(DandyLockstep* ls, uint32_t g) {
+    DandyContext* ctx = &ls->ctx[g];
+    int16_t vp_lefts[MAX_PLAYERS];
+    int16_t vp_tops[MAX_PLAYERS];
+    for (uint8_t p = 0; p < MAX_PLAYERS; ++p) {
+        vp_lefts[p] = ls->vp_left[p * ls->lanes + g];
+        vp_tops[p] = ls->vp_top[p * ls->lanes + g];
+    }
+    move_visible_monsters(ctx, vp_lefts, vp_tops);
+    for (uint8_t p = 0; p < MAX_PLAYERS; ++p) {
+        ls->health[p * ls->lanes + g] = ctx->player_health[p];
+    }
+}
+
+// Every phase for one block of LOCKSTEP_WIDTH games, starting at game b.
+// Games don't interact, so running the whole tick a block at a time gives
+// the same result as running each phase across every game, and keeps the
+// block's DandyContexts in cache from one phase to the next.
+static void step_block(DandyLockstep* ls, uint32_t b) {
+    uint32_t lanes = ls->lanes;
+    uint32_t end = b + LOCKSTEP_WIDTH < ls->games ? b + LOCKSTEP_WIDTH : ls->games;
+
+    // 1
+    for (uint8_t p = 0; p < MAX_PLAYERS; ++p) {
+        clamp_positions(ls, p * lanes + b);
+    }
+
+    // 2
+    for (uint8_t p = 0; p < MAX_PLAYERS; ++p) {
+        decode_buttons(ls, p * lanes + b, ls->events + b);
+        for (uint32_t g = b; g < end; ++g) {
+            if (ls->events[g]) {
+                game_player_events(ls, g, p, (uint8_t)ls->events[g]);
+            }
+        }
+    }
+
+    // 3
+    for (uint8_t p = 0; p < MAX_PLAYERS; ++p) {
+        step_arrows(ls, p * lanes + b);
+    }
+    for (uint32_t g = b; g < end; ++g) {
+        if (ls->live[g]) {
+            game_move_arrows(ls, g);
+        }
+    }
+
+    // 4
+    camera_viewports(ls, b);
+    for (uint32_t g = b; g < end; ++g) {
+        if (ls->live[g]) {
+            game_move_monsters(ls, g);
+        }
+    }
+
+    // 5
+    check_game_over(ls, b);
+    for (uint32_t g = b; g < end; ++g) {
+        if (ls->live[g] && ls->game_over[g]) {
+            DandyContext* ctx = &ls->ctx[g];
+            end_game(ctx);
+            players_from_ctx(ls, g, ctx);
+        }
+    }
+}
+
+void dandy_lockstep_step(DandyLockstep* ls, const uint8_t* inputs) {
+    for (uint8_t p = 0; p < MAX_PLAYERS; ++p) {
+        for (uint32_t g = 0; g < ls->games; ++g) {
+            ls->buttons[p * ls->lanes + g] = inputs[g * MAX_PLAYERS + p];
+        }
+    }
+    for (uint32_t b = 0; b < ls->games; b += LOCKSTEP_WIDTH) {
+        step_block(ls, b);
+    }
+}
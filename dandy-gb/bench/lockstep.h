@@ -0,0 +1,42 @@
+/*
+ * Experimental lockstep engine: steps many games at once, with the
+ * per-player state of all of them held lane-interleaved so that the work
+ * every game does each tick (button decoding, move timers, arrow and
+ * viewport arithmetic, the game-over check) runs 16 games per AVX2
+ * instruction. Anything that reads or writes a map (moves, arrow hits,
+ * monsters, generators, stairs, doors, bombs, game over) runs per game,
+ * through the core's own functions on the game's DandyContext.
+ *
+ * After every dandy_lockstep_step each game is exactly where dandy_step
+ * would have left it. Sounds go to the HAL, as dandy_step plays them, with
+ * the engine's copy of the game's context; nothing is drawn and the HUD
+ * is not updated.
+ *
+ * lockstep.c includes dandy_core.c to call its private functions, so link
+ * it instead of src/dandy_core.c, not as well. Without -mavx2 the same
+ * kernels run as plain loops.
+ */
+#ifndef LOCKSTEP_H
+#define LOCKSTEP_H
+
+#include <stdint.h>
+#include "dandy_core.h"
+
+#define LOCKSTEP_WIDTH 16 // Games per vector: 16-bit lanes in 256 bits
+
+typedef struct DandyLockstep DandyLockstep;
+
+// Room for games games; NULL if out of memory. Every game starts empty
+// and is skipped by dandy_lockstep_step until dandy_lockstep_put.
+DandyLockstep* dandy_lockstep_create(uint32_t games);
+void dandy_lockstep_destroy(DandyLockstep* ls);
+
+// Copies a game in (set it up with dandy_init and friends first) or out
+void dandy_lockstep_put(DandyLockstep* ls, uint32_t game, const DandyContext* ctx);
+void dandy_lockstep_get(const DandyLockstep* ls, uint32_t game, DandyContext* ctx);
+
+// One dandy_step for every game. inputs holds MAX_PLAYERS button bytes
+// per game, game after game, as dandy_step takes them.
+void dandy_lockstep_step(DandyLockstep* ls, const uint8_t* inputs);
+
+#endif // LOCKSTEP_H
@@ -0,0 +1,139 @@
+/*
+ * Lockstep engine benchmark.
+ *
+ * Plays the same batch of games twice, once calling dandy_step on each
+ * game in turn and once through the lockstep engine (bench/lockstep.c),
+ * and reports game-ticks/sec for each. Every game's final state must
+ * match between the two, or the benchmark fails.
+ *
+ * Run from the dandy-gb directory:
+ *
+ *   make bench_lockstep
+ *
+ * Built twice, once with -mavx2 and once without, where the engine's
+ * kernels run as plain loops.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "lockstep.h"
+
+#define BENCH_GAMES 1024
+#define BENCH_TICKS 2000
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+// Every level in turn, two players each
+static void setup_game(DandyContext* ctx, uint32_t g) {
+    dandy_init(ctx);
+    dandy_seed(ctx, (uint16_t)(g + 1));
+    ctx->current_level = (uint8_t)(g % DANDY_NUM_LEVELS);
+    dandy_load_level(ctx, ctx->current_level);
+    dandy_join_player(ctx, 1);
+}
+
+// Every tick's inputs up front, so neither run pays for generating them
+static uint8_t* make_inputs(uint32_t games, uint32_t ticks) {
+    uint8_t* inputs = (uint8_t*)malloc((size_t)games * ticks * MAX_PLAYERS);
+    if (!inputs) {
+        return NULL;
+    }
+    // Each player holds a random combination of buttons for a while
+    uint32_t state = 1;
+    for (uint32_t g = 0; g < games; ++g) {
+        uint8_t held[MAX_PLAYERS] = {0};
+        for (uint32_t t = 0; t < ticks; ++t) {
+            for (uint8_t p = 0; p < MAX_PLAYERS; ++p) {
+                state ^= state << 13;
+                state ^= state >> 17;
+                state ^= state << 5;
+                if ((state & 15) == 0) {
+                    held[p] = (uint8_t)((state >> 4) & (BUTTON_BOMB | (BUTTON_BOMB - 1)));
+                }
+            }
+            memcpy(inputs + ((size_t)t * games + g) * MAX_PLAYERS, held, MAX_PLAYERS);
+        }
+    }
+    return inputs;
+}
+
+static bool same_game(const DandyContext* a, const DandyContext* b) {
+    return memcmp(a->map, b->map, sizeof(a->map)) == 0 &&
+           a->current_level == b->current_level &&
+           a->rng_state == b->rng_state &&
+           memcmp(a->player_joined, b->player_joined, sizeof(a->player_joined)) == 0 &&
+           memcmp(a->player_x, b->player_x, sizeof(a->player_x)) == 0 &&
+           memcmp(a->player_y, b->player_y, sizeof(a->player_y)) == 0 &&
+           memcmp(a->player_health, b->player_health, sizeof(a->player_health)) == 0 &&
+           memcmp(a->player_score, b->player_score, sizeof(a->player_score)) == 0 &&
+           memcmp(a->arrow_dir, b->arrow_dir, sizeof(a->arrow_dir)) == 0 &&
+           memcmp(a->entity_mask, b->entity_mask, sizeof(a->entity_mask)) == 0;
+}
+
+int main(void) {
+    uint32_t games = BENCH_GAMES;
+    uint32_t ticks = BENCH_TICKS;
+    DandyContext* games_ref = (DandyContext*)calloc(games, sizeof(DandyContext));
+    DandyLockstep* ls = dandy_lockstep_create(games);
+    uint8_t* inputs = make_inputs(games, ticks);
+    if (!games_ref || !ls || !inputs) {
+        fprintf(stderr, "Out of memory\n");
+        return 1;
+    }
+    for (uint32_t g = 0; g < games; ++g) {
+        setup_game(&games_ref[g], g);
+        dandy_lockstep_put(ls, g, &games_ref[g]);
+    }
+
+    double start = now_seconds();
+    for (uint32_t t = 0; t < ticks; ++t) {
+        const uint8_t* tick_inputs = inputs + (size_t)t * games * MAX_PLAYERS;
+        for (uint32_t g = 0; g < games; ++g) {
+            dandy_step(&games_ref[g], tick_inputs + g * MAX_PLAYERS);
+        }
+    }
+    double one_at_a_time = now_seconds() - start;
+
+    start = now_seconds();
+    for (uint32_t t = 0; t < ticks; ++t) {
+        dandy_lockstep_step(ls, inputs + (size_t)t * games * MAX_PLAYERS);
+    }
+    double lockstep = now_seconds() - start;
+
+    uint32_t mismatches = 0;
+    for (uint32_t g = 0; g < games; ++g) {
+        DandyContext got;
+        dandy_lockstep_get(ls, g, &got);
+        if (!same_game(&games_ref[g], &got)) {
+            if (mismatches++ < 5) {
+                fprintf(stderr, "Game %u differs after %u ticks\n", g, ticks);
+            }
+        }
+    }
+
+    double game_ticks = (double)games * ticks;
+#if defined(__AVX2__)
+    const char* kernels = "AVX2";
+#else
+    const char* kernels = "plain";
+#endif
+    printf("%u games x %u ticks (%s kernels)\n", games, ticks, kernels);
+    printf("  dandy_step   %8.3f s  %12.0f game-ticks/s\n", one_at_a_time, game_ticks / one_at_a_time);
+    printf("  lockstep     %8.3f s  %12.0f game-ticks/s  (%.2fx)\n", lockstep, game_ticks / lockstep,
+           one_at_a_time / lockstep);
+    if (mismatches) {
+        fprintf(stderr, "%u games differ\n", mismatches);
+        return 1;
+    }
+
+    dandy_lockstep_destroy(ls);
+    free(games_ref);
+    free(inputs);
+    return 0;
+}
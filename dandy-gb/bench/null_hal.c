@@ -0,0 +1,21 @@
+/* Null HAL for host benchmarks: the engine runs, nothing is drawn or played. */
+#include "dandy_core.h"
+
+void hal_draw_tile(DANDY_CTX_ uint8_t x, uint8_t y, uint8_t tile_id) {
+    (void)x; (void)y; (void)tile_id;
+}
+
+void hal_update_hud(DANDY_CTX) {
+}
+
+void hal_clear_sprites(DANDY_CTX_ uint8_t vp_left, uint8_t vp_top) {
+    (void)vp_left; (void)vp_top;
+}
+
+void hal_set_sprite(DANDY_CTX_ uint8_t sprite_idx, uint8_t x, uint8_t y, uint8_t tile_id, uint8_t flags) {
+    (void)sprite_idx; (void)x; (void)y; (void)tile_id; (void)flags;
+}
+
+void hal_play_sound(DANDY_CTX_ uint8_t sound_id) {
+    (void)sound_id;
+}
@@ -0,0 +1,304 @@
+/*
+ * Replay recording and playback: see replay.h.
+ */
+#include <stdlib.h>
+#include <string.h>
+
+#include "replay.h"
+
+#ifdef DANDY_SINGLE_CONTEXT
+#error "Replays run on a DandyContext of their own; build without DANDY_SINGLE_CONTEXT"
+#endif
+
+enum { RECORD_RUN, RECORD_JOIN, RECORD_HASH };
+
+static const uint8_t replay_magic[4] = { 'D', 'R', 'P', 'L' };
+
+static uint32_t fnv1a(uint32_t hash, const void* data, size_t size) {
+    const uint8_t* bytes = (const uint8_t*)data;
+    for (size_t i = 0; i < size; ++i) {
+        hash = (hash ^ bytes[i]) * 16777619u;
+    }
+    return hash;
+}
+
+#define HASH_FIELD(hash, ctx, field) fnv1a(hash, (ctx)->field, sizeof((ctx)->field))
+
+uint32_t replay_state_hash(const DandyContext* ctx) {
+    uint32_t hash = 2166136261u;
+    uint8_t has_doors = ctx->door_runs != NULL;
+    hash = HASH_FIELD(hash, ctx, map);
+    hash = fnv1a(hash, &ctx->current_level, 1);
+    hash = fnv1a(hash, &ctx->monster_rotor, 1);
+    hash = fnv1a(hash, &ctx->rng_state, sizeof(ctx->rng_state));
+    hash = HASH_FIELD(hash, ctx, player_joined);
+    hash = HASH_FIELD(hash, ctx, player_x);
+    hash = HASH_FIELD(hash, ctx, player_y);
+    hash = HASH_FIELD(hash, ctx, player_health);
+    hash = HASH_FIELD(hash, ctx, player_score);
+    hash = HASH_FIELD(hash, ctx, player_bombs);
+    hash = HASH_FIELD(hash, ctx, player_keys);
+    hash = HASH_FIELD(hash, ctx, player_dir);
+    hash = HASH_FIELD(hash, ctx, player_move_timer);
+    hash = HASH_FIELD(hash, ctx, arrow_x);
+    hash = HASH_FIELD(hash, ctx, arrow_y);
+    hash = HASH_FIELD(hash, ctx, arrow_dir);
+    hash = HASH_FIELD(hash, ctx, old_buttons);
+    hash = fnv1a(hash, &has_doors, 1);
+    hash = HASH_FIELD(hash, ctx, entity_mask);
+    return hash;
+}
+
+uint32_t replay_build_hash(void) {
+    uint32_t hash = 2166136261u;
+    uint8_t version = REPLAY_VERSION;
+    hash = fnv1a(hash, &version, 1);
+    hash = fnv1a(hash, &dandy_sizeof_context, sizeof(dandy_sizeof_context));
+    for (uint8_t level = 0; level < DANDY_NUM_LEVELS; ++level) {
+        hash = fnv1a(hash, dandy_levels[level], dandy_level_sizes[level]);
+    }
+    return hash;
+}
+
+void replay_start_game(DandyContext* ctx, const ReplayHeader* header) {
+    // dandy_init leaves some of the bookkeeping as it was, and a replay
+    // has to start the same way whatever ctx last played
+    memset(ctx, 0, sizeof(*ctx));
+    dandy_init(ctx);
+    dandy_seed(ctx, header->seed);
+    ctx->current_level = header->level;
+    dandy_load_level(ctx, header->level);
+    for (uint8_t p = 1; p < MAX_PLAYERS; ++p) {
+        if (header->joined & (1 << p)) {
+            dandy_join_player(ctx, p);
+        }
+    }
+}
+
+static void put_u16(uint8_t* out, uint16_t v) {
+    out[0] = (uint8_t)v;
+    out[1] = (uint8_t)(v >> 8);
+}
+
+static void put_u32(uint8_t* out, uint32_t v) {
+    put_u16(out, (uint16_t)v);
+    put_u16(out + 2, (uint16_t)(v >> 16));
+}
+
+static uint16_t get_u16(const uint8_t* in) {
+    return (uint16_t)(in[0] | (in[1] << 8));
+}
+
+static uint32_t get_u32(const uint8_t* in) {
+    return get_u16(in) | ((uint32_t)get_u16(in + 2) << 16);
+}
+
+/* --- Recording --- */
+
+static uint8_t* reserve(ReplayRecorder* rec, size_t bytes) {
+    if (rec->size + bytes > rec->capacity) {
+        size_t capacity = rec->capacity ? rec->capacity * 2 : 4096;
+        while (capacity < rec->size + bytes) {
+            capacity *= 2;
+        }
+        uint8_t* data = (uint8_t*)realloc(rec->data, capacity);
+        if (!data) {
+            rec->out_of_memory = true;
+            return NULL;
+        }
+        rec->data = data;
+        rec->capacity = capacity;
+    }
+    uint8_t* out = rec->data + rec->size;
+    rec->size += bytes;
+    return out;
+}
+
+static void put_varint(ReplayRecorder* rec, uint64_t v) {
+    uint8_t bytes[10];
+    size_t n = 0;
+    do {
+        bytes[n] = (uint8_t)(v & 0x7F);
+        v >>= 7;
+        if (v) {
+            bytes[n] |= 0x80;
+        }
+        n++;
+    } while (v);
+    uint8_t* out = reserve(rec, n);
+    if (out) {
+        memcpy(out, bytes, n);
+    }
+}
+
+static void flush_run(ReplayRecorder* rec) {
+    if (rec->run_ticks == 0) {
+        return;
+    }
+    put_varint(rec, ((uint64_t)rec->run_ticks << 6) | ((uint64_t)rec->run_changed << 2) | RECORD_RUN);
+    for (uint8_t p = 0; p < MAX_PLAYERS; ++p) {
+        if (rec->run_changed & (1 << p)) {
+            uint8_t* out = reserve(rec, 1);
+            if (out) {
+                *out = rec->held[p];
+            }
+        }
+    }
+    rec->run_ticks = 0;
+    rec->run_changed = 0;
+}
+
+bool replay_record_begin(ReplayRecorder* rec, DandyContext* ctx, const ReplayHeader* header) {
+    memset(rec, 0, sizeof(*rec));
+    rec->header = *header;
+    rec->header.joined |= 1; // Player 1 is always joined
+    rec->header.build_hash = replay_build_hash();
+    rec->header.ticks = 0;
+    replay_start_game(ctx, &rec->header);
+    reserve(rec, REPLAY_HEADER_SIZE);
+    return !rec->out_of_memory;
+}
+
+void replay_record_tick(ReplayRecorder* rec, const DandyContext* ctx, const uint8_t inputs[MAX_PLAYERS]) {
+    uint8_t changed = 0;
+    for (uint8_t p = 0; p < MAX_PLAYERS; ++p) {
+        if (inputs[p] != rec->held[p]) {
+            changed |= (uint8_t)(1 << p);
+        }
+    }
+    if (changed) {
+        flush_run(rec);
+        for (uint8_t p = 0; p < MAX_PLAYERS; ++p) {
+            rec->held[p] = inputs[p];
+        }
+        rec->run_changed = changed;
+    }
+    rec->run_ticks++;
+    rec->header.ticks++;
+    if (rec->header.hash_interval && rec->header.ticks % rec->header.hash_interval == 0) {
+        flush_run(rec);
+        put_varint(rec, RECORD_HASH);
+        uint8_t* out = reserve(rec, 4);
+        if (out) {
+            put_u32(out, replay_state_hash(ctx));
+        }
+    }
+}
+
+void replay_record_join(ReplayRecorder* rec, uint8_t p_idx) {
+    flush_run(rec);
+    put_varint(rec, ((uint64_t)p_idx << 2) | RECORD_JOIN);
+}
+
+bool replay_record_end(ReplayRecorder* rec) {
+    flush_run(rec);
+    if (rec->out_of_memory) {
+        return false;
+    }
+    uint8_t* out = rec->data;
+    memcpy(out, replay_magic, 4);
+    out[4] = REPLAY_VERSION;
+    out[5] = rec->header.level;
+    out[6] = rec->header.joined;
+    out[7] = 0;
+    put_u16(out + 8, rec->header.seed);
+    put_u16(out + 10, rec->header.hash_interval);
+    put_u32(out + 12, rec->header.build_hash);
+    put_u32(out + 16, rec->header.ticks);
+    return true;
+}
+
+void replay_record_free(ReplayRecorder* rec) {
+    free(rec->data);
+    memset(rec, 0, sizeof(*rec));
+}
+
+/* --- Playback --- */
+
+static bool get_varint(const uint8_t* data, size_t size, size_t* pos, uint64_t* v) {
+    *v = 0;
+    for (unsigned shift = 0; shift < 64; shift += 7) {
+        if (*pos >= size) {
+            return false;
+        }
+        uint8_t b = data[(*pos)++];
+        *v |= (uint64_t)(b & 0x7F) << shift;
+        if (!(b & 0x80)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool replay_read_header(const uint8_t* data, size_t size, ReplayHeader* header) {
+    if (size < REPLAY_HEADER_SIZE || memcmp(data, replay_magic, 4) != 0 ||
+        data[4] != REPLAY_VERSION || data[5] >= DANDY_NUM_LEVELS) {
+        return false;
+    }
+    header->level = data[5];
+    header->joined = data[6];
+    header->seed = get_u16(data + 8);
+    header->hash_interval = get_u16(data + 10);
+    header->build_hash = get_u32(data + 12);
+    header->ticks = get_u32(data + 16);
+    return true;
+}
+
+ReplayStatus replay_play(const uint8_t* data, size_t size, DandyContext* ctx, ReplayResult* result) {
+    memset(result, 0, sizeof(*result));
+    if (!replay_read_header(data, size, &result->header)) {
+        return REPLAY_BAD_FORMAT;
+    }
+    result->build_matches = result->header.build_hash == replay_build_hash();
+    replay_start_game(ctx, &result->header);
+
+    uint8_t held[MAX_PLAYERS] = {0};
+    size_t pos = REPLAY_HEADER_SIZE;
+    while (pos < size) {
+        uint64_t v;
+        if (!get_varint(data, size, &pos, &v)) {
+            return REPLAY_BAD_FORMAT;
+        }
+        switch (v & 3) {
+        case RECORD_RUN: {
+            uint64_t run = v >> 6;
+            if (run == 0 || run > result->header.ticks - result->ticks) {
+                return REPLAY_BAD_FORMAT;
+            }
+            for (uint8_t p = 0; p < MAX_PLAYERS; ++p) {
+                if (v & (4u << p)) {
+                    if (pos >= size) {
+                        return REPLAY_BAD_FORMAT;
+                    }
+                    held[p] = data[pos++];
+                }
+            }
+            for (uint64_t t = 0; t < run; ++t) {
+                dandy_step(ctx, held);
+            }
+            result->ticks += (uint32_t)run;
+            break;
+        }
+        case RECORD_JOIN:
+            if ((v >> 2) >= MAX_PLAYERS) {
+                return REPLAY_BAD_FORMAT;
+            }
+            dandy_join_player(ctx, (uint8_t)(v >> 2));
+            break;
+        case RECORD_HASH:
+            if (pos + 4 > size) {
+                return REPLAY_BAD_FORMAT;
+            }
+            result->hashes_checked++;
+            if (get_u32(data + pos) != replay_state_hash(ctx)) {
+                result->desync_tick = result->ticks;
+                return REPLAY_DESYNC;
+            }
+            pos += 4;
+            break;
+        default:
+            return REPLAY_BAD_FORMAT;
+        }
+    }
+    return result->ticks == result->header.ticks ? REPLAY_OK : REPLAY_BAD_FORMAT;
+}
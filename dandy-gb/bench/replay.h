@@ -0,0 +1,125 @@
+/*
+ * Replays: a game's start and every button press, compact enough to keep
+ * from real sessions, and re-run as fast as the core goes.
+ *
+ * The core is deterministic: the same start and the same inputs, tick for
+ * tick, always give the same game. A replay holds just those, plus a hash
+ * of the game state every hash_interval ticks, so playing it back can tell
+ * where it stops matching the game that was recorded.
+ *
+ * Format, all integers little-endian:
+ *
+ *   0  4  "DRPL"
+ *   4  1  REPLAY_VERSION
+ *   5  1  starting level
+ *   6  1  joined players at the start, bit p for player p
+ *   7  1  0
+ *   8  2  generator seed, as passed to dandy_seed
+ *  10  2  hash_interval in ticks, 0 for no hashes
+ *  12  4  replay_build_hash() of the build that recorded it
+ *  16  4  ticks
+ *  20     records, until the end of the file
+ *
+ * Each record starts with a varint (7 bits a byte, low first) whose low 2
+ * bits are its kind:
+ *
+ *   RUN   v >> 6 ticks (at least 1) with the same buttons. Bits 2-5 say
+ *         which players' buttons changed since the last run; one byte
+ *         follows for each, in player order. Every player starts with no
+ *         buttons held.
+ *   JOIN  dandy_join_player(v >> 2) before the next tick.
+ *   HASH  4 bytes of replay_state_hash() follow, taken after the ticks so
+ *         far. The recorder writes one every hash_interval ticks.
+ *
+ * Held buttons cost one record however long they're held, so an hour of
+ * play is typically tens of kilobytes.
+ */
+#ifndef REPLAY_H
+#define REPLAY_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "dandy_core.h"
+
+#define REPLAY_VERSION        1
+#define REPLAY_HEADER_SIZE    20
+#define REPLAY_HASH_INTERVAL  60 // Once a second
+
+typedef struct {
+    uint8_t level;
+    uint8_t joined;          // Bit p: player p joined at the start
+    uint16_t seed;
+    uint16_t hash_interval;
+    uint32_t build_hash;
+    uint32_t ticks;
+} ReplayHeader;
+
+// FNV-1a over the state that decides how the game goes on: the map,
+// level, generator, players, arrows and the core's bookkeeping. Leaves out
+// what only drawing reads or writes.
+uint32_t replay_state_hash(const DandyContext* ctx);
+
+// Identifies the levels and the layout of DandyContext a replay was
+// recorded against. A replay from a build with a different hash may still
+// play back; its state hashes say whether it did.
+uint32_t replay_build_hash(void);
+
+// The game a replay starts from: a cleared ctx, dandy_init, seed, level
+// and joins
+void replay_start_game(DandyContext* ctx, const ReplayHeader* header);
+
+/* --- Recording --- */
+
+typedef struct {
+    uint8_t* data;
+    size_t size;
+    size_t capacity;
+    ReplayHeader header;
+    uint8_t held[MAX_PLAYERS];     // Buttons of the run being recorded
+    uint8_t run_changed;           // Its changed-players bits
+    uint32_t run_ticks;
+    bool out_of_memory;
+} ReplayRecorder;
+
+// Starts a replay of the game replay_start_game(ctx, header) sets up.
+// header's build_hash and ticks are filled in by the recorder. Returns
+// false if out of memory.
+bool replay_record_begin(ReplayRecorder* rec, DandyContext* ctx, const ReplayHeader* header);
+
+// Call after each dandy_step with the inputs it was given
+void replay_record_tick(ReplayRecorder* rec, const DandyContext* ctx, const uint8_t inputs[MAX_PLAYERS]);
+
+// Call after dandy_join_player
+void replay_record_join(ReplayRecorder* rec, uint8_t p_idx);
+
+// Finishes the replay, leaving it in rec->data and rec->size. Returns
+// false if the recorder ran out of memory along the way.
+bool replay_record_end(ReplayRecorder* rec);
+
+void replay_record_free(ReplayRecorder* rec);
+
+/* --- Playback --- */
+
+typedef enum {
+    REPLAY_OK,
+    REPLAY_BAD_FORMAT,       // Not a replay, or cut short
+    REPLAY_DESYNC            // A state hash didn't match
+} ReplayStatus;
+
+typedef struct {
+    ReplayHeader header;
+    uint32_t ticks;          // Ticks played
+    uint32_t hashes_checked;
+    uint32_t desync_tick;    // REPLAY_DESYNC: the tick whose hash differed
+    bool build_matches;      // header.build_hash == replay_build_hash()
+} ReplayResult;
+
+// Reads just the header. Returns false if data isn't a replay.
+bool replay_read_header(const uint8_t* data, size_t size, ReplayHeader* header);
+
+// Plays the whole replay on ctx as fast as it will go, checking every
+// state hash, and stops at the first that doesn't match. Drawing is up to
+// the HAL linked in; nothing in here draws.
+ReplayStatus replay_play(const uint8_t* data, size_t size, DandyContext* ctx, ReplayResult* result);
+
+#endif // REPLAY_H
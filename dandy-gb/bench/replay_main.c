@@ -0,0 +1,265 @@
+/*
+ * Replay CLI: records scripted games to replay files and plays replays
+ * back as fast as the core goes, checking their state hashes (see
+ * replay.h). Nothing is drawn: it links the null HAL.
+ *
+ *   replay record [-l level] [-p players] [-s seed] [-k ticks] [-i input]
+ *                 [-j tick:player]... [-h interval] out.drp
+ *   replay play [-n repeats] in.drp
+ *   replay info in.drp
+ *
+ * input is "idle", "random:<seed>" (the default, random:1), or the path of
+ * a recording with MAX_PLAYERS button bytes per tick, which is converted
+ * tick for tick. -j joins a player before the given tick. play exits with
+ * 1 if the replay doesn't match, and reports ticks/s over all repeats.
+ *
+ * Run from the dandy-gb directory:
+ *
+ *   make replay
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "replay.h"
+
+#define DEFAULT_TICKS   36000 // Ten minutes at 60 Hz
+#define MAX_JOINS       16
+
+static DandyContext game;
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static uint8_t* read_file(const char* path, size_t* size) {
+    FILE* f = fopen(path, "rb");
+    if (!f) {
+        fprintf(stderr, "Can't open %s\n", path);
+        return NULL;
+    }
+    fseek(f, 0, SEEK_END);
+    long length = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    uint8_t* data = (uint8_t*)malloc(length > 0 ? (size_t)length : 1);
+    if (!data || length < 0 || fread(data, 1, (size_t)length, f) != (size_t)length) {
+        fprintf(stderr, "Can't read %s\n", path);
+        free(data);
+        fclose(f);
+        return NULL;
+    }
+    fclose(f);
+    *size = (size_t)length;
+    return data;
+}
+
+static void usage(void) {
+    fprintf(stderr,
+            "usage: replay record [-l level] [-p players] [-s seed] [-k ticks] [-i idle|random:<seed>|file]\n"
+            "                     [-j tick:player]... [-h interval] out.drp\n"
+            "       replay play [-n repeats] in.drp\n"
+            "       replay info in.drp\n");
+}
+
+static int record(int argc, char** argv) {
+    ReplayHeader header = { 0, 1, DANDY_RNG_SEED, REPLAY_HASH_INTERVAL, 0, 0 };
+    uint32_t ticks = DEFAULT_TICKS;
+    uint32_t players = 1;
+    uint32_t random_state = 1;
+    bool idle = false;
+    uint8_t* recording = NULL;
+    size_t recording_size = 0;
+    uint32_t join_tick[MAX_JOINS];
+    uint8_t join_player[MAX_JOINS];
+    uint32_t num_joins = 0;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "l:p:s:k:i:j:h:")) != -1) {
+        switch (opt) {
+        case 'l': header.level = (uint8_t)strtoul(optarg, NULL, 0); break;
+        case 'p': players = (uint32_t)strtoul(optarg, NULL, 0); break;
+        case 's': header.seed = (uint16_t)strtoul(optarg, NULL, 0); break;
+        case 'k': ticks = (uint32_t)strtoul(optarg, NULL, 0); break;
+        case 'h': header.hash_interval = (uint16_t)strtoul(optarg, NULL, 0); break;
+        case 'i':
+            if (strcmp(optarg, "idle") == 0) {
+                idle = true;
+            } else if (strncmp(optarg, "random:", 7) == 0) {
+                random_state = (uint32_t)strtoul(optarg + 7, NULL, 0);
+            } else if (!(recording = read_file(optarg, &recording_size))) {
+                return 1;
+            }
+            break;
+        case 'j': {
+            unsigned tick, p;
+            if (num_joins == MAX_JOINS || sscanf(optarg, "%u:%u", &tick, &p) != 2 || p >= MAX_PLAYERS) {
+                usage();
+                return 2;
+            }
+            join_tick[num_joins] = tick;
+            join_player[num_joins] = (uint8_t)p;
+            num_joins++;
+            break;
+        }
+        default: usage(); return 2;
+        }
+    }
+    if (optind != argc - 1 || players < 1 || players > MAX_PLAYERS || header.level >= DANDY_NUM_LEVELS) {
+        usage();
+        return 2;
+    }
+    if (recording) {
+        ticks = (uint32_t)(recording_size / MAX_PLAYERS);
+    }
+    header.joined = (uint8_t)((1 << players) - 1);
+    if (random_state == 0) {
+        random_state = 1;
+    }
+
+    ReplayRecorder rec;
+    if (!replay_record_begin(&rec, &game, &header)) {
+        fprintf(stderr, "Out of memory\n");
+        return 1;
+    }
+    uint8_t held[MAX_PLAYERS] = {0};
+    for (uint32_t t = 0; t < ticks; ++t) {
+        for (uint32_t j = 0; j < num_joins; ++j) {
+            if (join_tick[j] == t) {
+                dandy_join_player(&game, join_player[j]);
+                replay_record_join(&rec, join_player[j]);
+            }
+        }
+        if (recording) {
+            memcpy(held, recording + (size_t)t * MAX_PLAYERS, MAX_PLAYERS);
+        } else if (!idle) {
+            // Each player holds a random combination of buttons for a while
+            for (uint8_t p = 0; p < MAX_PLAYERS; ++p) {
+                random_state ^= random_state << 13;
+                random_state ^= random_state >> 17;
+                random_state ^= random_state << 5;
+                if ((random_state & 15) == 0) {
+                    held[p] = (uint8_t)((random_state >> 4) & (BUTTON_BOMB | (BUTTON_BOMB - 1)));
+                }
+            }
+        }
+        dandy_step(&game, held);
+        replay_record_tick(&rec, &game, held);
+    }
+    free(recording);
+    if (!replay_record_end(&rec)) {
+        fprintf(stderr, "Out of memory\n");
+        replay_record_free(&rec);
+        return 1;
+    }
+
+    const char* path = argv[optind];
+    FILE* f = fopen(path, "wb");
+    if (!f || fwrite(rec.data, 1, rec.size, f) != rec.size) {
+        fprintf(stderr, "Can't write %s\n", path);
+        if (f) {
+            fclose(f);
+        }
+        replay_record_free(&rec);
+        return 1;
+    }
+    fclose(f);
+    printf("%s: %u ticks, %zu bytes (%.2f bytes/s of play), final state %08X\n", path, rec.header.ticks,
+           rec.size, rec.header.ticks ? rec.size * 60.0 / rec.header.ticks : 0.0, replay_state_hash(&game));
+    replay_record_free(&rec);
+    return 0;
+}
+
+static void print_header(const char* path, const ReplayHeader* header) {
+    printf("%s: level %u, players %X, seed 0x%04X, %u ticks, hash every %u, build %08X%s\n", path,
+           header->level, header->joined, header->seed, header->ticks, header->hash_interval,
+           header->build_hash, header->build_hash == replay_build_hash() ? "" : " (not this build)");
+}
+
+static int play(int argc, char** argv) {
+    uint32_t repeats = 1;
+    int opt;
+    while ((opt = getopt(argc, argv, "n:")) != -1) {
+        switch (opt) {
+        case 'n': repeats = (uint32_t)strtoul(optarg, NULL, 0); break;
+        default: usage(); return 2;
+        }
+    }
+    if (optind != argc - 1 || repeats == 0) {
+        usage();
+        return 2;
+    }
+    const char* path = argv[optind];
+    size_t size;
+    uint8_t* data = read_file(path, &size);
+    if (!data) {
+        return 1;
+    }
+
+    ReplayResult result;
+    ReplayStatus status = REPLAY_OK;
+    double start = now_seconds();
+    for (uint32_t r = 0; r < repeats && status == REPLAY_OK; ++r) {
+        status = replay_play(data, size, &game, &result);
+    }
+    double seconds = now_seconds() - start;
+    free(data);
+
+    if (status == REPLAY_BAD_FORMAT) {
+        fprintf(stderr, "%s: not a replay, or cut short\n", path);
+        return 1;
+    }
+    print_header(path, &result.header);
+    if (status == REPLAY_DESYNC) {
+        printf("DESYNC at tick %u (%u hashes matched before it)\n", result.desync_tick, result.hashes_checked - 1);
+        return 1;
+    }
+    printf("OK: %u hashes matched, final state %08X, %.0f ticks/s (%.0fx real time)\n", result.hashes_checked,
+           replay_state_hash(&game), (double)result.ticks * repeats / seconds,
+           (double)result.ticks * repeats / seconds / 60.0);
+    return 0;
+}
+
+static int info(int argc, char** argv) {
+    if (argc != 2) {
+        usage();
+        return 2;
+    }
+    size_t size;
+    uint8_t* data = read_file(argv[1], &size);
+    ReplayHeader header;
+    if (!data) {
+        return 1;
+    }
+    if (!replay_read_header(data, size, &header)) {
+        fprintf(stderr, "%s: not a replay\n", argv[1]);
+        free(data);
+        return 1;
+    }
+    print_header(argv[1], &header);
+    printf("%zu bytes\n", size);
+    free(data);
+    return 0;
+}
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        usage();
+        return 2;
+    }
+    // Each command parses its own options
+    if (strcmp(argv[1], "record") == 0) {
+        return record(argc - 1, argv + 1);
+    }
+    if (strcmp(argv[1], "play") == 0) {
+        return play(argc - 1, argv + 1);
+    }
+    if (strcmp(argv[1], "info") == 0) {
+        return info(argc - 1, argv + 1);
+    }
+    usage();
+    return 2;
+}
@@ -0,0 +1,371 @@
+/*
+ * Engine step benchmark: the baseline for engine optimizations.
+ *
+ * Plays each chosen level from a fresh dandy_init for a number of ticks
+ * with scripted inputs, through the null HAL, and reports:
+ *
+ *   ticks/s          plain dandy_step calls, timed as a whole
+ *   ns/tick          p50, p90, p99 and max over single ticks
+ *   phases           buttons, arrows, monsters and the end-of-tick work
+ *                    (HUD and game-over check), as ns/tick and a share
+ *
+ * The percentiles and phases come from a second run through a copy of
+ * dandy_step with a timestamp between phases; before timing anything,
+ * that copy is checked against dandy_step.
+ *
+ *   step_bench [-k ticks] [-l levels] [-p players] [-s seed] [-i input]
+ *
+ * levels is "all" (the default) or a list like 0,3,10-12. input is
+ * "idle", "random:<seed>" (the default, random:1), or the path of a
+ * recording with MAX_PLAYERS button bytes per tick, replayed in a loop.
+ *
+ * Run from the dandy-gb directory:
+ *
+ *   make bench
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define BENCH_HAVE_TSC 1
+#endif
+
+/* The phases are static, so pull the engine in directly. */
+#include "dandy_core.c"
+
+#define DEFAULT_TICKS   20000
+#define VERIFY_TICKS    3000
+
+enum { PHASE_BUTTONS, PHASE_ARROWS, PHASE_MONSTERS, PHASE_END, NUM_PHASES };
+
+static const char* phase_names[NUM_PHASES] = { "buttons", "arrows", "monsters", "hud+end" };
+
+static DandyContext bench_ctx;
+static DandyContext check_ctx;
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+// TSC cycles where there is a TSC, nanoseconds elsewhere
+static uint64_t now_stamp(void) {
+#ifdef BENCH_HAVE_TSC
+    return __rdtsc();
+#else
+    return (uint64_t)now_ns();
+#endif
+}
+
+/* dandy_step, with a timestamp between phases. Keep in step with
+   dandy_step; main checks the two agree before timing anything. */
+static uint64_t timed_step(DandyContext* ctx, const uint8_t inputs[MAX_PLAYERS], uint64_t phases[NUM_PHASES]) {
+    uint64_t t0 = now_stamp();
+    for (uint8_t p = 0; p < MAX_PLAYERS; ++p) {
+        if (ctx->player_joined[p]) {
+            if (ctx->player_x[p] >= DANDY_LEVEL_WIDTH) ctx->player_x[p] = DANDY_LEVEL_WIDTH - 1;
+            if (ctx->player_y[p] >= DANDY_LEVEL_HEIGHT) ctx->player_y[p] = DANDY_LEVEL_HEIGHT - 1;
+        }
+    }
+    for (uint8_t p = 0; p < MAX_PLAYERS; ++p) {
+        if (ctx->player_joined[p] && ctx->player_health[p] > 0) {
+            do_player_buttons(ctx, p, inputs[p]);
+        }
+    }
+    uint64_t t1 = now_stamp();
+    move_arrows(ctx);
+    uint64_t t2 = now_stamp();
+    move_monsters(ctx);
+    uint64_t t3 = now_stamp();
+    hal_update_hud(ctx);
+    bool all_dead = true;
+    for (uint8_t p = 0; p < MAX_PLAYERS; ++p) {
+        if (ctx->player_joined[p] && ctx->player_health[p] > 0) {
+            all_dead = false;
+            break;
+        }
+    }
+    if (all_dead) {
+        end_game(ctx);
+    }
+    uint64_t t4 = now_stamp();
+    phases[PHASE_BUTTONS] += t1 - t0;
+    phases[PHASE_ARROWS] += t2 - t1;
+    phases[PHASE_MONSTERS] += t3 - t2;
+    phases[PHASE_END] += t4 - t3;
+    return t4 - t0;
+}
+
+static void start_level(DandyContext* ctx, uint8_t level, uint8_t players, uint16_t seed) {
+    memset(ctx, 0, sizeof(*ctx));
+    dandy_init(ctx);
+    dandy_seed(ctx, seed);
+    ctx->current_level = level;
+    dandy_load_level(ctx, level);
+    for (uint8_t p = 1; p < players; ++p) {
+        dandy_join_player(ctx, p);
+    }
+}
+
+/* --- Scripted inputs --- */
+
+typedef struct {
+    enum { INPUT_IDLE, INPUT_RANDOM, INPUT_RECORDED } kind;
+    uint32_t seed;
+    uint8_t* data;
+    uint32_t num_ticks;
+} InputScript;
+
+// MAX_PLAYERS bytes for each of ticks ticks. Random inputs have each
+// player hold a random combination of buttons for a while.
+static void fill_inputs(const InputScript* script, uint8_t level, uint32_t ticks, uint8_t* out) {
+    memset(out, 0, (size_t)ticks * MAX_PLAYERS);
+    if (script->kind == INPUT_RECORDED) {
+        for (uint32_t t = 0; t < ticks; ++t) {
+            memcpy(out + t * MAX_PLAYERS, script->data + (t % script->num_ticks) * MAX_PLAYERS, MAX_PLAYERS);
+        }
+    } else if (script->kind == INPUT_RANDOM) {
+        uint32_t state = (script->seed ^ (level * 0x9E3779B9u)) | 1;
+        uint8_t held[MAX_PLAYERS] = {0};
+        for (uint32_t t = 0; t < ticks; ++t) {
+            for (uint8_t p = 0; p < MAX_PLAYERS; ++p) {
+                state ^= state << 13;
+                state ^= state >> 17;
+                state ^= state << 5;
+                if ((state & 15) == 0) {
+                    held[p] = (uint8_t)((state >> 4) & (BUTTON_BOMB | (BUTTON_BOMB - 1)));
+                }
+            }
+            memcpy(out + t * MAX_PLAYERS, held, MAX_PLAYERS);
+        }
+    }
+}
+
+static bool load_recording(const char* path, InputScript* script) {
+    FILE* f = fopen(path, "rb");
+    if (!f) {
+        fprintf(stderr, "Can't open %s\n", path);
+        return false;
+    }
+    fseek(f, 0, SEEK_END);
+    long size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    if (size < MAX_PLAYERS) {
+        fprintf(stderr, "%s holds no ticks\n", path);
+        fclose(f);
+        return false;
+    }
+    script->data = (uint8_t*)malloc((size_t)size);
+    if (!script->data || fread(script->data, 1, (size_t)size, f) != (size_t)size) {
+        fprintf(stderr, "Can't read %s\n", path);
+        fclose(f);
+        return false;
+    }
+    fclose(f);
+    script->kind = INPUT_RECORDED;
+    script->num_ticks = (uint32_t)(size / MAX_PLAYERS);
+    return true;
+}
+
+// "all", or a comma-separated list of levels and ranges
+static bool parse_levels(const char* arg, bool chosen[DANDY_NUM_LEVELS]) {
+    memset(chosen, 0, DANDY_NUM_LEVELS * sizeof(bool));
+    if (strcmp(arg, "all") == 0) {
+        memset(chosen, 1, DANDY_NUM_LEVELS * sizeof(bool));
+        return true;
+    }
+    const char* s = arg;
+    while (*s) {
+        char* end;
+        unsigned long first = strtoul(s, &end, 10);
+        unsigned long last = first;
+        if (end == s) {
+            return false;
+        }
+        if (*end == '-') {
+            s = end + 1;
+            last = strtoul(s, &end, 10);
+            if (end == s) {
+                return false;
+            }
+        }
+        if (first > last || last >= DANDY_NUM_LEVELS) {
+            return false;
+        }
+        for (unsigned long l = first; l <= last; ++l) {
+            chosen[l] = true;
+        }
+        s = end;
+        if (*s == ',') {
+            s++;
+        } else if (*s) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static int compare_u64(const void* a, const void* b) {
+    uint64_t x = *(const uint64_t*)a;
+    uint64_t y = *(const uint64_t*)b;
+    return x < y ? -1 : x > y;
+}
+
+static void usage(void) {
+    fprintf(stderr, "usage: step_bench [-k ticks] [-l levels] [-p players] [-s seed] [-i idle|random:<seed>|file]\n");
+}
+
+int main(int argc, char** argv) {
+    uint32_t ticks = DEFAULT_TICKS;
+    uint32_t players = 1;
+    uint16_t seed = DANDY_RNG_SEED;
+    bool chosen[DANDY_NUM_LEVELS];
+    InputScript script = { INPUT_RANDOM, 1, NULL, 0 };
+    int opt;
+
+    parse_levels("all", chosen);
+    while ((opt = getopt(argc, argv, "k:l:p:s:i:")) != -1) {
+        switch (opt) {
+        case 'k': ticks = (uint32_t)strtoul(optarg, NULL, 0); break;
+        case 'l':
+            if (!parse_levels(optarg, chosen)) {
+                fprintf(stderr, "Bad level list '%s'\n", optarg);
+                return 2;
+            }
+            break;
+        case 'p': players = (uint32_t)strtoul(optarg, NULL, 0); break;
+        case 's': seed = (uint16_t)strtoul(optarg, NULL, 0); break;
+        case 'i':
+            if (strcmp(optarg, "idle") == 0) {
+                script.kind = INPUT_IDLE;
+            } else if (strncmp(optarg, "random:", 7) == 0) {
+                script.kind = INPUT_RANDOM;
+                script.seed = (uint32_t)strtoul(optarg + 7, NULL, 0);
+            } else if (!load_recording(optarg, &script)) {
+                return 1;
+            }
+            break;
+        default: usage(); return 2;
+        }
+    }
+    if (ticks == 0 || players < 1 || players > MAX_PLAYERS) {
+        usage();
+        return 2;
+    }
+
+    uint32_t buffer_ticks = ticks > VERIFY_TICKS ? ticks : VERIFY_TICKS;
+    uint8_t* inputs = (uint8_t*)malloc((size_t)buffer_ticks * MAX_PLAYERS);
+    uint64_t* tick_stamps = (uint64_t*)malloc(sizeof(uint64_t) * ticks);
+    if (!inputs || !tick_stamps) {
+        fprintf(stderr, "Out of memory\n");
+        return 1;
+    }
+
+    // The timed copy of dandy_step must play exactly like the real one
+    for (uint8_t level = 0; level < DANDY_NUM_LEVELS; ++level) {
+        if (!chosen[level]) {
+            continue;
+        }
+        uint64_t phases[NUM_PHASES] = {0};
+        fill_inputs(&script, level, VERIFY_TICKS, inputs);
+        start_level(&bench_ctx, level, (uint8_t)players, seed);
+        start_level(&check_ctx, level, (uint8_t)players, seed);
+        for (uint32_t t = 0; t < VERIFY_TICKS; ++t) {
+            dandy_step(&check_ctx, inputs + t * MAX_PLAYERS);
+            timed_step(&bench_ctx, inputs + t * MAX_PLAYERS, phases);
+            if (memcmp(&bench_ctx, &check_ctx, sizeof(DandyContext)) != 0) {
+                fprintf(stderr, "Timed step differs from dandy_step on level %u at tick %u\n", level, t);
+                return 1;
+            }
+        }
+    }
+
+#ifdef BENCH_HAVE_TSC
+    const char* stamp_unit = "TSC";
+#else
+    const char* stamp_unit = "clock_gettime";
+#endif
+    printf("%u ticks per level, %u player%s, seed 0x%04X, %s inputs, phase timer: %s\n\n",
+           ticks, players, players == 1 ? "" : "s", seed,
+           script.kind == INPUT_IDLE ? "idle" : script.kind == INPUT_RANDOM ? "random" : "recorded",
+           stamp_unit);
+    printf("%-5s %12s %9s %9s %9s %9s", "level", "ticks/s", "p50 ns", "p90 ns", "p99 ns", "max ns");
+    for (uint8_t ph = 0; ph < NUM_PHASES; ++ph) {
+        printf(" %9s", phase_names[ph]);
+    }
+    printf("\n");
+
+    double total_ns = 0;
+    uint64_t total_ticks = 0;
+    uint64_t all_phases[NUM_PHASES] = {0};
+    double all_stamps = 0;
+    double all_stamp_ns = 0;
+    for (uint8_t level = 0; level < DANDY_NUM_LEVELS; ++level) {
+        if (!chosen[level]) {
+            continue;
+        }
+        fill_inputs(&script, level, ticks, inputs);
+
+        // Throughput: plain dandy_step
+        start_level(&bench_ctx, level, (uint8_t)players, seed);
+        double start_ns = now_ns();
+        for (uint32_t t = 0; t < ticks; ++t) {
+            dandy_step(&bench_ctx, inputs + t * MAX_PLAYERS);
+        }
+        double elapsed_ns = now_ns() - start_ns;
+        total_ns += elapsed_ns;
+        total_ticks += ticks;
+
+        // Distribution and phases: the timed copy, with the stamp rate
+        // measured over the same run
+        uint64_t phases[NUM_PHASES] = {0};
+        start_level(&bench_ctx, level, (uint8_t)players, seed);
+        double run_start_ns = now_ns();
+        uint64_t run_start = now_stamp();
+        for (uint32_t t = 0; t < ticks; ++t) {
+            tick_stamps[t] = timed_step(&bench_ctx, inputs + t * MAX_PLAYERS, phases);
+        }
+        double run_stamps = (double)(now_stamp() - run_start);
+        double run_ns = now_ns() - run_start_ns;
+        double stamps_per_ns = run_ns > 0 && run_stamps > 0 ? run_stamps / run_ns : 1;
+        all_stamps += run_stamps;
+        all_stamp_ns += run_ns;
+
+        qsort(tick_stamps, ticks, sizeof(uint64_t), compare_u64);
+        printf("%-5u %12.0f %9.0f %9.0f %9.0f %9.0f", level, ticks / (elapsed_ns * 1e-9),
+               tick_stamps[ticks / 2] / stamps_per_ns,
+               tick_stamps[(uint64_t)ticks * 90 / 100] / stamps_per_ns,
+               tick_stamps[(uint64_t)ticks * 99 / 100] / stamps_per_ns,
+               tick_stamps[ticks - 1] / stamps_per_ns);
+        for (uint8_t ph = 0; ph < NUM_PHASES; ++ph) {
+            printf(" %9.1f", phases[ph] / stamps_per_ns / ticks);
+            all_phases[ph] += phases[ph];
+        }
+        printf("\n");
+    }
+
+    if (total_ticks) {
+        double stamps_per_ns = all_stamp_ns > 0 ? all_stamps / all_stamp_ns : 1;
+        uint64_t phase_total = 0;
+        for (uint8_t ph = 0; ph < NUM_PHASES; ++ph) {
+            phase_total += all_phases[ph];
+        }
+        printf("\nall: %.0f ticks/s, %.1f ns/tick\n", total_ticks / (total_ns * 1e-9), total_ns / total_ticks);
+        printf("phases (ns/tick, share):");
+        for (uint8_t ph = 0; ph < NUM_PHASES; ++ph) {
+            printf("  %s %.1f %.0f%%", phase_names[ph], all_phases[ph] / stamps_per_ns / total_ticks,
+                   phase_total ? 100.0 * all_phases[ph] / phase_total : 0.0);
+        }
+        printf("\n");
+    }
+
+    free(inputs);
+    free(tick_stamps);
+    free(script.data);
+    return 0;
+}
@@ -1,20 +1,18 @@
 #include "dandy_core.h"
 #include "levels.h"
+#include <stddef.h>
 #include <string.h>
 
-/* Retro-optimized Lookup Table for row offsets: y * 60 */
-const uint16_t row_offsets[DANDY_LEVEL_HEIGHT] = {
-    0, 60, 120, 180, 240, 300, 360, 420, 480, 540,
-    600, 660, 720, 780, 840, 900, 960, 1020, 1080, 1140,
-    1200, 1260, 1320, 1380, 1440, 1500, 1560, 1620, 1680, 1740
-};
-
 /* Direction Deltas (8-way)
    Directions: 0=Up, 1=Up-Right, 2=Right, 3=Down-Right, 4=Down, 5=Down-Left, 6=Left, 7=Up-Left
 */
 const int8_t dir_delta_x[8] = { 0,  1, 1, 1, 0, -1, -1, -1 };
 const int8_t dir_delta_y[8] = { -1, -1, 0, 1, 1,  1,  0, -1 };
 
+/* The same deltas as map position offsets: dir_delta_y * 64 + dir_delta_x.
+   Add to a position and wrap with MAP_MASK. */
+const int8_t dir_delta_pos[8] = { -64, -63, 1, 65, 64, 63, -1, -65 };
+
 /* Search order for sliding around obstacles */
 const int8_t search_order[3] = { 0, -1, 1 };
 
@@ -50,109 +48,159 @@ const int8_t delta_to_dir[3][3] = {
     { 5, 4, 3 }  // dy =  1 (Down)-> [Down-Left, Down, Down-Right]
 };
 
-/* Game State Globals */
-uint8_t dandy_map[MAP_SIZE];
-uint8_t current_level;
-uint8_t monster_rotor;
-bool player_joined[MAX_PLAYERS];
-uint8_t local_player_idx;
 const uint8_t dandy_num_levels = DANDY_NUM_LEVELS;
+const uint16_t dandy_sizeof_context = sizeof(DandyContext);
+const uint16_t dandy_snapshot_size = sizeof(DandySnapshot);
 
-/* Player State Arrays */
-uint8_t player_x[MAX_PLAYERS];
-uint8_t player_y[MAX_PLAYERS];
-int16_t player_health[MAX_PLAYERS];
-uint16_t player_score[MAX_PLAYERS];
-uint8_t player_bombs[MAX_PLAYERS];
-uint8_t player_keys[MAX_PLAYERS];
-int8_t player_dir[MAX_PLAYERS];
-uint8_t player_move_timer[MAX_PLAYERS];
-
-/* Arrow State Arrays */
-uint8_t arrow_x[MAX_PLAYERS];
-uint8_t arrow_y[MAX_PLAYERS];
-int8_t arrow_dir[MAX_PLAYERS];
-
-bool is_dirty;
-
-
+#ifdef DANDY_SINGLE_CONTEXT
+/* The one game. Functions have no ctx parameter in this build, so ctx
+   names the global and every ctx->field is a fixed address. */
+DandyContext dandy_ctx;
+#define ctx (&dandy_ctx)
+#endif
 
 /* Helper to get the correct tile ID for a player index and direction */
 #define GET_PLAYER_TILE(p_idx, dir) (TILE_PLAYER1 + ((p_idx) << 3) + (dir))
 
+/* Host and Wasm builds decode levels with lookup tables; the GameBoy build
+   (SDCC) keeps the bit-serial decoder. Define DANDY_BITSERIAL_DECODER to
+   force the bit-serial decoder on the host. */
+#if !defined(__SDCC) && !defined(DANDY_BITSERIAL_DECODER)
+#define DANDY_TABLE_DECODER
+#endif
+
 /* Private function declarations */
-static void do_player_buttons(uint8_t p_idx, uint8_t buttons);
-static void move_arrows(void);
-static void move_monsters(void);
-static void get_camera_target(uint8_t p_idx, int16_t* out_x, int16_t* out_y);
-static bool move_player(uint8_t p_idx, uint8_t dir);
-static void do_bomb(uint8_t p_idx);
-static void set_player_start_position(void);
-static void next_level(void);
-static void end_game(void);
-static void iterative_flood_fill(uint8_t start_x, uint8_t start_y, uint8_t oc, uint8_t nc);
+static void decode_level_b2(DANDY_CTX_ const uint8_t* src, uint16_t size);
+static void do_player_buttons(DANDY_CTX_ uint8_t p_idx, uint8_t buttons);
+static void player_events(DANDY_CTX_ uint8_t p_idx, uint8_t events);
+static void move_arrows(DANDY_CTX);
+static void move_arrow(DANDY_CTX_ uint8_t p, int16_t nx, int16_t ny, bool out);
+static void move_monsters(DANDY_CTX);
+static void move_visible_monsters(DANDY_CTX_ const int16_t vp_lefts[MAX_PLAYERS], const int16_t vp_tops[MAX_PLAYERS]);
+static void get_camera_target(DANDY_CTX_ uint8_t p_idx, int16_t* out_x, int16_t* out_y);
+static bool move_player(DANDY_CTX_ uint8_t p_idx, uint8_t dir);
+static void do_bomb(DANDY_CTX_ uint8_t p_idx);
+static uint16_t find_start_position(DANDY_CTX);
+static void set_player_start_position(DANDY_CTX_ uint16_t up_pos);
+static void next_level(DANDY_CTX);
+static void end_game(DANDY_CTX);
+static void open_door(DANDY_CTX_ uint16_t pos);
+static void iterative_flood_fill(DANDY_CTX_ uint16_t start, uint8_t oc, uint8_t nc);
 static int16_t clamp(int16_t val, int16_t min, int16_t max);
 static int8_t to_delta(int16_t a, int16_t b);
+static uint16_t rng_next(DANDY_CTX);
 
-/* Parallel stack arrays for non-recursive flood fill (128 bytes total) */
-#define FLOOD_STACK_SIZE 64
-static uint8_t flood_stack_x[FLOOD_STACK_SIZE];
-static uint8_t flood_stack_y[FLOOD_STACK_SIZE];
-static int8_t flood_stack_ptr = 0;
+/* The flood fill's position stack is ctx->flood_stack_pos. A cell that
+   does not fit is left as TILE_FLOOD_PENDING and picked up by a later pass
+   over the map, so the fill is exact whatever its size. */
+#define TILE_FLOOD_PENDING 0xFF
 
-static void flood_push(uint8_t x, uint8_t y) {
-    if (flood_stack_ptr < FLOOD_STACK_SIZE) {
-        flood_stack_x[flood_stack_ptr] = x;
-        flood_stack_y[flood_stack_ptr] = y;
-        flood_stack_ptr++;
+static void flood_push(DANDY_CTX_ uint16_t pos) {
+    if (ctx->flood_stack_ptr < FLOOD_STACK_SIZE) {
+        ctx->flood_stack_pos[ctx->flood_stack_ptr] = pos;
+        ctx->flood_stack_ptr++;
+    } else {
+        ctx->map[pos] = TILE_FLOOD_PENDING;
+        ctx->flood_overflow = true;
     }
 }
 
+/* ctx->entity_mask holds the active monsters and generators, sliced by
+   rotor phase. Phase (y % 4) * 4 + (x % 4) owns a 15x8 grid of cells; bit
+   x / 4 of entity_mask[phase][y / 4] is set when that cell may hold an entity.
+   Walking a phase's rows and bits low to high visits its cells in the same
+   row-major order as the old sparse map scan, so the generator RNG is
+   consumed in the same order. A set bit over a tile that is no longer an
+   entity is dropped when move_monsters reaches it. */
+#define IS_ENTITY(tile) (((tile) >= TILE_MONSTER1 && (tile) <= TILE_MONSTER3) || \
+                         ((tile) >= TILE_GENERATOR1 && (tile) <= TILE_GENERATOR3))
+
+#define ENTITY_PHASE(pos) ((uint8_t)((((pos) >> MAP_WIDTH_SHIFT) & 3) << 2 | ((pos) & 3)))
+#define ENTITY_ROW(pos)   ((uint8_t)((pos) >> (MAP_WIDTH_SHIFT + 2)))
+#define ENTITY_BIT(pos)   ((uint16_t)1 << (((pos) & (MAP_STRIDE - 1)) >> 2))
+
+static void entity_add(DANDY_CTX_ uint16_t pos) {
+    ctx->entity_mask[ENTITY_PHASE(pos)][ENTITY_ROW(pos)] |= ENTITY_BIT(pos);
+}
+
+static void entity_remove(DANDY_CTX_ uint16_t pos) {
+    ctx->entity_mask[ENTITY_PHASE(pos)][ENTITY_ROW(pos)] &= ~ENTITY_BIT(pos);
+}
+
+/* The bits of a phase row (columns x_start, x_start + 4, ...) that fall in
+   a 20-wide viewport starting at vp_left: always exactly 5 of them. */
+#define VIEWPORT_COLS(vp_left, x_start) ((uint16_t)(0x1F << (((vp_left) + 3 - (x_start)) >> 2)))
+
+/* Generator spawns draw from a 16-bit Galois LFSR (taps 0xB400, period
+ * 65535). Zero is the one state it never leaves, so dandy_seed maps it to
+ * the default seed. */
+static uint16_t rng_next(DANDY_CTX) {
+    uint8_t lsb = ctx->rng_state & 1;
+    ctx->rng_state >>= 1;
+    if (lsb) {
+        ctx->rng_state ^= 0xB400u;
+    }
+    return ctx->rng_state;
+}
+
+void dandy_seed(DANDY_CTX_ uint16_t seed) {
+    ctx->rng_state = seed ? seed : DANDY_RNG_SEED;
+}
+
 /* Core Engine Implementation */
 
-void dandy_init(void) {
-    current_level = 0;
-    player_joined[0] = true; // Player 1 is joined by default
+void dandy_init(DANDY_CTX) {
+    ctx->current_level = 0;
+    ctx->player_joined[0] = true; // Player 1 is joined by default
     for (uint8_t p = 1; p < MAX_PLAYERS; ++p) {
-        player_joined[p] = false;
+        ctx->player_joined[p] = false;
     }
-    local_player_idx = 0;
-    monster_rotor = 0;
+    ctx->local_player_idx = 0;
+    ctx->monster_rotor = 0;
+    ctx->rng_state = DANDY_RNG_SEED;
     
     for (uint8_t p = 0; p < MAX_PLAYERS; ++p) {
-        player_score[p] = 0;
-        player_health[p] = 100;
-        player_bombs[p] = 0;
-        player_keys[p] = 0;
-        player_dir[p] = 0;
-        player_move_timer[p] = 0;
-        arrow_dir[p] = -1;
+        ctx->player_score[p] = 0;
+        ctx->player_health[p] = 100;
+        ctx->player_bombs[p] = 0;
+        ctx->player_keys[p] = 0;
+        ctx->player_dir[p] = 0;
+        ctx->player_move_timer[p] = 0;
+        ctx->old_buttons[p] = 0;
+        ctx->arrow_dir[p] = -1;
     }
     
-    dandy_load_level(current_level);
+    dandy_load_level(DANDY_ARG_ ctx->current_level);
 }
 
-void dandy_load_level(uint8_t level_idx) {
-    if (level_idx >= DANDY_NUM_LEVELS) {
-        level_idx = DANDY_NUM_LEVELS - 1;
+void dandy_rebuild_entities(DANDY_CTX) {
+    // The map may have been rewritten, so the ROM door groups can't be trusted
+    ctx->door_runs = NULL;
+    memset(ctx->entity_mask, 0, sizeof(ctx->entity_mask));
+    for (uint8_t y = 0; y < DANDY_LEVEL_HEIGHT; ++y) {
+        uint16_t row_offset = MAP_POS(0, y);
+        for (uint8_t x = 0; x < DANDY_LEVEL_WIDTH; ++x) {
+            if (IS_ENTITY(ctx->map[row_offset + x])) {
+                entity_add(DANDY_ARG_ row_offset + x);
+            }
+        }
     }
+}
 
-    // 1. Initialize the entire 1,800-byte map buffer with Wall tiles (ID 1)
-    // This is extremely fast as it uses the platform's assembly-optimized memset.
-    memset(dandy_map, TILE_WALL, MAP_SIZE);
+#ifndef DANDY_TABLE_DECODER
 
-    // 2. Setup bitstream decoder pointers and cache
-    const uint8_t* src = dandy_levels[level_idx];
-    const uint8_t* src_end = src + dandy_level_sizes[level_idx];
+/* Bit-serial Scheme B2 decoder, tuned for the Z80. */
+static void decode_level_b2(DANDY_CTX_ const uint8_t* src, uint16_t size) {
+    // Setup bitstream decoder pointers and cache
+    const uint8_t* src_end = src + size;
     uint8_t bit_cache = 0;
     uint8_t bit_count = 0;
 
-    // 3. Decode into the inner 58x28 grid
+    // Decode into the inner 58x28 grid
     // Outer border (row 0, row 29, col 0, col 59) remains TILE_WALL (1).
     for (uint8_t y = 1; y <= 28; ++y) {
-        // Use row_offsets table to avoid slow 16-bit multiplication (y * 60)
         // Set dst to point to column 1 of the current row
-        uint8_t* dst = &dandy_map[row_offsets[y] + 1];
+        uint8_t* dst = &ctx->map[MAP_POS(1, y)];
 
         for (uint8_t x = 1; x <= 58; ++x) {
             // Read 1st bit
@@ -209,6 +257,7 @@ void dandy_load_level(uint8_t level_idx) {
                     tile_id <<= 1; if (bit_cache & 0x80) tile_id |= 1; bit_cache <<= 1; bit_count--;
                     
                     *dst = tile_id;
+                    if (IS_ENTITY(tile_id)) entity_add(DANDY_ARG_ (uint16_t)(dst - ctx->map));
                 }
             }
             
@@ -216,62 +265,188 @@ void dandy_load_level(uint8_t level_idx) {
             dst++;
         }
     }
+}
 
-    // 4. Post-decompression setup (standard engine logic)
-    set_player_start_position();
+#else
+
+/* Table-driven Scheme B2 decoder for host and Wasm builds.
+   Each table entry holds every complete code in one 8-bit window of the
+   stream: up to 8 tiles (8 Spaces), and how many bits they used. Every
+   window starts with at least one complete code, since the longest code
+   is 6 bits. */
+typedef struct {
+    uint8_t tiles[8];
+    uint8_t count;
+    uint8_t bits;
+} B2TableEntry;
+
+static B2TableEntry b2_table[256];
+static bool b2_table_ready = false;
+
+static void b2_table_init(void) {
+    for (uint16_t v = 0; v < 256; ++v) {
+        B2TableEntry* e = &b2_table[v];
+        uint8_t pos = 0;
+        memset(e, 0, sizeof(*e));
+        while (pos < 8) {
+            uint8_t left = 8 - pos;
+            if (((v << pos) & 0x80) == 0) {
+                e->tiles[e->count++] = TILE_SPACE;
+                pos += 1;
+            } else if (left < 2) {
+                break;
+            } else if (((v << pos) & 0x40) == 0) {
+                e->tiles[e->count++] = TILE_WALL;
+                pos += 2;
+            } else if (left < 6) {
+                break;
+            } else {
+                e->tiles[e->count++] = (uint8_t)((v >> (left - 6)) & 0x0F);
+                pos += 6;
+            }
+        }
+        e->bits = pos;
+    }
+    // Written last; a racing caller just rebuilds identical entries.
+    b2_table_ready = true;
+}
+
+static uint64_t load_be64(const uint8_t* p) {
+    return ((uint64_t)p[0] << 56) | ((uint64_t)p[1] << 48) |
+           ((uint64_t)p[2] << 40) | ((uint64_t)p[3] << 32) |
+           ((uint64_t)p[4] << 24) | ((uint64_t)p[5] << 16) |
+           ((uint64_t)p[6] << 8)  |  (uint64_t)p[7];
+}
+
+#define B2_INNER_WIDTH       (DANDY_LEVEL_WIDTH - 2)
+#define B2_INNER_TILES       (B2_INNER_WIDTH * (DANDY_LEVEL_HEIGHT - 2))
+#define B2_MAX_STREAM_BYTES  ((B2_INNER_TILES * 6 + 7) / 8) // Every tile a 6-bit code
+#define B2_LOOKUPS_PER_LOAD  6                              // 6 * 8 bits fit in the 57 valid bits
+
+static void decode_level_b2(DANDY_CTX_ const uint8_t* src, uint16_t size) {
+    // Copy the stream into a zero-padded buffer. Reading past the end then
+    // yields 0 bits (Spaces), exactly like the bit-serial decoder, without a
+    // bounds check on every refill.
+    uint8_t stream[B2_MAX_STREAM_BYTES + 8];
+    uint16_t n = size < B2_MAX_STREAM_BYTES ? size : B2_MAX_STREAM_BYTES;
+    memcpy(stream, src, n);
+    memset(stream + n, 0, sizeof(stream) - n);
+
+    // Decode linearly, with slack for the last batch of lookups to overrun.
+    uint8_t inner[B2_INNER_TILES + 8 * B2_LOOKUPS_PER_LOAD];
+    uint8_t* out = inner;
+    uint8_t* out_end = inner + B2_INNER_TILES;
+    uint32_t pos = 0;
+
+    if (!b2_table_ready) {
+        b2_table_init();
+    }
+
+    while (out < out_end) {
+        // 64-bit bit buffer, MSB first; at least 57 bits are valid after the shift.
+        uint64_t bit_buffer = load_be64(stream + (pos >> 3)) << (pos & 7);
+        for (uint8_t k = 0; k < B2_LOOKUPS_PER_LOAD; ++k) {
+            const B2TableEntry* e = &b2_table[bit_buffer >> 56];
+            memcpy(out, e->tiles, 8);
+            out += e->count;
+            bit_buffer <<= e->bits;
+            pos += e->bits;
+        }
+    }
+
+    // Scatter the rows into the inner grid. The border stays TILE_WALL.
+    for (uint8_t y = 1; y <= 28; ++y) {
+        const uint8_t* row = &inner[(y - 1) * B2_INNER_WIDTH];
+        memcpy(&ctx->map[MAP_POS(1, y)], row, B2_INNER_WIDTH);
+        for (uint8_t x = 0; x < B2_INNER_WIDTH; ++x) {
+            if (IS_ENTITY(row[x])) entity_add(DANDY_ARG_ MAP_POS(x + 1, y));
+        }
+    }
+}
+
+#endif /* DANDY_TABLE_DECODER */
+
+void dandy_load_level(DANDY_CTX_ uint8_t level_idx) {
+    if (level_idx >= DANDY_NUM_LEVELS) {
+        level_idx = DANDY_NUM_LEVELS - 1;
+    }
+
+    // 1. Initialize the entire 2,048-byte map buffer with Wall tiles (ID 1),
+    // which also (re)builds the padding sentinels.
+    // This is extremely fast as it uses the platform's assembly-optimized memset.
+    memset(ctx->map, TILE_WALL, MAP_SIZE);
+    memset(ctx->entity_mask, 0, sizeof(ctx->entity_mask));
+
+    // 2-3. Decode the B2 stream into the inner 58x28 grid. The decoder adds
+    // monsters and generators to entity_mask as it writes them.
+    const uint8_t* stream = dandy_levels[level_idx];
+    decode_level_b2(DANDY_ARG_ stream, dandy_level_sizes[level_idx]);
+
+    // 4. Post-decompression setup. The start and door groups come from the
+    // level's metadata, unless the stream was swapped in at run time (the
+    // host tests do this). Players placed over a monster leave a stale
+    // entity bit, which move_monsters drops.
+    const DandyLevelInfo* info = &dandy_level_info[level_idx];
+    if (info->level == stream) {
+        ctx->door_runs = info->door_runs;
+        set_player_start_position(DANDY_ARG_ info->start_pos);
+    } else {
+        ctx->door_runs = NULL;
+        set_player_start_position(DANDY_ARG_ find_start_position(DANDY_ARG));
+    }
     
     for (uint8_t p = 0; p < MAX_PLAYERS; ++p) {
-        arrow_dir[p] = -1;
+        ctx->arrow_dir[p] = -1;
     }
-    is_dirty = true;
+    ctx->is_dirty = true;
 }
 
-void dandy_step(const uint8_t player_inputs[MAX_PLAYERS]) {
+void dandy_step(DANDY_CTX_ const uint8_t player_inputs[MAX_PLAYERS]) {
     // Bounds check player positions to prevent out-of-bounds memory access
     for (uint8_t p = 0; p < MAX_PLAYERS; ++p) {
-        if (player_joined[p]) {
-            if (player_x[p] >= DANDY_LEVEL_WIDTH) player_x[p] = DANDY_LEVEL_WIDTH - 1;
-            if (player_y[p] >= DANDY_LEVEL_HEIGHT) player_y[p] = DANDY_LEVEL_HEIGHT - 1;
+        if (ctx->player_joined[p]) {
+            if (ctx->player_x[p] >= DANDY_LEVEL_WIDTH) ctx->player_x[p] = DANDY_LEVEL_WIDTH - 1;
+            if (ctx->player_y[p] >= DANDY_LEVEL_HEIGHT) ctx->player_y[p] = DANDY_LEVEL_HEIGHT - 1;
         }
     }
     for (uint8_t p = 0; p < MAX_PLAYERS; ++p) {
-        if (player_joined[p] && player_health[p] > 0) {
-            do_player_buttons(p, player_inputs[p]);
+        if (ctx->player_joined[p] && ctx->player_health[p] > 0) {
+            do_player_buttons(DANDY_ARG_ p, player_inputs[p]);
         }
     }
-    move_arrows();
-    move_monsters();
+    move_arrows(DANDY_ARG);
+    move_monsters(DANDY_ARG);
     
-    // Update HUD (HAL reads globals directly now)
-    hal_update_hud();
+    // Update HUD (the HAL reads the context directly)
+    hal_update_hud(DANDY_ARG);
     
     // Check if all players are dead (game over)
     bool all_dead = true;
     for (uint8_t p = 0; p < MAX_PLAYERS; ++p) {
-        if (player_joined[p] && player_health[p] > 0) {
+        if (ctx->player_joined[p] && ctx->player_health[p] > 0) {
             all_dead = false;
             break;
         }
     }
     
     if (all_dead) {
-        end_game();
+        end_game(DANDY_ARG);
     }
 }
 
-static void get_camera_target(uint8_t p_idx, int16_t* out_x, int16_t* out_y) {
-    int16_t target_x = player_x[p_idx];
-    int16_t target_y = player_y[p_idx];
+static void get_camera_target(DANDY_CTX_ uint8_t p_idx, int16_t* out_x, int16_t* out_y) {
+    int16_t target_x = ctx->player_x[p_idx];
+    int16_t target_y = ctx->player_y[p_idx];
     
     // Spectator Mode: If player is dead, center viewport on the centroid of remaining alive players
-    if (player_health[p_idx] <= 0) {
+    if (ctx->player_health[p_idx] <= 0) {
         uint16_t sum_x = 0;
         uint16_t sum_y = 0;
         uint8_t alive_count = 0;
         for (uint8_t p = 0; p < MAX_PLAYERS; ++p) {
-            if (p != p_idx && player_joined[p] && player_health[p] > 0) {
-                sum_x += player_x[p];
-                sum_y += player_y[p];
+            if (p != p_idx && ctx->player_joined[p] && ctx->player_health[p] > 0) {
+                sum_x += ctx->player_x[p];
+                sum_y += ctx->player_y[p];
                 alive_count++;
             }
         }
@@ -284,24 +459,24 @@ static void get_camera_target(uint8_t p_idx, int16_t* out_x, int16_t* out_y) {
     *out_y = target_y;
 }
 
-void dandy_draw_viewport(uint8_t local_p_idx) {
-    if (local_p_idx >= MAX_PLAYERS || !player_joined[local_p_idx]) local_p_idx = 0;
+void dandy_draw_viewport(DANDY_CTX_ uint8_t local_p_idx) {
+    if (local_p_idx >= MAX_PLAYERS || !ctx->player_joined[local_p_idx]) local_p_idx = 0;
     
     int16_t target_x, target_y;
-    get_camera_target(local_p_idx, &target_x, &target_y);
+    get_camera_target(DANDY_ARG_ local_p_idx, &target_x, &target_y);
     
     int16_t vp_left = clamp(target_x - 10, 0, DANDY_LEVEL_WIDTH - 20);
     int16_t vp_top = clamp(target_y - 5, 0, DANDY_LEVEL_HEIGHT - 10);
     
     // 1. Clear sprites for this viewport, passing camera scroll offsets
-    hal_clear_sprites((uint8_t)vp_left, (uint8_t)vp_top);
+    hal_clear_sprites(DANDY_ARG_ (uint8_t)vp_left, (uint8_t)vp_top);
     uint8_t sprite_count = 0;
     
     // 2. Draw viewport grid
     for (uint8_t sy = 0; sy < 10; ++sy) {
-        uint16_t row_offset = row_offsets[vp_top + sy];
+        uint16_t row_offset = MAP_POS(0, vp_top + sy);
         for (uint8_t sx = 0; sx < 20; ++sx) {
-            uint8_t tile = dandy_map[row_offset + (vp_left + sx)];
+            uint8_t tile = ctx->map[row_offset + (vp_left + sx)];
             
             // Check if the tile is a dynamic entity that should be drawn as a hardware sprite
             bool is_sprite = false;
@@ -315,7 +490,7 @@ void dandy_draw_viewport(uint8_t local_p_idx) {
             
             if (is_sprite) {
                 // Draw background behind the sprite
-                hal_draw_tile(sx, sy, TILE_SPACE);
+                hal_draw_tile(DANDY_ARG_ sx, sy, TILE_SPACE);
                 
                 // Register a hardware sprite (8x8 pixel coordinates in viewport space)
                 if (sprite_count < 40) {
@@ -323,18 +498,18 @@ void dandy_draw_viewport(uint8_t local_p_idx) {
                     if (tile >= TILE_ARROW && tile <= TILE_ARROW + 7) {
                         // Find which player owns the arrow at this map position
                         for (uint8_t ap = 0; ap < MAX_PLAYERS; ++ap) {
-                            if (player_joined[ap] && arrow_dir[ap] != -1 &&
-                                arrow_x[ap] == (vp_left + sx) && arrow_y[ap] == (vp_top + sy)) {
+                            if (ctx->player_joined[ap] && ctx->arrow_dir[ap] != -1 &&
+                                ctx->arrow_x[ap] == (vp_left + sx) && ctx->arrow_y[ap] == (vp_top + sy)) {
                                 sprite_flags = ap; // Store player index (0..3) in flags
                                 break;
                             }
                         }
                     }
-                    hal_set_sprite(sprite_count++, sx * 8, sy * 8, tile, sprite_flags);
+                    hal_set_sprite(DANDY_ARG_ sprite_count++, sx * 8, sy * 8, tile, sprite_flags);
                 }
             } else {
                 // Static tile (wall, door, items, generator, etc.)
-                hal_draw_tile(sx, sy, tile);
+                hal_draw_tile(DANDY_ARG_ sx, sy, tile);
             }
         }
     }
@@ -343,149 +518,176 @@ void dandy_draw_viewport(uint8_t local_p_idx) {
 static const int8_t spawn_offsets_x[4] = { 0, 1, 0, -1 };
 static const int8_t spawn_offsets_y[4] = { -1, 0, 1, 0 };
 
-static void set_player_start_position(void) {
-    int16_t up_x = 1, up_y = 2; // Fallback defaults
-    bool found = false;
-    
-    // Sweep map using nested loops to get x and y coordinates directly,
-    // completely avoiding slow 16-bit division, modulo, and bit-shifts!
-    for (uint8_t y = 0; y < DANDY_LEVEL_HEIGHT; ++y) {
-        uint16_t row_offset = row_offsets[y];
-        for (uint8_t x = 0; x < DANDY_LEVEL_WIDTH; ++x) {
-            if (dandy_map[row_offset + x] == TILE_UP) {
-                up_x = x;
-                up_y = y;
-                found = true;
-                break;
-            }
+/* The first TILE_UP in row-major order, for levels without metadata */
+static uint16_t find_start_position(DANDY_CTX) {
+    for (uint16_t pos = 0; pos < MAP_POS(0, DANDY_LEVEL_HEIGHT); ++pos) {
+        if (ctx->map[pos] == TILE_UP) {
+            return pos;
         }
-        if (found) break;
     }
+    return MAP_POS(1, 2); // Fallback default
+}
+
+static void set_player_start_position(DANDY_CTX_ uint16_t up_pos) {
+    // x and y are just the two fields of the map position
+    int16_t up_x = up_pos & (MAP_STRIDE - 1);
+    int16_t up_y = up_pos >> MAP_WIDTH_SHIFT;
     
     for (uint8_t p = 0; p < MAX_PLAYERS; ++p) {
         int16_t px = clamp(up_x + spawn_offsets_x[p], 0, DANDY_LEVEL_WIDTH - 1);
         int16_t py = clamp(up_y + spawn_offsets_y[p], 0, DANDY_LEVEL_HEIGHT - 1);
         
-        player_x[p] = (uint8_t)px;
-        player_y[p] = (uint8_t)py;
+        ctx->player_x[p] = (uint8_t)px;
+        ctx->player_y[p] = (uint8_t)py;
         
         // Only place player tile in map if player is active
-        if (player_joined[p]) {
-            dandy_map[row_offsets[player_y[p]] + player_x[p]] = GET_PLAYER_TILE(p, player_dir[p]);
+        if (ctx->player_joined[p]) {
+            ctx->map[MAP_POS(ctx->player_x[p], ctx->player_y[p])] = GET_PLAYER_TILE(p, ctx->player_dir[p]);
         }
     }
 }
 
-static void next_level(void) {
-    if (current_level < DANDY_NUM_LEVELS - 1) {
-        current_level++;
+static void next_level(DANDY_CTX) {
+    if (ctx->current_level < DANDY_NUM_LEVELS - 1) {
+        ctx->current_level++;
     }
-    dandy_load_level(current_level);
+    dandy_load_level(DANDY_ARG_ ctx->current_level);
 }
 
-static void end_game(void) {
-    current_level = 0;
-    player_joined[0] = true;
+static void end_game(DANDY_CTX) {
+    ctx->current_level = 0;
+    ctx->player_joined[0] = true;
     for (uint8_t p = 1; p < MAX_PLAYERS; ++p) {
-        player_joined[p] = false;
+        ctx->player_joined[p] = false;
     }
     for (uint8_t p = 0; p < MAX_PLAYERS; ++p) {
-        player_health[p] = 100;
-        player_keys[p] = 0;
-        player_bombs[p] = 0;
-        player_score[p] = 0;
-        player_dir[p] = 0;
+        ctx->player_health[p] = 100;
+        ctx->player_keys[p] = 0;
+        ctx->player_bombs[p] = 0;
+        ctx->player_score[p] = 0;
+        ctx->player_dir[p] = 0;
     }
-    dandy_load_level(current_level);
+    dandy_load_level(DANDY_ARG_ ctx->current_level);
 }
 
-static void do_player_buttons(uint8_t p_idx, uint8_t buttons) {
-    static uint8_t old_buttons[MAX_PLAYERS] = {0, 0, 0, 0};
-    uint8_t delta_down = buttons & ~old_buttons[p_idx];
-    old_buttons[p_idx] = buttons;
+/* What a player's buttons did this tick, for player_events */
+#define PLAYER_EVENT_BOMB 1 // Bomb pressed with bombs left (already spent)
+#define PLAYER_EVENT_FIRE 2 // Arrow fired (already placed)
+#define PLAYER_EVENT_TURN 4 // Direction pressed (player_dir already set)
+#define PLAYER_EVENT_MOVE 8 // ...and the move timer was due
+
+/* The player's own fields first, then everything that touches the map, in
+   the same order. A bomb only reads the player's position and a move never
+   reads the move timer, so this is the same as doing each button in turn.
+   The lockstep engine (bench/lockstep.c) does the first half for many
+   games at once and calls player_events per game. */
+static void do_player_buttons(DANDY_CTX_ uint8_t p_idx, uint8_t buttons) {
+    uint8_t delta_down = buttons & ~ctx->old_buttons[p_idx];
+    uint8_t events = 0;
+    ctx->old_buttons[p_idx] = buttons;
     
     // Smart Bomb (Edge triggered)
     if (delta_down & BUTTON_BOMB) {
-        if (player_bombs[p_idx] > 0) {
-            player_bombs[p_idx]--;
-            do_bomb(p_idx);
-            hal_play_sound(SOUND_BOMB);
+        if (ctx->player_bombs[p_idx] > 0) {
+            ctx->player_bombs[p_idx]--;
+            events |= PLAYER_EVENT_BOMB;
         }
     }
     
     // Fire Arrow (Level triggered)
     if (buttons & BUTTON_FIRE) {
-        if (arrow_dir[p_idx] == -1) {
-            arrow_x[p_idx] = player_x[p_idx];
-            arrow_y[p_idx] = player_y[p_idx];
-            arrow_dir[p_idx] = player_dir[p_idx];
-            hal_play_sound(SOUND_SHOOT);
+        if (ctx->arrow_dir[p_idx] == -1) {
+            ctx->arrow_x[p_idx] = ctx->player_x[p_idx];
+            ctx->arrow_y[p_idx] = ctx->player_y[p_idx];
+            ctx->arrow_dir[p_idx] = ctx->player_dir[p_idx];
+            events |= PLAYER_EVENT_FIRE;
         }
     }
     
     // Movement
     int8_t d = buttons_to_dir[buttons & 0x0F];
     if (d >= 0) {
-        player_dir[p_idx] = d;
+        ctx->player_dir[p_idx] = d;
+        events |= PLAYER_EVENT_TURN;
+        if (ctx->player_move_timer[p_idx] == 0) {
+            ctx->player_move_timer[p_idx] = TICKS_PER_MOVE;
+            events |= PLAYER_EVENT_MOVE;
+        }
+    }
+    
+    if (ctx->player_move_timer[p_idx] > 0) {
+        ctx->player_move_timer[p_idx]--;
+    }
+    
+    if (events) {
+        player_events(DANDY_ARG_ p_idx, events);
+    }
+}
+
+static void player_events(DANDY_CTX_ uint8_t p_idx, uint8_t events) {
+    if (events & PLAYER_EVENT_BOMB) {
+        do_bomb(DANDY_ARG_ p_idx);
+        hal_play_sound(DANDY_ARG_ SOUND_BOMB);
+    }
+    if (events & PLAYER_EVENT_FIRE) {
+        hal_play_sound(DANDY_ARG_ SOUND_SHOOT);
+    }
+    if (events & PLAYER_EVENT_TURN) {
         // Update player sprite direction in map immediately
-        dandy_map[row_offsets[player_y[p_idx]] + player_x[p_idx]] = GET_PLAYER_TILE(p_idx, player_dir[p_idx]);
-        is_dirty = true;
+        ctx->map[MAP_POS(ctx->player_x[p_idx], ctx->player_y[p_idx])] = GET_PLAYER_TILE(p_idx, ctx->player_dir[p_idx]);
+        ctx->is_dirty = true;
         
-        if (player_move_timer[p_idx] == 0) {
-            player_move_timer[p_idx] = TICKS_PER_MOVE;
+        if (events & PLAYER_EVENT_MOVE) {
             // Slide mechanics: try main direction, then ±1 direction
             for (uint8_t di = 0; di < 3; ++di) {
-                int8_t dd = (player_dir[p_idx] + search_order[di]) & 7;
-                if (move_player(p_idx, dd)) {
+                int8_t dd = (ctx->player_dir[p_idx] + search_order[di]) & 7;
+                if (move_player(DANDY_ARG_ p_idx, dd)) {
                     break;
                 }
             }
         }
     }
-    
-    if (player_move_timer[p_idx] > 0) {
-        player_move_timer[p_idx]--;
-    }
 }
 
-static bool move_player(uint8_t p_idx, uint8_t dir) {
-    int16_t nx = clamp((int16_t)player_x[p_idx] + dir_delta_x[dir], 0, DANDY_LEVEL_WIDTH - 1);
-    int16_t ny = clamp((int16_t)player_y[p_idx] + dir_delta_y[dir], 0, DANDY_LEVEL_HEIGHT - 1);
-    uint16_t pos = row_offsets[ny] + nx;
-    uint8_t tile = dandy_map[pos];
+static bool move_player(DANDY_CTX_ uint8_t p_idx, uint8_t dir) {
+    // No clamping: stepping off the level lands on a padding wall
+    uint8_t nx = ctx->player_x[p_idx] + dir_delta_x[dir];
+    uint8_t ny = ctx->player_y[p_idx] + dir_delta_y[dir];
+    uint16_t pos = (MAP_POS(ctx->player_x[p_idx], ctx->player_y[p_idx]) + dir_delta_pos[dir]) & MAP_MASK;
+    uint8_t tile = ctx->map[pos];
     bool can_move = true;
     
     switch (tile) {
         case TILE_SPACE:
             break;
         case TILE_DOOR:
-            if (player_keys[p_idx] > 0) {
-                player_keys[p_idx]--;
-                iterative_flood_fill(nx, ny, TILE_DOOR, TILE_SPACE);
-                hal_play_sound(SOUND_KEY);
+            if (ctx->player_keys[p_idx] > 0) {
+                ctx->player_keys[p_idx]--;
+                open_door(DANDY_ARG_ MAP_POS(nx, ny));
+                hal_play_sound(DANDY_ARG_ SOUND_KEY);
             } else {
                 can_move = false;
             }
             break;
         case TILE_MONEY:
-            player_score[p_idx] += 100;
-            hal_play_sound(SOUND_KEY);
+            ctx->player_score[p_idx] += 100;
+            hal_play_sound(DANDY_ARG_ SOUND_KEY);
             break;
         case TILE_KEY:
-            player_keys[p_idx]++;
-            hal_play_sound(SOUND_KEY);
+            ctx->player_keys[p_idx]++;
+            hal_play_sound(DANDY_ARG_ SOUND_KEY);
             break;
         case TILE_BOMB:
-            player_bombs[p_idx]++;
-            hal_play_sound(SOUND_KEY);
+            ctx->player_bombs[p_idx]++;
+            hal_play_sound(DANDY_ARG_ SOUND_KEY);
             break;
         case TILE_FOOD:
-            player_health[p_idx] += 100;
-            hal_play_sound(SOUND_FOOD);
+            ctx->player_health[p_idx] += 100;
+            hal_play_sound(DANDY_ARG_ SOUND_FOOD);
             break;
         case TILE_DOWN:
-            hal_play_sound(SOUND_WARP);
-            next_level();
+            hal_play_sound(DANDY_ARG_ SOUND_WARP);
+            next_level(DANDY_ARG);
             return true;
         default:
             can_move = false;
@@ -494,98 +696,120 @@ static bool move_player(uint8_t p_idx, uint8_t dir) {
     
     if (can_move) {
         // Clear old position
-        dandy_map[row_offsets[player_y[p_idx]] + player_x[p_idx]] = TILE_SPACE;
+        ctx->map[MAP_POS(ctx->player_x[p_idx], ctx->player_y[p_idx])] = TILE_SPACE;
         // Update coordinates
-        player_x[p_idx] = (uint8_t)nx;
-        player_y[p_idx] = (uint8_t)ny;
+        ctx->player_x[p_idx] = nx;
+        ctx->player_y[p_idx] = ny;
         // Set new position with rotated player sprite
-        dandy_map[row_offsets[player_y[p_idx]] + player_x[p_idx]] = GET_PLAYER_TILE(p_idx, player_dir[p_idx]);
-        is_dirty = true;
+        ctx->map[MAP_POS(ctx->player_x[p_idx], ctx->player_y[p_idx])] = GET_PLAYER_TILE(p_idx, ctx->player_dir[p_idx]);
+        ctx->is_dirty = true;
     }
     
     return can_move;
 }
 
-static void move_arrows(void) {
+static void move_arrows(DANDY_CTX) {
     for (uint8_t p = 0; p < MAX_PLAYERS; ++p) {
-        if (player_joined[p] && arrow_dir[p] != -1) {
-            int16_t nx = clamp((int16_t)arrow_x[p] + dir_delta_x[arrow_dir[p]], 0, DANDY_LEVEL_WIDTH - 1);
-            int16_t ny = clamp((int16_t)arrow_y[p] + dir_delta_y[arrow_dir[p]], 0, DANDY_LEVEL_HEIGHT - 1);
-            
-            uint16_t old_pos = row_offsets[arrow_y[p]] + arrow_x[p];
-            uint16_t new_pos = row_offsets[ny] + nx;
-            
-            uint8_t tile_at_old = dandy_map[old_pos];
-            uint8_t tile_at_new = dandy_map[new_pos];
-            
-            // Clear arrow from old position
-            if (tile_at_old >= TILE_ARROW && tile_at_old <= TILE_ARROW + 7) {
-                dandy_map[old_pos] = TILE_SPACE;
-            }
+        if (ctx->player_joined[p] && ctx->arrow_dir[p] != -1) {
+            // Off-level steps fail the viewport check before new_pos is written
+            int16_t nx = (int16_t)ctx->arrow_x[p] + dir_delta_x[ctx->arrow_dir[p]];
+            int16_t ny = (int16_t)ctx->arrow_y[p] + dir_delta_y[ctx->arrow_dir[p]];
             
             // Viewport boundary check (relative to shooting player p)
-            int16_t vp_left = clamp((int16_t)player_x[p] - 10, 0, DANDY_LEVEL_WIDTH - 20);
-            int16_t vp_top = clamp((int16_t)player_y[p] - 5, 0, DANDY_LEVEL_HEIGHT - 10);
+            int16_t vp_left = clamp((int16_t)ctx->player_x[p] - 10, 0, DANDY_LEVEL_WIDTH - 20);
+            int16_t vp_top = clamp((int16_t)ctx->player_y[p] - 5, 0, DANDY_LEVEL_HEIGHT - 10);
             
-            if (nx < vp_left || ny < vp_top || nx >= vp_left + 20 || ny >= vp_top + 10) {
-                arrow_dir[p] = -1;
-                is_dirty = true;
-                continue;
+            move_arrow(DANDY_ARG_ p, nx, ny,
+                       nx < vp_left || ny < vp_top || nx >= vp_left + 20 || ny >= vp_top + 10);
+        }
+    }
+}
+
+/* The map side of player p's arrow stepping to (nx, ny), or leaving the
+   player's viewport if out. The lockstep engine works out nx, ny and out
+   for many games at once and calls this per game. */
+static void move_arrow(DANDY_CTX_ uint8_t p, int16_t nx, int16_t ny, bool out) {
+    uint16_t old_pos = MAP_POS(ctx->arrow_x[p], ctx->arrow_y[p]);
+    uint16_t new_pos = (old_pos + dir_delta_pos[ctx->arrow_dir[p]]) & MAP_MASK;
+    
+    uint8_t tile_at_old = ctx->map[old_pos];
+    uint8_t tile_at_new = ctx->map[new_pos];
+    
+    // Clear arrow from old position
+    if (tile_at_old >= TILE_ARROW && tile_at_old <= TILE_ARROW + 7) {
+        ctx->map[old_pos] = TILE_SPACE;
+    }
+    
+    if (out) {
+        ctx->arrow_dir[p] = -1;
+        ctx->is_dirty = true;
+        return;
+    }
+    
+    if (tile_at_new != TILE_SPACE) {
+        ctx->arrow_dir[p] = -1; // Die on hit
+        
+        if (tile_at_new >= TILE_BOMB && tile_at_new < TILE_ARROW) {
+            uint8_t replacement = TILE_SPACE;
+            if (tile_at_new == TILE_BOMB) {
+                do_bomb(DANDY_ARG_ p); // Triggered by player p's arrow
+            } else if (tile_at_new == TILE_HEART) {
+                replacement = TILE_MONSTER3;
+            } else if (tile_at_new == TILE_MONSTER2 || tile_at_new == TILE_MONSTER3) {
+                replacement = tile_at_new - 1;
             }
-            
-            if (tile_at_new != TILE_SPACE) {
-                arrow_dir[p] = -1; // Die on hit
-                
-                if (tile_at_new >= TILE_BOMB && tile_at_new < TILE_ARROW) {
-                    uint8_t replacement = TILE_SPACE;
-                    if (tile_at_new == TILE_BOMB) {
-                        do_bomb(p); // Triggered by player p's arrow
-                    } else if (tile_at_new == TILE_HEART) {
-                        replacement = TILE_MONSTER3;
-                    } else if (tile_at_new == TILE_MONSTER2 || tile_at_new == TILE_MONSTER3) {
-                        replacement = tile_at_new - 1;
-                    }
-                    dandy_map[new_pos] = replacement;
-                    hal_play_sound(SOUND_HIT);
-                }
+            ctx->map[new_pos] = replacement;
+            if (replacement == TILE_SPACE) {
+                entity_remove(DANDY_ARG_ new_pos);
             } else {
-                // Move arrow and rotate
-                dandy_map[new_pos] = TILE_ARROW + ((arrow_dir[p] - 5) & 7);
-                arrow_x[p] = (uint8_t)nx;
-                arrow_y[p] = (uint8_t)ny;
+                entity_add(DANDY_ARG_ new_pos);
             }
-            is_dirty = true;
+            hal_play_sound(DANDY_ARG_ SOUND_HIT);
         }
+    } else {
+        // Move arrow and rotate
+        ctx->map[new_pos] = TILE_ARROW + ((ctx->arrow_dir[p] - 5) & 7);
+        ctx->arrow_x[p] = (uint8_t)nx;
+        ctx->arrow_y[p] = (uint8_t)ny;
     }
+    ctx->is_dirty = true;
 }
 
-static void do_bomb(uint8_t p_idx) {
+static void do_bomb(DANDY_CTX_ uint8_t p_idx) {
     // Blow up monsters/generators in the visible viewport of player p_idx
-    int16_t vp_left = clamp((int16_t)player_x[p_idx] - 10, 0, DANDY_LEVEL_WIDTH - 20);
-    int16_t vp_top = clamp((int16_t)player_y[p_idx] - 5, 0, DANDY_LEVEL_HEIGHT - 10);
-    
-    for (uint8_t y = 0; y < 10; ++y) {
-        uint16_t row_offset = row_offsets[vp_top + y];
-        for (uint8_t x = 0; x < 20; ++x) {
-            uint16_t pos = row_offset + (vp_left + x);
-            uint8_t tile = dandy_map[pos];
-            if ((tile >= TILE_MONSTER1 && tile <= TILE_MONSTER3) ||
-                (tile >= TILE_GENERATOR1 && tile <= TILE_GENERATOR3)) {
-                dandy_map[pos] = TILE_SPACE;
+    int16_t vp_left = clamp((int16_t)ctx->player_x[p_idx] - 10, 0, DANDY_LEVEL_WIDTH - 20);
+    int16_t vp_top = clamp((int16_t)ctx->player_y[p_idx] - 5, 0, DANDY_LEVEL_HEIGHT - 10);
+    
+    // Mask each phase's rows down to the viewport instead of reading its 200 cells
+    for (uint8_t phase = 0; phase < 16; ++phase) {
+        uint8_t x_start = phase & 3;
+        uint16_t cols = VIEWPORT_COLS(vp_left, x_start);
+        for (uint8_t r = 0; r < ENTITY_ROWS; ++r) {
+            uint8_t y = (phase >> 2) + (r << 2);
+            if (y < vp_top || y >= vp_top + 10) {
+                continue;
             }
+            uint16_t bits = ctx->entity_mask[phase][r] & cols;
+            uint16_t row_offset = MAP_POS(0, y);
+            for (uint8_t x = x_start; bits; bits >>= 1, x += 4) {
+                if ((bits & 1) && IS_ENTITY(ctx->map[row_offset + x])) {
+                    ctx->map[row_offset + x] = TILE_SPACE;
+                }
+            }
+            ctx->entity_mask[phase][r] &= ~cols;
         }
     }
-    is_dirty = true;
+    ctx->is_dirty = true;
 }
 
 /* Helper to find the nearest active player to a monster */
-static uint8_t get_nearest_player(uint8_t mx, uint8_t my) {
+static uint8_t get_nearest_player(DANDY_CTX_ uint8_t mx, uint8_t my) {
     uint8_t nearest = 0;
     uint16_t min_dist = 0xFFFF;
     for (uint8_t p = 0; p < MAX_PLAYERS; ++p) {
-        if (player_joined[p] && player_health[p] > 0) {
-            uint16_t dist = (player_x[p] > mx ? player_x[p] - mx : mx - player_x[p]) +
-                            (player_y[p] > my ? player_y[p] - my : my - player_y[p]);
+        if (ctx->player_joined[p] && ctx->player_health[p] > 0) {
+            uint16_t dist = (ctx->player_x[p] > mx ? ctx->player_x[p] - mx : mx - ctx->player_x[p]) +
+                            (ctx->player_y[p] > my ? ctx->player_y[p] - my : my - ctx->player_y[p]);
             if (dist < min_dist) {
                 min_dist = dist;
                 nearest = p;
@@ -595,112 +819,126 @@ static uint8_t get_nearest_player(uint8_t mx, uint8_t my) {
     return nearest;
 }
 
-static void move_monsters(void) {
-    uint8_t dx = 4;
-    uint8_t dy = 4;
-    
-    monster_rotor++;
-    if (monster_rotor >= 16) {
-        monster_rotor = 0;
-    }
-    
+static void move_monsters(DANDY_CTX) {
     // Calculate the camera viewport boundaries for all joined players once at the start of the tick.
     int16_t vp_lefts[MAX_PLAYERS];
     int16_t vp_tops[MAX_PLAYERS];
     
     for (uint8_t p = 0; p < MAX_PLAYERS; ++p) {
-        if (player_joined[p]) {
+        if (ctx->player_joined[p]) {
             int16_t target_x, target_y;
-            get_camera_target(p, &target_x, &target_y);
+            get_camera_target(DANDY_ARG_ p, &target_x, &target_y);
             
             vp_lefts[p] = clamp(target_x - 10, 0, DANDY_LEVEL_WIDTH - 20);
             vp_tops[p] = clamp(target_y - 5, 0, DANDY_LEVEL_HEIGHT - 10);
         }
     }
     
-    // Retro Optimization: Scan entire map on a sparse grid
-    uint8_t x_start = monster_rotor % dx;
-    uint8_t y_start = monster_rotor / dx;
+    move_visible_monsters(DANDY_ARG_ vp_lefts, vp_tops);
+}
+
+/* Advances the monster rotor and moves this phase's monsters and
+   generators in the joined players' viewports. The lockstep engine works
+   out the viewports for many games at once and calls this per game. */
+static void move_visible_monsters(DANDY_CTX_ const int16_t vp_lefts[MAX_PLAYERS], const int16_t vp_tops[MAX_PLAYERS]) {
+    uint8_t dx = 4;
+    uint8_t dy = 4;
+    
+    ctx->monster_rotor++;
+    if (ctx->monster_rotor >= 16) {
+        ctx->monster_rotor = 0;
+    }
+    
+    // Retro Optimization: only visit this rotor phase's slice of the entity set
+    uint8_t x_start = ctx->monster_rotor % dx;
+    uint8_t y_start = ctx->monster_rotor / dx;
+    uint16_t* phase_rows = ctx->entity_mask[ctx->monster_rotor];
     
-    for (uint8_t my = y_start; my < DANDY_LEVEL_HEIGHT; my += dy) {
-        uint16_t row_offset = row_offsets[my];
-        for (uint8_t mx = x_start; mx < DANDY_LEVEL_WIDTH; mx += dx) {
+    // Only tick/animate what at least one active player can see: the union of
+    // their viewports, as a mask over each of this phase's rows
+    uint16_t visible_rows[ENTITY_ROWS];
+    memset(visible_rows, 0, sizeof(visible_rows));
+    for (uint8_t p = 0; p < MAX_PLAYERS; ++p) {
+        if (ctx->player_joined[p]) {
+            uint16_t cols = VIEWPORT_COLS(vp_lefts[p], x_start);
+            for (uint8_t r = 0; r < ENTITY_ROWS; ++r) {
+                uint8_t my = y_start + r * dy;
+                if (my >= vp_tops[p] && my < vp_tops[p] + 10) {
+                    visible_rows[r] |= cols;
+                }
+            }
+        }
+    }
+    
+    for (uint8_t r = 0; r < ENTITY_ROWS; ++r) {
+        uint8_t my = y_start + r * dy;
+        uint16_t row_offset = MAP_POS(0, my);
+        uint16_t bits = phase_rows[r] & visible_rows[r];
+        uint8_t mx = x_start;
+        for (; bits; bits >>= 1, mx += dx) {
+            if (!(bits & 1)) {
+                continue;
+            }
             uint16_t pos = row_offset + mx;
-            uint8_t tile = dandy_map[pos];
+            uint8_t tile = ctx->map[pos];
             
-            // If it is a monster or a generator, check screen-relative visibility!
-            if ((tile >= TILE_MONSTER1 && tile <= TILE_MONSTER3) ||
-                (tile >= TILE_GENERATOR1 && tile <= TILE_GENERATOR3)) {
-                
-                // Only tick/animate if visible to at least one active player's screen!
-                bool is_visible = false;
-                for (uint8_t p = 0; p < MAX_PLAYERS; ++p) {
-                    if (player_joined[p]) {
-                        if (mx >= vp_lefts[p] && mx < vp_lefts[p] + 20 &&
-                            my >= vp_tops[p] && my < vp_tops[p] + 10) {
-                            is_visible = true;
-                            break;
-                        }
-                    }
-                }
-                if (!is_visible) {
-                    continue; // Freeze this off-screen monster/generator!
-                }
+            // The tile was overwritten since it was added (e.g. by a joining player)
+            if (!IS_ENTITY(tile)) {
+                entity_remove(DANDY_ARG_ pos);
+                continue;
             }
             
             if (tile >= TILE_MONSTER1 && tile <= TILE_MONSTER3) {
                 // Target the nearest active player
-                uint8_t target_p = get_nearest_player(mx, my);
-                int8_t p_dy = to_delta(player_y[target_p], my);
-                int8_t p_dx = to_delta(player_x[target_p], mx);
+                uint8_t target_p = get_nearest_player(DANDY_ARG_ mx, my);
+                int8_t p_dy = to_delta(ctx->player_y[target_p], my);
+                int8_t p_dx = to_delta(ctx->player_x[target_p], mx);
                 int8_t m_dir = delta_to_dir[p_dy + 1][p_dx + 1];
                 
                 for (uint8_t d = 0; d < 3; ++d) {
                     int8_t dd = (m_dir + search_order[d]) & 7;
-                    uint16_t n_pos = row_offsets[my + dir_delta_y[dd]] + (mx + dir_delta_x[dd]);
-                    uint8_t n_tile = dandy_map[n_pos];
+                    uint16_t n_pos = (pos + dir_delta_pos[dd]) & MAP_MASK;
+                    uint8_t n_tile = ctx->map[n_pos];
                     
                     if (IS_PLAYER(n_tile)) {
                         // Extract player index from tile ID: (n_tile - TILE_PLAYER1) / 8
                         uint8_t hit_p = (n_tile - TILE_PLAYER1) >> 3;
-                        if (player_joined[hit_p]) {
-                            dandy_map[pos] = TILE_SPACE;
-                            player_health[hit_p] -= 10 * (tile - TILE_MONSTER1 + 1);
-                            if (player_health[hit_p] <= 0) {
-                                player_health[hit_p] = 0;
-                                dandy_map[n_pos] = TILE_SPACE; // Clear player's tile from the map immediately
-                                hal_play_sound(SOUND_DIE);
+                        if (ctx->player_joined[hit_p]) {
+                            ctx->map[pos] = TILE_SPACE;
+                            entity_remove(DANDY_ARG_ pos);
+                            ctx->player_health[hit_p] -= 10 * (tile - TILE_MONSTER1 + 1);
+                            if (ctx->player_health[hit_p] <= 0) {
+                                ctx->player_health[hit_p] = 0;
+                                ctx->map[n_pos] = TILE_SPACE; // Clear player's tile from the map immediately
+                                hal_play_sound(DANDY_ARG_ SOUND_DIE);
                             } else {
-                                hal_play_sound(SOUND_HIT);
+                                hal_play_sound(DANDY_ARG_ SOUND_HIT);
                             }
-                            is_dirty = true;
+                            ctx->is_dirty = true;
                         }
                         break;
                     } else if (n_tile == TILE_SPACE) {
-                        dandy_map[pos] = TILE_SPACE;
-                        dandy_map[n_pos] = tile;
-                        is_dirty = true;
+                        ctx->map[pos] = TILE_SPACE;
+                        ctx->map[n_pos] = tile;
+                        entity_remove(DANDY_ARG_ pos);
+                        entity_add(DANDY_ARG_ n_pos);
+                        ctx->is_dirty = true;
                         break;
                     } else if (n_tile >= TILE_ARROW && n_tile <= TILE_ARROW + 7) {
                         break;
                     }
                 }
             } else if (tile >= TILE_GENERATOR1 && tile <= TILE_GENERATOR3) {
-                static uint16_t rand_seed = 0xACE1;
-                uint8_t lsb = rand_seed & 1;
-                rand_seed >>= 1;
-                if (lsb) {
-                    rand_seed ^= 0xB400u;
-                }
-                
-                if ((rand_seed & 7) < 4) {
-                    uint8_t spawn_dir = (rand_seed & 3) * 2;
+                uint16_t r = rng_next(DANDY_ARG);
+                if ((r & 7) < 4) {
+                    uint8_t spawn_dir = (r & 3) * 2;
                     for (uint8_t dd = 0; dd < 8; dd += 2) {
                         uint8_t check_dir = (spawn_dir + dd) % 8;
-                        uint16_t g_pos = row_offsets[my + dir_delta_y[check_dir]] + (mx + dir_delta_x[check_dir]);
-                        if (dandy_map[g_pos] == TILE_SPACE) {
-                            dandy_map[g_pos] = TILE_MONSTER1 + (tile - TILE_GENERATOR1);
-                            is_dirty = true;
+                        uint16_t g_pos = (pos + dir_delta_pos[check_dir]) & MAP_MASK;
+                        if (ctx->map[g_pos] == TILE_SPACE) {
+                            ctx->map[g_pos] = TILE_MONSTER1 + (tile - TILE_GENERATOR1);
+                            entity_add(DANDY_ARG_ g_pos);
+                            ctx->is_dirty = true;
                             break;
                         }
                     }
@@ -710,40 +948,73 @@ static void move_monsters(void) {
     }
 }
 
-/* Highly optimized non-recursive 8-way flood fill using parallel 8-bit stacks */
-static void iterative_flood_fill(uint8_t start_x, uint8_t start_y, uint8_t oc, uint8_t nc) {
-    if (oc == nc || dandy_map[row_offsets[start_y] + start_x] != oc) return;
+/* Neighbour offsets for the flood fill, in its original dy-major scan order */
+static const int8_t flood_delta_pos[8] = { -65, -64, -63, -1, 1, 63, 64, 65 };
+
+/* Opens the whole group of doors containing pos. Shipped levels walk the
+   group's runs from the ROM table: no neighbour probing and no stack.
+   Anything else falls back to the flood fill. */
+static void open_door(DANDY_CTX_ uint16_t pos) {
+    const DandyDoorRun* group = ctx->door_runs;
+    if (group) {
+        while (group->len) {
+            const DandyDoorRun* run = group;
+            bool hit = false;
+            for (; run->len; ++run) {
+                if ((uint16_t)(pos - run->pos) < run->len) hit = true;
+            }
+            if (hit) {
+                for (run = group; run->len; ++run) {
+                    memset(&ctx->map[run->pos], TILE_SPACE, run->len);
+                }
+                return;
+            }
+            group = run + 1;
+        }
+    }
+    iterative_flood_fill(DANDY_ARG_ pos, TILE_DOOR, TILE_SPACE);
+}
+
+static void flood_drain(DANDY_CTX_ uint8_t oc, uint8_t nc) {
+    while (ctx->flood_stack_ptr > 0) {
+        // Pop
+        ctx->flood_stack_ptr--;
+        uint16_t pos = ctx->flood_stack_pos[ctx->flood_stack_ptr];
+        
+        // Scan 8 neighbors
+        for (uint8_t d = 0; d < 8; ++d) {
+            uint16_t n_pos = (pos + flood_delta_pos[d]) & MAP_MASK;
+            if (ctx->map[n_pos] == oc) {
+                ctx->map[n_pos] = nc; // Mark immediately to prevent double-queuing!
+                flood_push(DANDY_ARG_ n_pos);
+            }
+        }
+    }
+}
+
+/* Highly optimized non-recursive 8-way flood fill using a position stack.
+   The padding sentinels stand in for bounds checks, so oc must not be
+   TILE_WALL. */
+static void iterative_flood_fill(DANDY_CTX_ uint16_t start, uint8_t oc, uint8_t nc) {
+    if (oc == nc || oc == TILE_WALL || ctx->map[start] != oc) return;
     
-    flood_stack_ptr = 0;
+    ctx->flood_stack_ptr = 0;
+    ctx->flood_overflow = false;
     
     // Mark immediately and push
-    dandy_map[row_offsets[start_y] + start_x] = nc;
-    flood_push(start_x, start_y);
+    ctx->map[start] = nc;
+    flood_push(DANDY_ARG_ start);
+    flood_drain(DANDY_ARG_ oc, nc);
     
-    while (flood_stack_ptr > 0) {
-        // Pop
-        flood_stack_ptr--;
-        uint8_t x = flood_stack_x[flood_stack_ptr];
-        uint8_t y = flood_stack_y[flood_stack_ptr];
-        
-        // Scan 8 neighbors
-        for (int8_t dy = -1; dy <= 1; ++dy) {
-            int16_t ny = (int16_t)y + dy;
-            if (ny < 0 || ny >= DANDY_LEVEL_HEIGHT) continue;
-            
-            uint16_t row_offset = row_offsets[ny];
-            
-            for (int8_t dx = -1; dx <= 1; ++dx) {
-                if (dx == 0 && dy == 0) continue;
-                
-                int16_t nx = (int16_t)x + dx;
-                if (nx < 0 || nx >= DANDY_LEVEL_WIDTH) continue;
-                
-                uint16_t pos = row_offset + nx;
-                if (dandy_map[pos] == oc) {
-                    dandy_map[pos] = nc; // Mark immediately to prevent double-queuing!
-                    flood_push((uint8_t)nx, (uint8_t)ny);
-                }
+    // Resume from the cells the stack had no room for. Draining one can
+    // leave new pending cells behind the scan, hence the outer loop.
+    while (ctx->flood_overflow) {
+        ctx->flood_overflow = false;
+        for (uint16_t pos = 0; pos < MAP_POS(0, DANDY_LEVEL_HEIGHT); ++pos) {
+            if (ctx->map[pos] == TILE_FLOOD_PENDING) {
+                ctx->map[pos] = nc;
+                flood_push(DANDY_ARG_ pos);
+                flood_drain(DANDY_ARG_ oc, nc);
             }
         }
     }
@@ -763,28 +1034,241 @@ static int8_t to_delta(int16_t target, int16_t current) {
     return 0;
 }
 
-void dandy_join_player(uint8_t p_idx) {
+void dandy_join_player(DANDY_CTX_ uint8_t p_idx) {
     if (p_idx >= MAX_PLAYERS) return;
-    if (!player_joined[p_idx]) {
-        player_joined[p_idx] = true;
-        player_health[p_idx] = 100;
-        player_score[p_idx] = 0;
-        player_bombs[p_idx] = 0;
-        player_keys[p_idx] = 0;
-        player_dir[p_idx] = 0;
-        arrow_dir[p_idx] = -1;
+    if (!ctx->player_joined[p_idx]) {
+        ctx->player_joined[p_idx] = true;
+        ctx->player_health[p_idx] = 100;
+        ctx->player_score[p_idx] = 0;
+        ctx->player_bombs[p_idx] = 0;
+        ctx->player_keys[p_idx] = 0;
+        ctx->player_dir[p_idx] = 0;
+        ctx->arrow_dir[p_idx] = -1;
         
         // Use the pre-calculated starting coordinates set by set_player_start_position()!
-        uint8_t px = player_x[p_idx];
-        uint8_t py = player_y[p_idx];
+        uint8_t px = ctx->player_x[p_idx];
+        uint8_t py = ctx->player_y[p_idx];
         
         // Spawn player sprite on the map
-        dandy_map[row_offsets[py] + px] = GET_PLAYER_TILE(p_idx, player_dir[p_idx]);
-        is_dirty = true;
+        ctx->map[MAP_POS(px, py)] = GET_PLAYER_TILE(p_idx, ctx->player_dir[p_idx]);
+        ctx->is_dirty = true;
     }
 }
 
-bool dandy_is_player_joined(uint8_t p_idx) {
+bool dandy_is_player_joined(DANDY_CTX_ uint8_t p_idx) {
     if (p_idx >= MAX_PLAYERS) return false;
-    return player_joined[p_idx];
+    return ctx->player_joined[p_idx];
+}
+
+/* --- Snapshots --- */
+
+#define SNAPSHOT_FIELD(dst, src, field) memcpy((dst)->field, (src)->field, sizeof((dst)->field))
+#define SNAPSHOT_FIELDS(dst, src) do { \
+        SNAPSHOT_FIELD(dst, src, entity_mask); \
+        SNAPSHOT_FIELD(dst, src, player_health); \
+        SNAPSHOT_FIELD(dst, src, player_score); \
+        SNAPSHOT_FIELD(dst, src, player_joined); \
+        SNAPSHOT_FIELD(dst, src, player_x); \
+        SNAPSHOT_FIELD(dst, src, player_y); \
+        SNAPSHOT_FIELD(dst, src, player_bombs); \
+        SNAPSHOT_FIELD(dst, src, player_keys); \
+        SNAPSHOT_FIELD(dst, src, player_dir); \
+        SNAPSHOT_FIELD(dst, src, player_move_timer); \
+        SNAPSHOT_FIELD(dst, src, arrow_x); \
+        SNAPSHOT_FIELD(dst, src, arrow_y); \
+        SNAPSHOT_FIELD(dst, src, arrow_dir); \
+        SNAPSHOT_FIELD(dst, src, old_buttons); \
+        (dst)->rng_state = (src)->rng_state; \
+        (dst)->current_level = (src)->current_level; \
+        (dst)->monster_rotor = (src)->monster_rotor; \
+        (dst)->local_player_idx = (src)->local_player_idx; \
+    } while (0)
+
+// Everything but the map
+static void snapshot_fields(DANDY_CTX_ DandySnapshot* snap) {
+    SNAPSHOT_FIELDS(snap, ctx);
+    snap->door_level = DANDY_SNAPSHOT_NO_DOORS;
+    if (ctx->door_runs) {
+        for (uint8_t level = 0; level < DANDY_NUM_LEVELS; ++level) {
+            if (dandy_level_info[level].door_runs == ctx->door_runs) {
+                snap->door_level = level;
+                break;
+            }
+        }
+    }
 }
+
+// Everything but the map. The flood fill's stack is only used within a
+// fill, so it just starts empty.
+static void restore_fields(DANDY_CTX_ const DandySnapshot* snap) {
+    SNAPSHOT_FIELDS(ctx, snap);
+    ctx->door_runs = snap->door_level < DANDY_NUM_LEVELS ? dandy_level_info[snap->door_level].door_runs : NULL;
+    ctx->flood_stack_ptr = 0;
+    ctx->flood_overflow = false;
+    ctx->is_dirty = true;
+}
+
+void dandy_snapshot(DANDY_CTX_ DandySnapshot* snap) {
+    snapshot_fields(DANDY_ARG_ snap);
+    for (uint8_t y = 0; y < DANDY_LEVEL_HEIGHT; ++y) {
+        memcpy(snap->map[y], &ctx->map[MAP_POS(0, y)], DANDY_LEVEL_WIDTH);
+    }
+}
+
+void dandy_restore(DANDY_CTX_ const DandySnapshot* snap) {
+    memset(ctx->map, TILE_WALL, MAP_SIZE); // The padding
+    for (uint8_t y = 0; y < DANDY_LEVEL_HEIGHT; ++y) {
+        memcpy(&ctx->map[MAP_POS(0, y)], snap->map[y], DANDY_LEVEL_WIDTH);
+    }
+    restore_fields(DANDY_ARG_ snap);
+}
+
+#ifndef DANDY_SINGLE_CONTEXT
+
+#define DELTA_FIELDS_SIZE  ((uint16_t)offsetof(DandySnapshot, map))
+#define DELTA_CELLS        (DANDY_LEVEL_WIDTH * DANDY_LEVEL_HEIGHT)
+
+// The level as dandy_load_level decodes it, before players are placed
+static void decode_pristine_level(DandyContext* ctx, uint8_t level) {
+    memset(ctx->map, TILE_WALL, MAP_SIZE);
+    memset(ctx->entity_mask, 0, sizeof(ctx->entity_mask));
+    decode_level_b2(ctx, dandy_levels[level], dandy_level_sizes[level]);
+}
+
+/* A delta may come from anywhere, and the core indexes the map with these
+   fields unchecked, so restore only ones a game could have. fields is the
+   delta's copy, read bytewise so a bool that isn't 0 or 1 is never loaded
+   as one. */
+static bool delta_fields_valid(const uint8_t* fields) {
+    DandySnapshot snap;
+    for (uint8_t p = 0; p < MAX_PLAYERS; ++p) {
+        if (fields[offsetof(DandySnapshot, player_joined) + p] > 1) {
+            return false;
+        }
+    }
+    memcpy(&snap, fields, DELTA_FIELDS_SIZE);
+    if (snap.current_level >= DANDY_NUM_LEVELS || snap.monster_rotor >= 16 ||
+        snap.local_player_idx >= MAX_PLAYERS ||
+        (snap.door_level >= DANDY_NUM_LEVELS && snap.door_level != DANDY_SNAPSHOT_NO_DOORS)) {
+        return false;
+    }
+    for (uint8_t p = 0; p < MAX_PLAYERS; ++p) {
+        if (snap.player_x[p] >= DANDY_LEVEL_WIDTH || snap.player_y[p] >= DANDY_LEVEL_HEIGHT ||
+            snap.player_dir[p] < 0 || snap.player_dir[p] > 7 ||
+            snap.arrow_x[p] >= MAP_STRIDE || snap.arrow_y[p] >= MAP_SIZE / MAP_STRIDE ||
+            snap.arrow_dir[p] < -1 || snap.arrow_dir[p] > 7) {
+            return false;
+        }
+    }
+    // Bit 15 of a phase row would be columns 60-63, the padding
+    for (uint8_t phase = 0; phase < 16; ++phase) {
+        for (uint8_t row = 0; row < ENTITY_ROWS; ++row) {
+            if (snap.entity_mask[phase][row] & 0x8000) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+static uint16_t delta_cell_pos(uint16_t cell) {
+    return MAP_POS(cell % DANDY_LEVEL_WIDTH, cell / DANDY_LEVEL_WIDTH);
+}
+
+static uint8_t* put_delta_varint(uint8_t* out, uint16_t v) {
+    while (v >= 0x80) {
+        *out++ = (uint8_t)(v | 0x80);
+        v >>= 7;
+    }
+    *out++ = (uint8_t)v;
+    return out;
+}
+
+// Cell counts are under 2^14, so never more than 2 bytes
+static bool get_delta_varint(const uint8_t* delta, uint16_t size, uint16_t* pos, uint16_t* v) {
+    *v = 0;
+    for (uint8_t shift = 0; shift < 14; shift += 7) {
+        if (*pos >= size) {
+            return false;
+        }
+        uint8_t b = delta[(*pos)++];
+        *v |= (uint16_t)(b & 0x7F) << shift;
+        if (!(b & 0x80)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+uint16_t dandy_snapshot_delta(DandyContext* ctx, uint8_t* out) {
+    DandySnapshot fields;
+    snapshot_fields(ctx, &fields);
+    memcpy(out, &fields, DELTA_FIELDS_SIZE);
+    uint8_t* end = out + DELTA_FIELDS_SIZE;
+
+    DandyContext pristine;
+    decode_pristine_level(&pristine, ctx->current_level < DANDY_NUM_LEVELS ? ctx->current_level : DANDY_NUM_LEVELS - 1);
+    uint16_t cell = 0;
+    uint16_t skip_from = 0;
+    while (cell < DELTA_CELLS) {
+        if (ctx->map[delta_cell_pos(cell)] == pristine.map[delta_cell_pos(cell)]) {
+            cell++;
+            continue;
+        }
+        uint16_t run_from = cell;
+        while (cell < DELTA_CELLS && ctx->map[delta_cell_pos(cell)] != pristine.map[delta_cell_pos(cell)]) {
+            cell++;
+        }
+        end = put_delta_varint(end, run_from - skip_from);
+        end = put_delta_varint(end, cell - run_from);
+        for (uint16_t c = run_from; c < cell; ++c) {
+            *end++ = ctx->map[delta_cell_pos(c)];
+        }
+        skip_from = cell;
+    }
+    return (uint16_t)(end - out);
+}
+
+bool dandy_restore_delta(DandyContext* ctx, const uint8_t* delta, uint16_t size) {
+    if (size < DELTA_FIELDS_SIZE) {
+        return false;
+    }
+    if (!delta_fields_valid(delta)) {
+        return false;
+    }
+    DandySnapshot fields;
+    memcpy(&fields, delta, DELTA_FIELDS_SIZE);
+
+    // Check every run fits before touching ctx
+    uint16_t pos = DELTA_FIELDS_SIZE;
+    uint16_t cell = 0;
+    while (pos < size) {
+        uint16_t skip, run;
+        if (!get_delta_varint(delta, size, &pos, &skip) || !get_delta_varint(delta, size, &pos, &run) ||
+            run == 0 || skip > DELTA_CELLS - cell || run > DELTA_CELLS - cell - skip || run > size - pos) {
+            return false;
+        }
+        cell += skip + run;
+        pos += run;
+    }
+
+    decode_pristine_level(ctx, fields.current_level);
+    pos = DELTA_FIELDS_SIZE;
+    cell = 0;
+    while (pos < size) {
+        uint16_t skip, run;
+        get_delta_varint(delta, size, &pos, &skip);
+        get_delta_varint(delta, size, &pos, &run);
+        for (cell += skip; run > 0; --run) {
+            ctx->map[delta_cell_pos(cell++)] = delta[pos++];
+        }
+    }
+    restore_fields(ctx, &fields);
+    return true;
+}
+
+#endif /* DANDY_SINGLE_CONTEXT */
+
+#ifdef DANDY_SINGLE_CONTEXT
+#undef ctx
+#endif
@@ -3,11 +3,21 @@
 
 #include <stdint.h>
 #include <stdbool.h>
+#include "levels.h"
 
 /* Game Constants */
 #define TICKS_PER_MOVE  4
-#define MAP_SIZE        1800 // 60 * 30
+/* The 60x30 level is stored in a 64x32 buffer so a position is just
+   (y << 6) | x. Columns 60-63 and rows 30-31 are always TILE_WALL, so a
+   neighbour of any cell, wrapped with MAP_MASK, is either in the level or
+   in the padding. Off-map probes hit a wall without a bounds check. */
+#define MAP_WIDTH_SHIFT 6
+#define MAP_STRIDE      (1 << MAP_WIDTH_SHIFT) // 64
+#define MAP_SIZE        2048 // 64 * 32
+#define MAP_MASK        (MAP_SIZE - 1)
+#define MAP_POS(x, y)   ((uint16_t)(((uint16_t)(y) << MAP_WIDTH_SHIFT) | (x)))
 #define MAX_PLAYERS     4
+#define DANDY_RNG_SEED  0xACE1
 
 /* Tile ID Constants */
 #define TILE_SPACE       0
@@ -38,45 +48,154 @@
 #define BUTTON_FIRE   (1 << 4)
 #define BUTTON_BOMB   (1 << 5)
 
-/* Game State Globals (extern) */
-extern uint8_t dandy_map[MAP_SIZE];
-extern uint8_t current_level;
-extern uint8_t monster_rotor;
-extern bool player_joined[MAX_PLAYERS];
-extern uint8_t local_player_idx;
-extern const uint8_t dandy_num_levels;
+/* One game's state. Kept as parallel arrays, which index cheaply on the
+   Z80, rather than an array of player structs. */
+#define ENTITY_ROWS      8
+#define FLOOD_STACK_SIZE 64
+
+typedef struct {
+    uint8_t map[MAP_SIZE];
+    uint8_t current_level;
+    uint8_t monster_rotor;
+    // Generator spawn LFSR. dandy_init resets it to DANDY_RNG_SEED, so call
+    // dandy_seed after dandy_init. Save and restore it with the rest of the
+    // state to replay a run exactly.
+    uint16_t rng_state;
+    bool player_joined[MAX_PLAYERS];
+    uint8_t local_player_idx;
+
+    /* Player State Arrays */
+    uint8_t player_x[MAX_PLAYERS];
+    uint8_t player_y[MAX_PLAYERS];
+    int16_t player_health[MAX_PLAYERS];
+    uint16_t player_score[MAX_PLAYERS];
+    uint8_t player_bombs[MAX_PLAYERS];
+    uint8_t player_keys[MAX_PLAYERS];
+    int8_t player_dir[MAX_PLAYERS];
+    uint8_t player_move_timer[MAX_PLAYERS];
+
+    uint8_t arrow_x[MAX_PLAYERS];
+    uint8_t arrow_y[MAX_PLAYERS];
+    int8_t arrow_dir[MAX_PLAYERS]; // -1 if inactive
 
-/* Player State Arrays */
-extern uint8_t player_x[MAX_PLAYERS];
-extern uint8_t player_y[MAX_PLAYERS];
-extern int16_t player_health[MAX_PLAYERS];
-extern uint16_t player_score[MAX_PLAYERS];
-extern uint8_t player_bombs[MAX_PLAYERS];
-extern uint8_t player_keys[MAX_PLAYERS];
-extern int8_t player_dir[MAX_PLAYERS];
-extern uint8_t player_move_timer[MAX_PLAYERS];
+    bool is_dirty; // Set to true when screen needs redraw
 
-extern uint8_t arrow_x[MAX_PLAYERS];
-extern uint8_t arrow_y[MAX_PLAYERS];
-extern int8_t arrow_dir[MAX_PLAYERS]; // -1 if inactive
+    /* Engine bookkeeping, only touched by dandy_core.c */
+    uint8_t old_buttons[MAX_PLAYERS];
+    // Door groups of the current level from dandy_level_info, or NULL once
+    // map no longer matches the shipped level (see dandy_rebuild_entities)
+    const DandyDoorRun* door_runs;
+    uint16_t entity_mask[16][ENTITY_ROWS]; // Active monsters and generators
+    uint16_t flood_stack_pos[FLOOD_STACK_SIZE];
+    int8_t flood_stack_ptr;
+    bool flood_overflow;
+} DandyContext;
 
-extern bool is_dirty; // Set to true when screen needs redraw
+/* Host builds pass a DandyContext to every function below and to the HAL,
+   so one process can run any number of games, on any number of threads.
+   The GameBoy and Wasm builds run exactly one game: with
+   DANDY_SINGLE_CONTEXT the context is the global dandy_ctx and the
+   parameter is compiled out, so the core addresses its state directly, as
+   it did when the state was plain globals. Declare with DANDY_CTX (no
+   other parameters) or DANDY_CTX_ (more follow), and pass with DANDY_ARG
+   or DANDY_ARG_. */
+#if (defined(__SDCC) || defined(__EMSCRIPTEN__)) && !defined(DANDY_SINGLE_CONTEXT)
+#define DANDY_SINGLE_CONTEXT
+#endif
+
+#ifdef DANDY_SINGLE_CONTEXT
+extern DandyContext dandy_ctx;
+#define DANDY_CTX   void
+#define DANDY_CTX_
+#define DANDY_ARG
+#define DANDY_ARG_
+#else
+#define DANDY_CTX   DandyContext* ctx
+#define DANDY_CTX_  DandyContext* ctx,
+#define DANDY_ARG   ctx
+#define DANDY_ARG_  ctx,
+#endif
+
+extern const uint8_t dandy_num_levels;
+// sizeof(DandyContext), for FFI callers. GBDK's map file keeps 9 characters
+// of a symbol, and the emulator tests find _dandy_ctx by them, so no other
+// global may start with dandy_ct.
+extern const uint16_t dandy_sizeof_context;
 
 /* Core Functions */
-void dandy_init(void);
-void dandy_step(const uint8_t player_inputs[MAX_PLAYERS]);
-void dandy_load_level(uint8_t level_idx);
-void dandy_draw_viewport(uint8_t local_p_idx);
-void dandy_join_player(uint8_t p_idx);
-bool dandy_is_player_joined(uint8_t p_idx);
+void dandy_init(DANDY_CTX);
+void dandy_step(DANDY_CTX_ const uint8_t player_inputs[MAX_PLAYERS]);
+void dandy_load_level(DANDY_CTX_ uint8_t level_idx);
+// Rebuilds the active monster/generator set from the map, and stops using
+// the level's ROM door groups. Call after writing the map directly (the
+// core keeps both up to date otherwise).
+void dandy_rebuild_entities(DANDY_CTX);
+// Sets rng_state. 0 is not a valid LFSR state and gives DANDY_RNG_SEED.
+void dandy_seed(DANDY_CTX_ uint16_t seed);
+void dandy_draw_viewport(DANDY_CTX_ uint8_t local_p_idx);
+void dandy_join_player(DANDY_CTX_ uint8_t p_idx);
+bool dandy_is_player_joined(DANDY_CTX_ uint8_t p_idx);
+
+/* Snapshots: everything that decides how a game goes on, as one flat
+   block with no pointers (2122 bytes), to keep in memory, copy between
+   contexts or write out. Restoring one carries on exactly as the game
+   would have from where it was taken; the screen is redrawn from scratch.
+   Only the 60x30 level is kept, row by row: the padding is rebuilt, and
+   the door groups are kept as the level they belong to. */
+#define DANDY_SNAPSHOT_NO_DOORS 0xFF
+
+typedef struct {
+    uint16_t entity_mask[16][ENTITY_ROWS];
+    uint16_t rng_state;
+    int16_t player_health[MAX_PLAYERS];
+    uint16_t player_score[MAX_PLAYERS];
+    uint8_t current_level;
+    uint8_t monster_rotor;
+    uint8_t local_player_idx;
+    uint8_t door_level; // Level whose door_runs are in use, or DANDY_SNAPSHOT_NO_DOORS
+    bool player_joined[MAX_PLAYERS];
+    uint8_t player_x[MAX_PLAYERS];
+    uint8_t player_y[MAX_PLAYERS];
+    uint8_t player_bombs[MAX_PLAYERS];
+    uint8_t player_keys[MAX_PLAYERS];
+    int8_t player_dir[MAX_PLAYERS];
+    uint8_t player_move_timer[MAX_PLAYERS];
+    uint8_t arrow_x[MAX_PLAYERS];
+    uint8_t arrow_y[MAX_PLAYERS];
+    int8_t arrow_dir[MAX_PLAYERS];
+    uint8_t old_buttons[MAX_PLAYERS];
+    uint8_t map[DANDY_LEVEL_HEIGHT][DANDY_LEVEL_WIDTH]; // Last, so a delta can stop before it
+} DandySnapshot;
+
+extern const uint16_t dandy_snapshot_size; // sizeof(DandySnapshot), for FFI callers
+
+void dandy_snapshot(DANDY_CTX_ DandySnapshot* snap);
+void dandy_restore(DANDY_CTX_ const DandySnapshot* snap);
+
+#ifndef DANDY_SINGLE_CONTEXT
+/* The same snapshot with the map stored as the runs of cells that differ
+   from the level as shipped, typically a few hundred bytes in all:
+   the fields before map as they are, then for each run a varint (7 bits
+   a byte, low first) of unchanged cells to skip, a varint of changed
+   cells, and those cells, in row-major order. Taking one decodes the
+   level into a second context, so deltas are for host builds only. */
+#define DANDY_DELTA_MAX_SIZE (sizeof(DandySnapshot) + DANDY_LEVEL_WIDTH * DANDY_LEVEL_HEIGHT)
+
+// Writes at most DANDY_DELTA_MAX_SIZE bytes to out and returns how many
+uint16_t dandy_snapshot_delta(DandyContext* ctx, uint8_t* out);
+// Returns false, leaving ctx as it was, if delta is malformed or holds
+// state no game could be in, such as a player off the level
+bool dandy_restore_delta(DandyContext* ctx, const uint8_t* delta, uint16_t size);
+#endif
 
 /* Helper functions that core needs from HAL */
-// These must be implemented by the platform-specific HAL (e.g., gameboy_hal.c)
-extern void hal_draw_tile(uint8_t x, uint8_t y, uint8_t tile_id);
-extern void hal_update_hud(void);
-extern void hal_clear_sprites(uint8_t vp_left, uint8_t vp_top);
-extern void hal_set_sprite(uint8_t sprite_idx, uint8_t x, uint8_t y, uint8_t tile_id, uint8_t flags);
-extern void hal_play_sound(uint8_t sound_id);
+// These must be implemented by the platform-specific HAL (e.g., gameboy_hal.c),
+// and are called with the context of the game that is drawing or playing.
+extern void hal_draw_tile(DANDY_CTX_ uint8_t x, uint8_t y, uint8_t tile_id);
+extern void hal_update_hud(DANDY_CTX);
+extern void hal_clear_sprites(DANDY_CTX_ uint8_t vp_left, uint8_t vp_top);
+extern void hal_set_sprite(DANDY_CTX_ uint8_t sprite_idx, uint8_t x, uint8_t y, uint8_t tile_id, uint8_t flags);
+extern void hal_play_sound(DANDY_CTX_ uint8_t sound_id);
 
 /* Retro Sound Effect IDs */
 #define SOUND_SHOOT     0
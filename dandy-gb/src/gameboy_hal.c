@@ -56,7 +56,7 @@ static void s16_to_str(int16_t val, char* buf, uint8_t digits) {
 
 /* HAL Implementations */
 
-void hal_draw_tile(uint8_t x, uint8_t y, uint8_t tile_id) {
+void hal_draw_tile(DANDY_CTX_ uint8_t x, uint8_t y, uint8_t tile_id) {
     // Map player 2, 3, 4 tile IDs back to Player 1's range (24..31)
     if (tile_id >= TILE_PLAYER1 && tile_id <= TILE_PLAYER1 + 31) {
         tile_id = TILE_PLAYER1 + ((tile_id - TILE_PLAYER1) & 7);
@@ -66,9 +66,9 @@ void hal_draw_tile(uint8_t x, uint8_t y, uint8_t tile_id) {
     set_bkg_tile_xy(x, y, 128 + tile_id);
 }
 
-void hal_update_hud(void) {
+void hal_update_hud(DANDY_CTX) {
     char buf[10];
-    uint8_t p = local_player_idx;
+    uint8_t p = dandy_ctx.local_player_idx;
     
     // Fill the entire HUD scoreboard area (columns 0..19, rows 10..17)
     // creating a solid dark background block.
@@ -83,30 +83,30 @@ void hal_update_hud(void) {
     // Draw scoreboard elements using the inverted light-on-dark font
     // Row 11: Score
     hal_draw_string_inverted(1, 11, "SCORE: ");
-    u16_to_str(player_score[p], buf, 6);
+    u16_to_str(dandy_ctx.player_score[p], buf, 6);
     hal_draw_string_inverted(8, 11, buf);
     
     // Row 12: Health
     hal_draw_string_inverted(1, 12, "HP:    ");
-    s16_to_str(player_health[p], buf, 3);
+    s16_to_str(dandy_ctx.player_health[p], buf, 3);
     hal_draw_string_inverted(8, 12, buf);
     
     // Row 13: Bombs & Keys
     hal_draw_string_inverted(1, 13, "BOMBS: ");
-    u16_to_str(player_bombs[p], buf, 2);
+    u16_to_str(dandy_ctx.player_bombs[p], buf, 2);
     hal_draw_string_inverted(8, 13, buf);
     
     hal_draw_string_inverted(11, 13, "KEYS: ");
-    u16_to_str(player_keys[p], buf, 2);
+    u16_to_str(dandy_ctx.player_keys[p], buf, 2);
     hal_draw_string_inverted(17, 13, buf);
     
     // Row 14: Level
     hal_draw_string_inverted(1, 14, "LEVEL: ");
-    u16_to_str(current_level + 1, buf, 2);
+    u16_to_str(dandy_ctx.current_level + 1, buf, 2);
     hal_draw_string_inverted(8, 14, buf);
 }
 
-void hal_clear_sprites(uint8_t vp_left, uint8_t vp_top) {
+void hal_clear_sprites(DANDY_CTX_ uint8_t vp_left, uint8_t vp_top) {
     (void)vp_left;
     (void)vp_top;
     // Hide all 40 hardware sprites by moving them off-screen (0, 0)
@@ -115,7 +115,7 @@ void hal_clear_sprites(uint8_t vp_left, uint8_t vp_top) {
     }
 }
 
-void hal_set_sprite(uint8_t sprite_idx, uint8_t x, uint8_t y, uint8_t tile_id, uint8_t flags) {
+void hal_set_sprite(DANDY_CTX_ uint8_t sprite_idx, uint8_t x, uint8_t y, uint8_t tile_id, uint8_t flags) {
     if (sprite_idx >= 40) return;
     
     // Map player 2, 3, 4 tile IDs back to Player 1's range (24..31)
@@ -135,7 +135,7 @@ void hal_set_sprite(uint8_t sprite_idx, uint8_t x, uint8_t y, uint8_t tile_id, u
 
 static bool sound_initialized = false;
 
-void hal_play_sound(uint8_t sound_id) {
+void hal_play_sound(DANDY_CTX_ uint8_t sound_id) {
     if (!sound_initialized) {
         NR52_REG = 0x80; // Turn on Sound chip
         NR50_REG = 0x77; // Max volume on left/right channels
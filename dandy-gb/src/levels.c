@@ -28,6 +28,13 @@ const uint8_t dandy_level_0[] = {
     0xAA, 0xAB, 0xB0, 0xA2, 0xA0
 };
 
+/* Level 0 doors (groups: 2, runs: 5) */
+const DandyDoorRun dandy_level_0_doors[] = {
+    {0x2C3, 1}, {0x303, 1}, {0x343, 1}, {0x383, 1}, {0, 0},
+    {0x338, 3}, {0, 0},
+    {0, 0}
+};
+
 /* Level 1 (Raw: 1800B, B2: 323B) */
 const uint8_t dandy_level_1[] = {
     0x00, 0x00, 0x00, 0xAE, 0x4E, 0x40, 0x07, 0x25, 0xC8, 0x04, 0x00, 0x00, 0x00, 0x14, 0x55, 0x55,
@@ -53,6 +60,12 @@ const uint8_t dandy_level_1[] = {
     0x00, 0xC8, 0xA0
 };
 
+/* Level 1 doors (groups: 1, runs: 18) */
+const DandyDoorRun dandy_level_1_doors[] = {
+    {0x2F6, 1}, {0x336, 1}, {0x376, 1}, {0x3B6, 1}, {0x3F6, 1}, {0x436, 1}, {0x476, 1}, {0x4B6, 1}, {0x4F6, 1}, {0x536, 1}, {0x576, 1}, {0x5B6, 1}, {0x5F6, 1}, {0x636, 1}, {0x676, 1}, {0x6B6, 1}, {0x6F6, 1}, {0x736, 1}, {0, 0},
+    {0, 0}
+};
+
 /* Level 2 (Raw: 1800B, B2: 391B) */
 const uint8_t dandy_level_2[] = {
     0xDF, 0x78, 0x00, 0x02, 0xDD, 0xCF, 0x3C, 0xF3, 0xCF, 0x3C, 0xF3, 0xCF, 0x3C, 0xF3, 0xCF, 0x3C,
@@ -82,6 +95,19 @@ const uint8_t dandy_level_2[] = {
     0x7B, 0xBE, 0xFB, 0xEC, 0x00, 0x1B, 0x00
 };
 
+/* Level 2 doors (groups: 8, runs: 12) */
+const DandyDoorRun dandy_level_2_doors[] = {
+    {0x114, 1}, {0x154, 1}, {0, 0},
+    {0x128, 1}, {0x168, 1}, {0, 0},
+    {0x249, 3}, {0, 0},
+    {0x270, 5}, {0, 0},
+    {0x4C9, 3}, {0, 0},
+    {0x4DD, 3}, {0, 0},
+    {0x4F1, 3}, {0, 0},
+    {0x5E8, 1}, {0x628, 1}, {0x668, 1}, {0, 0},
+    {0, 0}
+};
+
 /* Level 3 (Raw: 1800B, B2: 383B) */
 const uint8_t dandy_level_3[] = {
     0x97, 0x72, 0xEE, 0x5D, 0xCB, 0xB9, 0x77, 0x2E, 0xE5, 0xDC, 0xBB, 0x97, 0x72, 0xEE, 0x5D, 0xCB,
@@ -110,6 +136,11 @@ const uint8_t dandy_level_3[] = {
     0x6E, 0x37, 0x1B, 0x8D, 0xC6, 0xE2, 0x10, 0x84, 0x21, 0x08, 0x42, 0x10, 0x84, 0x21, 0x00
 };
 
+/* Level 3 doors (groups: 0, runs: 0) */
+const DandyDoorRun dandy_level_3_doors[] = {
+    {0, 0}
+};
+
 /* Level 4 (Raw: 1800B, B2: 656B) */
 const uint8_t dandy_level_4[] = {
     0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA3, 0xAB,
@@ -155,6 +186,13 @@ const uint8_t dandy_level_4[] = {
     0x0E, 0x7C, 0xEC, 0xF0, 0xEB, 0xCE, 0x4F, 0x0E, 0xFC, 0xE8, 0xF0, 0xE6, 0xE4, 0x8E, 0xBC, 0xEC
 };
 
+/* Level 4 doors (groups: 2, runs: 4) */
+const DandyDoorRun dandy_level_4_doors[] = {
+    {0x184, 1}, {0x1C4, 1}, {0x204, 1}, {0, 0},
+    {0x379, 2}, {0, 0},
+    {0, 0}
+};
+
 /* Level 5 (Raw: 1800B, B2: 610B) */
 const uint8_t dandy_level_5[] = {
     0x1A, 0x8B, 0x7D, 0xF7, 0xEF, 0xBD, 0xF7, 0xDE, 0x00, 0x39, 0xE7, 0x91, 0x75, 0xD7, 0x5D, 0x74,
@@ -198,6 +236,18 @@ const uint8_t dandy_level_5[] = {
     0xC1, 0xA0
 };
 
+/* Level 5 doors (groups: 7, runs: 21) */
+const DandyDoorRun dandy_level_5_doors[] = {
+    {0x1C9, 8}, {0, 0},
+    {0x297, 1}, {0, 0},
+    {0x34E, 1}, {0x38E, 1}, {0x3CE, 1}, {0x40E, 1}, {0x44E, 1}, {0x48E, 1}, {0x4CE, 1}, {0, 0},
+    {0x350, 1}, {0x390, 1}, {0x3D0, 1}, {0x410, 1}, {0x450, 1}, {0x490, 1}, {0x4D0, 1}, {0, 0},
+    {0x560, 1}, {0x5A0, 1}, {0x5E0, 1}, {0, 0},
+    {0x601, 5}, {0, 0},
+    {0x63A, 1}, {0, 0},
+    {0, 0}
+};
+
 /* Level 6 (Raw: 1800B, B2: 409B) */
 const uint8_t dandy_level_6[] = {
     0x01, 0xCC, 0x00, 0x40, 0x0A, 0x00, 0x40, 0x10, 0x00, 0x0E, 0x60, 0x02, 0x00, 0x50, 0x02, 0x00,
@@ -228,6 +278,46 @@ const uint8_t dandy_level_6[] = {
     0xC0, 0x3F, 0xBE, 0x01, 0xF5, 0x00, 0x20, 0x08, 0x00
 };
 
+/* Level 6 doors (groups: 35, runs: 51) */
+const DandyDoorRun dandy_level_6_doors[] = {
+    {0x0C9, 1}, {0, 0},
+    {0x0D4, 1}, {0, 0},
+    {0x0DE, 2}, {0, 0},
+    {0x0E9, 1}, {0, 0},
+    {0x0F2, 1}, {0, 0},
+    {0x184, 1}, {0x1C4, 1}, {0, 0},
+    {0x18F, 1}, {0x1CF, 1}, {0, 0},
+    {0x199, 1}, {0x1D9, 1}, {0, 0},
+    {0x1A4, 1}, {0x1E4, 1}, {0, 0},
+    {0x1AE, 1}, {0x1EE, 1}, {0, 0},
+    {0x1B6, 1}, {0x1F6, 1}, {0, 0},
+    {0x289, 1}, {0, 0},
+    {0x294, 1}, {0, 0},
+    {0x29E, 2}, {0, 0},
+    {0x2A9, 1}, {0, 0},
+    {0x2B2, 1}, {0, 0},
+    {0x345, 1}, {0x385, 1}, {0, 0},
+    {0x34F, 1}, {0x38F, 1}, {0, 0},
+    {0x359, 1}, {0x399, 1}, {0, 0},
+    {0x36D, 1}, {0x3AD, 1}, {0, 0},
+    {0x377, 1}, {0x3B7, 1}, {0, 0},
+    {0x449, 1}, {0, 0},
+    {0x494, 1}, {0, 0},
+    {0x4A9, 1}, {0, 0},
+    {0x4B2, 1}, {0, 0},
+    {0x544, 1}, {0x584, 1}, {0, 0},
+    {0x54E, 1}, {0x58E, 1}, {0, 0},
+    {0x559, 1}, {0x599, 1}, {0, 0},
+    {0x56E, 1}, {0x5AE, 1}, {0, 0},
+    {0x576, 1}, {0x5B6, 1}, {0, 0},
+    {0x649, 1}, {0, 0},
+    {0x65E, 2}, {0, 0},
+    {0x669, 1}, {0, 0},
+    {0x672, 1}, {0, 0},
+    {0x694, 1}, {0, 0},
+    {0, 0}
+};
+
 /* Level 7 (Raw: 1800B, B2: 390B) */
 const uint8_t dandy_level_7[] = {
     0xE1, 0xC3, 0x87, 0x0E, 0x1C, 0x6B, 0xC4, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x46, 0xFB,
@@ -257,6 +347,15 @@ const uint8_t dandy_level_7[] = {
     0xBA, 0xEB, 0x20, 0x00, 0x00, 0x70
 };
 
+/* Level 7 doors (groups: 4, runs: 5) */
+const DandyDoorRun dandy_level_7_doors[] = {
+    {0x227, 2}, {0, 0},
+    {0x327, 2}, {0, 0},
+    {0x6E4, 1}, {0x724, 1}, {0, 0},
+    {0x70F, 2}, {0, 0},
+    {0, 0}
+};
+
 /* Level 8 (Raw: 1800B, B2: 492B) */
 const uint8_t dandy_level_8[] = {
     0xE3, 0xCE, 0x20, 0x01, 0xCF, 0x31, 0x95, 0x55, 0x73, 0xCF, 0x3C, 0xF3, 0xCF, 0x35, 0x55, 0x55,
@@ -292,6 +391,13 @@ const uint8_t dandy_level_8[] = {
     0x5B, 0xF5, 0xBF, 0x3B, 0xF3, 0xBF, 0x3B, 0xF3, 0x91, 0x55, 0x54, 0xD0
 };
 
+/* Level 8 doors (groups: 2, runs: 27) */
+const DandyDoorRun dandy_level_8_doors[] = {
+    {0x055, 1}, {0x095, 1}, {0x0D5, 1}, {0x115, 1}, {0x155, 1}, {0x195, 1}, {0x1D5, 1}, {0x215, 1}, {0x255, 1}, {0x295, 1}, {0x2D5, 1}, {0x315, 1}, {0x355, 1}, {0x395, 1}, {0x3D5, 1}, {0x415, 1}, {0x455, 1}, {0x495, 1}, {0x4D5, 1}, {0x515, 1}, {0x555, 1}, {0, 0},
+    {0x5ED, 1}, {0x62D, 1}, {0x66D, 1}, {0x6AD, 1}, {0x6ED, 1}, {0x72D, 1}, {0, 0},
+    {0, 0}
+};
+
 /* Level 9 (Raw: 1800B, B2: 358B) */
 const uint8_t dandy_level_9[] = {
     0xB9, 0x92, 0x5E, 0x5E, 0x49, 0x79, 0x79, 0x73, 0x4A, 0xE6, 0xE6, 0x95, 0xCD, 0xC5, 0xCC, 0x97,
@@ -319,6 +425,14 @@ const uint8_t dandy_level_9[] = {
     0x5E, 0x55, 0x55, 0xAD, 0x55, 0x48
 };
 
+/* Level 9 doors (groups: 3, runs: 3) */
+const DandyDoorRun dandy_level_9_doors[] = {
+    {0x215, 1}, {0, 0},
+    {0x415, 1}, {0, 0},
+    {0x615, 1}, {0, 0},
+    {0, 0}
+};
+
 /* Level 10 (Raw: 1800B, B2: 292B) */
 const uint8_t dandy_level_10[] = {
     0x00, 0x00, 0x47, 0x3C, 0x80, 0x00, 0x00, 0x00, 0x0F, 0x0A, 0x80, 0x54, 0x47, 0x2E, 0x79, 0xE6,
@@ -342,6 +456,12 @@ const uint8_t dandy_level_10[] = {
     0x00, 0x00, 0x00, 0x00
 };
 
+/* Level 10 doors (groups: 1, runs: 1) */
+const DandyDoorRun dandy_level_10_doors[] = {
+    {0x6F5, 2}, {0, 0},
+    {0, 0}
+};
+
 /* Level 11 (Raw: 1800B, B2: 354B) */
 const uint8_t dandy_level_11[] = {
     0xE3, 0x6D, 0xF7, 0xEF, 0xAE, 0x40, 0x00, 0x01, 0x00, 0x00, 0x01, 0xCF, 0x5D, 0xEF, 0xBE, 0xDC,
@@ -369,6 +489,11 @@ const uint8_t dandy_level_11[] = {
     0xFB, 0x70
 };
 
+/* Level 11 doors (groups: 0, runs: 0) */
+const DandyDoorRun dandy_level_11_doors[] = {
+    {0, 0}
+};
+
 /* Level 12 (Raw: 1800B, B2: 383B) */
 const uint8_t dandy_level_12[] = {
     0xE4, 0x73, 0x55, 0x02, 0xAA, 0x3A, 0x2A, 0xA6, 0xED, 0xD5, 0x53, 0x76, 0xEA, 0xAB, 0x7D, 0xF7,
@@ -397,6 +522,47 @@ const uint8_t dandy_level_12[] = {
     0x72, 0x36, 0x9E, 0xB2, 0x0D, 0x67, 0xAC, 0x8E, 0x89, 0xEB, 0x2E, 0x8D, 0x93, 0xD6, 0x40
 };
 
+/* Level 12 doors (groups: 36, runs: 36) */
+const DandyDoorRun dandy_level_12_doors[] = {
+    {0x0C6, 1}, {0, 0},
+    {0x0D0, 1}, {0, 0},
+    {0x0DA, 1}, {0, 0},
+    {0x0E4, 1}, {0, 0},
+    {0x0EE, 1}, {0, 0},
+    {0x0F8, 1}, {0, 0},
+    {0x205, 1}, {0, 0},
+    {0x20F, 1}, {0, 0},
+    {0x219, 1}, {0, 0},
+    {0x223, 1}, {0, 0},
+    {0x22D, 1}, {0, 0},
+    {0x237, 1}, {0, 0},
+    {0x346, 1}, {0, 0},
+    {0x350, 1}, {0, 0},
+    {0x35A, 1}, {0, 0},
+    {0x364, 1}, {0, 0},
+    {0x36E, 1}, {0, 0},
+    {0x378, 1}, {0, 0},
+    {0x485, 1}, {0, 0},
+    {0x48F, 1}, {0, 0},
+    {0x499, 1}, {0, 0},
+    {0x4A3, 1}, {0, 0},
+    {0x4AD, 1}, {0, 0},
+    {0x4B7, 1}, {0, 0},
+    {0x5C6, 1}, {0, 0},
+    {0x5D0, 1}, {0, 0},
+    {0x5DA, 1}, {0, 0},
+    {0x5E4, 1}, {0, 0},
+    {0x5EE, 1}, {0, 0},
+    {0x5F8, 1}, {0, 0},
+    {0x705, 1}, {0, 0},
+    {0x70F, 1}, {0, 0},
+    {0x719, 1}, {0, 0},
+    {0x723, 1}, {0, 0},
+    {0x72D, 1}, {0, 0},
+    {0x737, 1}, {0, 0},
+    {0, 0}
+};
+
 /* Level 13 (Raw: 1800B, B2: 449B) */
 const uint8_t dandy_level_13[] = {
     0x2A, 0x9A, 0xDE, 0xAA, 0xBD, 0x5F, 0x1F, 0x5F, 0x1F, 0x51, 0x40, 0x54, 0xA7, 0xA7, 0xA8, 0x06,
@@ -430,6 +596,13 @@ const uint8_t dandy_level_13[] = {
     0x00
 };
 
+/* Level 13 doors (groups: 2, runs: 2) */
+const DandyDoorRun dandy_level_13_doors[] = {
+    {0x241, 58}, {0, 0},
+    {0x4C1, 58}, {0, 0},
+    {0, 0}
+};
+
 /* Level 14 (Raw: 1800B, B2: 389B) */
 const uint8_t dandy_level_14[] = {
     0xA1, 0xDD, 0x55, 0x05, 0x55, 0x05, 0x55, 0x05, 0x55, 0x05, 0x55, 0x78, 0x79, 0x56, 0x40, 0xAA,
@@ -459,6 +632,13 @@ const uint8_t dandy_level_14[] = {
     0x75, 0xE6, 0xB6, 0xDA, 0xA0
 };
 
+/* Level 14 doors (groups: 2, runs: 6) */
+const DandyDoorRun dandy_level_14_doors[] = {
+    {0x082, 1}, {0x0C2, 1}, {0x102, 1}, {0, 0},
+    {0x5E9, 1}, {0x626, 4}, {0x669, 1}, {0, 0},
+    {0, 0}
+};
+
 /* Level 15 (Raw: 1800B, B2: 370B) */
 const uint8_t dandy_level_15[] = {
     0xDF, 0x7D, 0xF7, 0xDF, 0x7D, 0xF7, 0xDF, 0x7D, 0xF7, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B,
@@ -487,6 +667,11 @@ const uint8_t dandy_level_15[] = {
     0x00, 0x34
 };
 
+/* Level 15 doors (groups: 0, runs: 0) */
+const DandyDoorRun dandy_level_15_doors[] = {
+    {0, 0}
+};
+
 /* Level 16 (Raw: 1800B, B2: 304B) */
 const uint8_t dandy_level_16[] = {
     0xD8, 0x5D, 0x90, 0x21, 0x06, 0xF0, 0x8E, 0x48, 0x4D, 0xC4, 0x23, 0x72, 0x36, 0xE4, 0x0D, 0xD3,
@@ -510,6 +695,11 @@ const uint8_t dandy_level_16[] = {
     0xB6, 0xDC, 0x9D, 0x21, 0xBA, 0xE8, 0x87, 0x68, 0x40, 0x85, 0xDF, 0x62, 0x10, 0x2D, 0xF7, 0xDC
 };
 
+/* Level 16 doors (groups: 0, runs: 0) */
+const DandyDoorRun dandy_level_16_doors[] = {
+    {0, 0}
+};
+
 /* Level 17 (Raw: 1800B, B2: 452B) */
 const uint8_t dandy_level_17[] = {
     0x07, 0x3C, 0xF3, 0xCF, 0x20, 0x83, 0x6D, 0xB5, 0xAD, 0x76, 0xD8, 0x65, 0x90, 0xE4, 0x01, 0xC9,
@@ -543,6 +733,13 @@ const uint8_t dandy_level_17[] = {
     0xC8, 0x00, 0x00, 0x00
 };
 
+/* Level 17 doors (groups: 2, runs: 29) */
+const DandyDoorRun dandy_level_17_doors[] = {
+    {0x060, 2}, {0x0A0, 2}, {0x0E0, 2}, {0x120, 2}, {0x160, 2}, {0x1A0, 2}, {0x1E0, 2}, {0x220, 2}, {0x260, 2}, {0x2A0, 2}, {0x2E0, 2}, {0x320, 2}, {0x360, 2}, {0x3A0, 2}, {0x3E0, 2}, {0x420, 2}, {0x460, 2}, {0x4A0, 2}, {0x4E0, 2}, {0x520, 2}, {0x560, 2}, {0x5A0, 2}, {0x5E0, 2}, {0x620, 2}, {0x660, 2}, {0x6A0, 2}, {0x6E0, 2}, {0x720, 2}, {0, 0},
+    {0x3C1, 4}, {0, 0},
+    {0, 0}
+};
+
 /* Level 18 (Raw: 1800B, B2: 288B) */
 const uint8_t dandy_level_18[] = {
     0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x6D, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B,
@@ -565,6 +762,11 @@ const uint8_t dandy_level_18[] = {
     0xA4, 0x00, 0xCC, 0x37, 0xDF, 0x7D, 0xF7, 0x2A, 0xAA, 0xA0, 0x14, 0x94, 0x12, 0x04, 0x80, 0x00
 };
 
+/* Level 18 doors (groups: 0, runs: 0) */
+const DandyDoorRun dandy_level_18_doors[] = {
+    {0, 0}
+};
+
 /* Level 19 (Raw: 1800B, B2: 304B) */
 const uint8_t dandy_level_19[] = {
     0xAD, 0xAA, 0xAB, 0x6D, 0xAA, 0xF2, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -588,6 +790,11 @@ const uint8_t dandy_level_19[] = {
     0xAE, 0xBA, 0xA6, 0x8A, 0xAA, 0xA0, 0xAE, 0x79, 0xE7, 0x90, 0x00, 0x00, 0x39, 0xA0, 0x00, 0x00
 };
 
+/* Level 19 doors (groups: 0, runs: 0) */
+const DandyDoorRun dandy_level_19_doors[] = {
+    {0, 0}
+};
+
 /* Level 20 (Raw: 1800B, B2: 425B) */
 const uint8_t dandy_level_20[] = {
     0xD5, 0xBE, 0xFB, 0xEF, 0xBB, 0x7D, 0xF7, 0xDF, 0x76, 0xFB, 0xEF, 0xBE, 0xED, 0xE1, 0x55, 0x55,
@@ -619,6 +826,17 @@ const uint8_t dandy_level_20[] = {
     0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 
+/* Level 20 doors (groups: 6, runs: 13) */
+const DandyDoorRun dandy_level_20_doors[] = {
+    {0x16D, 1}, {0x1AD, 1}, {0, 0},
+    {0x26D, 1}, {0x2AD, 1}, {0x2ED, 1}, {0, 0},
+    {0x36D, 1}, {0x3AD, 1}, {0, 0},
+    {0x46D, 1}, {0x4AD, 1}, {0, 0},
+    {0x56D, 1}, {0x5AD, 1}, {0, 0},
+    {0x66D, 1}, {0x6AD, 1}, {0, 0},
+    {0, 0}
+};
+
 /* Level 21 (Raw: 1800B, B2: 398B) */
 const uint8_t dandy_level_21[] = {
     0xD1, 0x24, 0x92, 0x4B, 0xA9, 0x75, 0x2E, 0xA5, 0xD4, 0xBA, 0x97, 0x52, 0xEA, 0x5D, 0x4B, 0xCB,
@@ -648,6 +866,11 @@ const uint8_t dandy_level_21[] = {
     0xBA, 0x97, 0x52, 0xEA, 0x5D, 0x4B, 0xA9, 0x2E, 0xEE, 0xEE, 0xEE, 0xEE, 0x2D, 0xE0
 };
 
+/* Level 21 doors (groups: 0, runs: 0) */
+const DandyDoorRun dandy_level_21_doors[] = {
+    {0, 0}
+};
+
 /* Level 22 (Raw: 1800B, B2: 338B) */
 const uint8_t dandy_level_22[] = {
     0xD8, 0x00, 0x00, 0x00, 0x03, 0x71, 0x00, 0x00, 0x0D, 0x80, 0x77, 0xD8, 0x01, 0xD8, 0x3B, 0xEC,
@@ -674,6 +897,11 @@ const uint8_t dandy_level_22[] = {
     0x00, 0x36
 };
 
+/* Level 22 doors (groups: 0, runs: 0) */
+const DandyDoorRun dandy_level_22_doors[] = {
+    {0, 0}
+};
+
 /* Level 23 (Raw: 1800B, B2: 316B) */
 const uint8_t dandy_level_23[] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x48, 0x72, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x74,
@@ -698,6 +926,11 @@ const uint8_t dandy_level_23[] = {
     0x45, 0x22, 0x85, 0x55, 0x44, 0x22, 0x00, 0x00, 0x00, 0x20, 0xA0, 0x80
 };
 
+/* Level 23 doors (groups: 0, runs: 0) */
+const DandyDoorRun dandy_level_23_doors[] = {
+    {0, 0}
+};
+
 /* Level 24 (Raw: 1800B, B2: 403B) */
 const uint8_t dandy_level_24[] = {
     0x00, 0x00, 0x00, 0x00, 0x01, 0xE7, 0xFE, 0x00, 0x00, 0x33, 0x15, 0x55, 0x28, 0x00, 0x15, 0x50,
@@ -728,6 +961,11 @@ const uint8_t dandy_level_24[] = {
     0x75, 0xD0, 0x00
 };
 
+/* Level 24 doors (groups: 0, runs: 0) */
+const DandyDoorRun dandy_level_24_doors[] = {
+    {0, 0}
+};
+
 /* Level 25 (Raw: 1800B, B2: 1216B) */
 const uint8_t dandy_level_25[] = {
     0xDD, 0xE7, 0x9B, 0xEF, 0xE7, 0x9B, 0xF9, 0xE7, 0x9E, 0x6F, 0xBE, 0xFE, 0x79, 0xBE, 0xFE, 0x79,
@@ -808,6 +1046,12 @@ const uint8_t dandy_level_25[] = {
     0x7D, 0xF7, 0xDF, 0x7D, 0xF7, 0xDF, 0x7D, 0xF7, 0xDF, 0x7D, 0xF7, 0xDF, 0x7D, 0xF7, 0xDF, 0x70
 };
 
+/* Level 25 doors (groups: 1, runs: 87) */
+const DandyDoorRun dandy_level_25_doors[] = {
+    {0x282, 1}, {0x284, 1}, {0x286, 1}, {0x288, 1}, {0x28A, 1}, {0x28C, 1}, {0x28E, 1}, {0x290, 1}, {0x292, 1}, {0x294, 1}, {0x296, 1}, {0x298, 1}, {0x29A, 1}, {0x29C, 1}, {0x29E, 1}, {0x2A0, 1}, {0x2A2, 1}, {0x2A4, 1}, {0x2A6, 1}, {0x2A8, 1}, {0x2AA, 1}, {0x2AC, 1}, {0x2AE, 1}, {0x2B0, 1}, {0x2B2, 1}, {0x2B4, 1}, {0x2B6, 1}, {0x2B8, 1}, {0x2BA, 1}, {0x2C1, 1}, {0x2C3, 1}, {0x2C5, 1}, {0x2C7, 1}, {0x2C9, 1}, {0x2CB, 1}, {0x2CD, 1}, {0x2CF, 1}, {0x2D1, 1}, {0x2D3, 1}, {0x2D5, 1}, {0x2D7, 1}, {0x2D9, 1}, {0x2DB, 1}, {0x2DD, 1}, {0x2DF, 1}, {0x2E1, 1}, {0x2E3, 1}, {0x2E5, 1}, {0x2E7, 1}, {0x2E9, 1}, {0x2EB, 1}, {0x2ED, 1}, {0x2EF, 1}, {0x2F1, 1}, {0x2F3, 1}, {0x2F5, 1}, {0x2F7, 1}, {0x2F9, 1}, {0x302, 1}, {0x304, 1}, {0x306, 1}, {0x308, 1}, {0x30A, 1}, {0x30C, 1}, {0x30E, 1}, {0x310, 1}, {0x312, 1}, {0x314, 1}, {0x316, 1}, {0x318, 1}, {0x31A, 1}, {0x31C, 1}, {0x31E, 1}, {0x320, 1}, {0x322, 1}, {0x324, 1}, {0x326, 1}, {0x328, 1}, {0x32A, 1}, {0x32C, 1}, {0x32E, 1}, {0x330, 1}, {0x332, 1}, {0x334, 1}, {0x336, 1}, {0x338, 1}, {0x33A, 1}, {0, 0},
+    {0, 0}
+};
+
 /* Pointer array to all compressed levels in ROM */
 const uint8_t* const dandy_levels[DANDY_NUM_LEVELS] = {
     dandy_level_0,
@@ -867,3 +1111,33 @@ const uint16_t dandy_level_sizes[DANDY_NUM_LEVELS] = {
     sizeof(dandy_level_24),
     sizeof(dandy_level_25)
 };
+
+/* Metadata of each level: stream, start, monsters, generators, keys, doors, door runs */
+const DandyLevelInfo dandy_level_info[DANDY_NUM_LEVELS] = {
+    { dandy_level_0, 0x461, 79, 1, 2, 7, dandy_level_0_doors },
+    { dandy_level_1, 0x0B9, 49, 0, 1, 18, dandy_level_1_doors },
+    { dandy_level_2, 0x39E, 156, 5, 8, 24, dandy_level_2_doors },
+    { dandy_level_3, 0x6C2, 97, 0, 0, 0, dandy_level_3_doors },
+    { dandy_level_4, 0x51E, 309, 0, 1, 5, dandy_level_4_doors },
+    { dandy_level_5, 0x5A2, 293, 8, 6, 32, dandy_level_5_doors },
+    { dandy_level_6, 0x299, 76, 12, 28, 54, dandy_level_6_doors },
+    { dandy_level_7, 0x11A, 34, 87, 4, 8, dandy_level_7_doors },
+    { dandy_level_8, 0x39F, 144, 11, 1, 27, dandy_level_8_doors },
+    { dandy_level_9, 0x0B9, 33, 9, 1, 3, dandy_level_9_doors },
+    { dandy_level_10, 0x189, 27, 6, 1, 2, dandy_level_10_doors },
+    { dandy_level_11, 0x3D4, 132, 0, 0, 0, dandy_level_11_doors },
+    { dandy_level_12, 0x6F9, 48, 44, 2, 36, dandy_level_12_doors },
+    { dandy_level_13, 0x082, 44, 12, 2, 116, dandy_level_13_doors },
+    { dandy_level_14, 0x639, 74, 4, 2, 9, dandy_level_14_doors },
+    { dandy_level_15, 0x108, 40, 1, 0, 0, dandy_level_15_doors },
+    { dandy_level_16, 0x4CF, 55, 0, 0, 0, dandy_level_16_doors },
+    { dandy_level_17, 0x50A, 119, 14, 3, 60, dandy_level_17_doors },
+    { dandy_level_18, 0x6F9, 32, 0, 0, 0, dandy_level_18_doors },
+    { dandy_level_19, 0x25C, 33, 9, 0, 0, dandy_level_19_doors },
+    { dandy_level_20, 0x098, 37, 20, 2, 13, dandy_level_20_doors },
+    { dandy_level_21, 0x3DD, 148, 6, 0, 0, dandy_level_21_doors },
+    { dandy_level_22, 0x393, 71, 5, 0, 0, dandy_level_22_doors },
+    { dandy_level_23, 0x0CD, 78, 2, 0, 0, dandy_level_23_doors },
+    { dandy_level_24, 0x082, 79, 70, 0, 0, dandy_level_24_doors },
+    { dandy_level_25, 0x082, 74, 48, 87, 87, dandy_level_25_doors }
+};
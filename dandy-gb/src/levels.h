@@ -12,4 +12,26 @@
 extern const uint8_t* const dandy_levels[DANDY_NUM_LEVELS];
 extern const uint16_t dandy_level_sizes[DANDY_NUM_LEVELS];
 
+/* A row of len door tiles starting at dandy_map[pos], pos = (y << 6) | x */
+typedef struct {
+    uint16_t pos;
+    uint8_t len;
+} DandyDoorRun;
+
+/* What the engine would otherwise have to scan each level for. door_runs
+   lists the groups of 8-way connected doors run by run: a run with len 0
+   ends a group, and an empty group ends the list. level is the stream the
+   rest was worked out from. */
+typedef struct {
+    const uint8_t* level;
+    uint16_t start_pos;  /* First TILE_UP, (y << 6) | x */
+    uint16_t monsters;
+    uint16_t generators;
+    uint16_t keys;
+    uint16_t doors;
+    const DandyDoorRun* door_runs;
+} DandyLevelInfo;
+
+extern const DandyLevelInfo dandy_level_info[DANDY_NUM_LEVELS];
+
 #endif /* DANDY_LEVELS_H */
\ No newline at end of file
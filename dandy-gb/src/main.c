@@ -93,9 +93,9 @@ void main(void) {
         dandy_step(inputs);
         
         // Redraw viewport if anything changed
-        if (is_dirty) {
-            dandy_draw_viewport(local_player_idx);
-            is_dirty = false;
+        if (dandy_ctx.is_dirty) {
+            dandy_draw_viewport(dandy_ctx.local_player_idx);
+            dandy_ctx.is_dirty = false;
         }
         
         // Synchronize with VBlank (frame rate limiter to 60fps)
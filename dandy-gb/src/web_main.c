@@ -37,27 +37,27 @@ EM_JS(void, js_play_sound, (uint8_t sound_id), {
 static uint8_t rendering_player_idx = 0;
 
 // Implement HAL functions required by dandy_core.h
-void hal_draw_tile(uint8_t x, uint8_t y, uint8_t tile_id) {
+void hal_draw_tile(DANDY_CTX_ uint8_t x, uint8_t y, uint8_t tile_id) {
     js_draw_tile(rendering_player_idx, x, y, tile_id);
 }
 
-void hal_update_hud(void) {
+void hal_update_hud(DANDY_CTX) {
     for (uint8_t p = 0; p < MAX_PLAYERS; ++p) {
-        if (player_joined[p]) {
-            js_update_hud(p, player_score[p], player_health[p], player_bombs[p], player_keys[p]);
+        if (dandy_ctx.player_joined[p]) {
+            js_update_hud(p, dandy_ctx.player_score[p], dandy_ctx.player_health[p], dandy_ctx.player_bombs[p], dandy_ctx.player_keys[p]);
         }
     }
 }
 
-void hal_clear_sprites(uint8_t vp_left, uint8_t vp_top) {
+void hal_clear_sprites(DANDY_CTX_ uint8_t vp_left, uint8_t vp_top) {
     js_clear_sprites(rendering_player_idx, vp_left, vp_top);
 }
 
-void hal_set_sprite(uint8_t sprite_idx, uint8_t x, uint8_t y, uint8_t tile_id, uint8_t flags) {
+void hal_set_sprite(DANDY_CTX_ uint8_t sprite_idx, uint8_t x, uint8_t y, uint8_t tile_id, uint8_t flags) {
     js_set_sprite(rendering_player_idx, sprite_idx, x, y, tile_id, flags);
 }
 
-void hal_play_sound(uint8_t sound_id) {
+void hal_play_sound(DANDY_CTX_ uint8_t sound_id) {
     js_play_sound(sound_id);
 }
 
@@ -65,8 +65,8 @@ void hal_play_sound(uint8_t sound_id) {
 EMSCRIPTEN_KEEPALIVE
 void web_init(void) {
     dandy_init(); // Initializes with only Player 1 joined
-    local_player_idx = 0;
-    dandy_load_level(current_level);
+    dandy_ctx.local_player_idx = 0;
+    dandy_load_level(dandy_ctx.current_level);
 }
 
 EMSCRIPTEN_KEEPALIVE
@@ -82,7 +82,7 @@ void web_step(uint8_t p1_input, uint8_t p2_input, uint8_t p3_input, uint8_t p4_i
 EMSCRIPTEN_KEEPALIVE
 void web_draw_viewports(void) {
     for (uint8_t p = 0; p < MAX_PLAYERS; ++p) {
-        if (player_joined[p]) {
+        if (dandy_ctx.player_joined[p]) {
             rendering_player_idx = p;
             dandy_draw_viewport(p);
         }
@@ -91,14 +91,14 @@ void web_draw_viewports(void) {
 
 EMSCRIPTEN_KEEPALIVE
 uint8_t web_get_current_level(void) {
-    return current_level;
+    return dandy_ctx.current_level;
 }
 
 EMSCRIPTEN_KEEPALIVE
 uint8_t web_get_num_players(void) {
     uint8_t count = 0;
     for (uint8_t p = 0; p < MAX_PLAYERS; ++p) {
-        if (player_joined[p]) count++;
+        if (dandy_ctx.player_joined[p]) count++;
     }
     return count;
 }
@@ -115,5 +115,5 @@ bool web_is_player_joined(uint8_t p_idx) {
 
 EMSCRIPTEN_KEEPALIVE
 uint8_t* web_get_map(void) {
-    return dandy_map;
+    return dandy_ctx.map;
 }
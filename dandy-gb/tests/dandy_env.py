@@ -1,13 +1,69 @@
 import ctypes
 import os
-import shutil
-import sys
-import tempfile
 import _ctypes
 
+MAX_PLAYERS = 4
+
+
+class DandyDoorRun(ctypes.Structure):
+    _fields_ = [("pos", ctypes.c_uint16), ("len", ctypes.c_uint8)]
+
+
+class DandyContext(ctypes.Structure):
+    """Mirror of DandyContext in src/dandy_core.h. DandyEnv checks its size
+    against the library's dandy_sizeof_context, so the two can't drift apart
+    unnoticed."""
+    _fields_ = [
+        ("map", ctypes.c_uint8 * 2048),
+        ("current_level", ctypes.c_uint8),
+        ("monster_rotor", ctypes.c_uint8),
+        ("rng_state", ctypes.c_uint16),
+        ("player_joined", ctypes.c_bool * MAX_PLAYERS),
+        ("local_player_idx", ctypes.c_uint8),
+        ("player_x", ctypes.c_uint8 * MAX_PLAYERS),
+        ("player_y", ctypes.c_uint8 * MAX_PLAYERS),
+        ("player_health", ctypes.c_int16 * MAX_PLAYERS),
+        ("player_score", ctypes.c_uint16 * MAX_PLAYERS),
+        ("player_bombs", ctypes.c_uint8 * MAX_PLAYERS),
+        ("player_keys", ctypes.c_uint8 * MAX_PLAYERS),
+        ("player_dir", ctypes.c_int8 * MAX_PLAYERS),
+        ("player_move_timer", ctypes.c_uint8 * MAX_PLAYERS),
+        ("arrow_x", ctypes.c_uint8 * MAX_PLAYERS),
+        ("arrow_y", ctypes.c_uint8 * MAX_PLAYERS),
+        ("arrow_dir", ctypes.c_int8 * MAX_PLAYERS),
+        ("is_dirty", ctypes.c_bool),
+        ("old_buttons", ctypes.c_uint8 * MAX_PLAYERS),
+        ("door_runs", ctypes.POINTER(DandyDoorRun)),
+        ("entity_mask", (ctypes.c_uint16 * 8) * 16),
+        ("flood_stack_pos", ctypes.c_uint16 * 64),
+        ("flood_stack_ptr", ctypes.c_int8),
+        ("flood_overflow", ctypes.c_bool),
+    ]
+
+
+class GBDandyContext(ctypes.Structure):
+    """The same struct as SDCC lays it out: no padding, 16-bit pointers.
+    The emulator tests add these offsets to the ROM's _dandy_ctx."""
+    _pack_ = 1
+    _fields_ = [(name, ctypes.c_uint16 if name == "door_runs" else kind)
+                for name, kind in DandyContext._fields_]
+
+
+def gb_context_address(ctx_addr, field):
+    """WRAM address of a DandyContext field in a GameBoy ROM."""
+    return ctx_addr + getattr(GBDandyContext, field).offset
+
+
 class DandyEnv:
+    # The map is exposed as 60x30 (index y * 60 + x). The C buffer is 64x32,
+    # padded with walls, and indexed (y << 6) | x.
     MAP_SIZE = 1800
-    MAX_PLAYERS = 4
+    MAP_WIDTH = 60
+    MAP_HEIGHT = 30
+    MAP_STRIDE = 64
+    MAP_BUFFER_SIZE = 2048
+    MAX_PLAYERS = MAX_PLAYERS
+    DANDY_RNG_SEED = 0xACE1
     
     # Button constants matching dandy_core.h
     BUTTON_LEFT = 1 << 0
@@ -68,60 +124,86 @@ class DandyEnv:
                         f"Please run 'make test_lib' first to compile it."
                     )
         
-        # Create unique temp library copy to achieve 100% state isolation
-        script_dir = os.path.dirname(os.path.abspath(__file__))
-        temp_base = os.path.join(script_dir, ".temp_envs")
-        os.makedirs(temp_base, exist_ok=True)
-        self._temp_dir = tempfile.mkdtemp(prefix="dandy_env_", dir=temp_base)
-        self._temp_lib_path = os.path.join(self._temp_dir, "libdandy_test.so")
-        shutil.copy(lib_path, self._temp_lib_path)
-        
-        # Load the unique library copy
-        try:
-            # Check file existence and size
-            if not os.path.exists(self._temp_lib_path):
-                print(f"[DandyEnv] ERROR: Temp lib file does not exist at {self._temp_lib_path} right after copy!")
-            else:
-                size = os.path.getsize(self._temp_lib_path)
-                if size == 0:
-                    print(f"[DandyEnv] ERROR: Temp lib file at {self._temp_lib_path} is 0 bytes! Source was {lib_path} ({os.path.getsize(lib_path)} bytes)")
-            self._lib = ctypes.CDLL(self._temp_lib_path)
-        except Exception as e:
-            if os.path.exists(self._temp_lib_path):
-                print(f"[DandyEnv] CDLL load failed. Temp lib size: {os.path.getsize(self._temp_lib_path)} bytes.")
-            else:
-                print(f"[DandyEnv] CDLL load failed. Temp lib does not exist anymore.")
-            raise e
+        # Every env of a library shares the one loaded copy: each drives its
+        # own DandyContext, and the mock HAL keeps a recording per context.
+        # A single-context library has just the one game, so envs of it
+        # share that too.
+        self._lib = ctypes.CDLL(lib_path)
         self._setup_bindings()
+        # A context may sit where a closed env's was; start from nothing
+        self._lib.mock_clear_buffers(*self._ctx_args)
         
     def _setup_bindings(self):
+        # --- The Game's Context ---
+        # A library built with DANDY_SINGLE_CONTEXT (as the GameBoy build is)
+        # has one global context and no ctx parameters; otherwise the env
+        # owns a context and passes it to every call.
+        size = ctypes.c_uint16.in_dll(self._lib, "dandy_sizeof_context").value
+        if size != ctypes.sizeof(DandyContext):
+            raise RuntimeError(f"DandyContext is {size} bytes in the library but "
+                               f"{ctypes.sizeof(DandyContext)} in dandy_env.py")
+        try:
+            self._ctx = DandyContext.in_dll(self._lib, "dandy_ctx")
+            self._ctx_args = ()
+            ctx_types = []
+        except ValueError:
+            self._ctx = DandyContext()
+            self._ctx_args = (ctypes.byref(self._ctx),)
+            ctx_types = [ctypes.POINTER(DandyContext)]
+
         # --- Core Function Signatures ---
-        self._lib.dandy_init.argtypes = []
+        self._lib.dandy_init.argtypes = ctx_types
         self._lib.dandy_init.restype = None
 
-        self._lib.dandy_step.argtypes = [ctypes.POINTER(ctypes.c_uint8)]
+        self._lib.dandy_step.argtypes = ctx_types + [ctypes.POINTER(ctypes.c_uint8)]
         self._lib.dandy_step.restype = None
 
-        self._lib.dandy_load_level.argtypes = [ctypes.c_uint8]
+        self._lib.dandy_load_level.argtypes = ctx_types + [ctypes.c_uint8]
         self._lib.dandy_load_level.restype = None
 
-        self._lib.dandy_draw_viewport.argtypes = [ctypes.c_uint8]
+        self._lib.dandy_draw_viewport.argtypes = ctx_types + [ctypes.c_uint8]
         self._lib.dandy_draw_viewport.restype = None
 
-        self._lib.dandy_join_player.argtypes = [ctypes.c_uint8]
+        self._lib.dandy_join_player.argtypes = ctx_types + [ctypes.c_uint8]
         self._lib.dandy_join_player.restype = None
 
-        self._lib.dandy_is_player_joined.argtypes = [ctypes.c_uint8]
+        self._lib.dandy_is_player_joined.argtypes = ctx_types + [ctypes.c_uint8]
         self._lib.dandy_is_player_joined.restype = ctypes.c_bool
+
+        self._lib.dandy_rebuild_entities.argtypes = ctx_types
+        self._lib.dandy_rebuild_entities.restype = None
+
+        self._lib.dandy_seed.argtypes = ctx_types + [ctypes.c_uint16]
+        self._lib.dandy_seed.restype = None
+
+        # Snapshots are handled as opaque bytes; deltas only exist in
+        # builds with a context per game
+        self.snapshot_size = ctypes.c_uint16.in_dll(self._lib, "dandy_snapshot_size").value
+        self._lib.dandy_snapshot.argtypes = ctx_types + [ctypes.c_void_p]
+        self._lib.dandy_snapshot.restype = None
+
+        self._lib.dandy_restore.argtypes = ctx_types + [ctypes.c_char_p]
+        self._lib.dandy_restore.restype = None
+
+        self.has_snapshot_delta = hasattr(self._lib, "dandy_snapshot_delta")
+        if self.has_snapshot_delta:
+            self._lib.dandy_snapshot_delta.argtypes = ctx_types + [ctypes.c_void_p]
+            self._lib.dandy_snapshot_delta.restype = ctypes.c_uint16
+
+            self._lib.dandy_restore_delta.argtypes = ctx_types + [ctypes.c_char_p, ctypes.c_uint16]
+            self._lib.dandy_restore_delta.restype = ctypes.c_bool
         
         # --- Mock Extension Signatures ---
-        self._lib.mock_clear_buffers.argtypes = []
+        self._lib.mock_clear_buffers.argtypes = ctx_types
         self._lib.mock_clear_buffers.restype = None
 
-        self._lib.mock_get_draw_count.argtypes = []
+        self._lib.mock_release.argtypes = ctx_types
+        self._lib.mock_release.restype = None
+
+        self._lib.mock_get_draw_count.argtypes = ctx_types
         self._lib.mock_get_draw_count.restype = ctypes.c_int
 
-        self._lib.mock_get_draw.argtypes = [
+        self._lib.mock_get_draw.argtypes = ctx_types + [
             ctypes.c_int, 
             ctypes.POINTER(ctypes.c_uint8), 
             ctypes.POINTER(ctypes.c_uint8), 
@@ -129,13 +211,13 @@ class DandyEnv:
         ]
         self._lib.mock_get_draw.restype = None
 
-        self._lib.mock_get_sound_count.argtypes = []
+        self._lib.mock_get_sound_count.argtypes = ctx_types
         self._lib.mock_get_sound_count.restype = ctypes.c_int
 
-        self._lib.mock_get_sound.argtypes = [ctypes.c_int]
+        self._lib.mock_get_sound.argtypes = ctx_types + [ctypes.c_int]
         self._lib.mock_get_sound.restype = ctypes.c_uint8
 
-        self._lib.mock_get_sprite.argtypes = [
+        self._lib.mock_get_sprite.argtypes = ctx_types + [
             ctypes.c_uint8, 
             ctypes.POINTER(ctypes.c_uint8), 
             ctypes.POINTER(ctypes.c_uint8), 
@@ -144,59 +226,52 @@ class DandyEnv:
         ]
         self._lib.mock_get_sprite.restype = None
 
-        self._lib.mock_is_sprite_active.argtypes = [ctypes.c_uint8]
+        self._lib.mock_is_sprite_active.argtypes = ctx_types + [ctypes.c_uint8]
         self._lib.mock_is_sprite_active.restype = ctypes.c_bool
 
-        self._lib.mock_get_sprite_oob_error.argtypes = []
+        self._lib.mock_get_sprite_oob_error.argtypes = ctx_types
         self._lib.mock_get_sprite_oob_error.restype = ctypes.c_bool
 
-        self._lib.mock_get_hud_update_count.argtypes = []
+        self._lib.mock_get_hud_update_count.argtypes = ctx_types
         self._lib.mock_get_hud_update_count.restype = ctypes.c_int
 
-        self._lib.mock_get_camera.argtypes = [
+        self._lib.mock_get_camera.argtypes = ctx_types + [
             ctypes.POINTER(ctypes.c_uint8), 
             ctypes.POINTER(ctypes.c_uint8)
         ]
         self._lib.mock_get_camera.restype = None
 
-        # --- Bind Live C Globals ---
-        self._dandy_map = (ctypes.c_uint8 * self.MAP_SIZE).in_dll(self._lib, "dandy_map")
-        self._current_level = ctypes.c_uint8.in_dll(self._lib, "current_level")
-        self._monster_rotor = ctypes.c_uint8.in_dll(self._lib, "monster_rotor")
-        self._player_joined = (ctypes.c_bool * self.MAX_PLAYERS).in_dll(self._lib, "player_joined")
-        self._local_player_idx = ctypes.c_uint8.in_dll(self._lib, "local_player_idx")
-        self._is_dirty = ctypes.c_bool.in_dll(self._lib, "is_dirty")
+        # --- Bind Live C State ---
+        # Views into the context, so writes go straight to the engine
+        self._dandy_map = self._ctx.map
         self._dandy_num_levels = ctypes.c_uint8.in_dll(self._lib, "dandy_num_levels")
-        
-        self._player_x = (ctypes.c_uint8 * self.MAX_PLAYERS).in_dll(self._lib, "player_x")
-        self._player_y = (ctypes.c_uint8 * self.MAX_PLAYERS).in_dll(self._lib, "player_y")
-        self._player_health = (ctypes.c_int16 * self.MAX_PLAYERS).in_dll(self._lib, "player_health")
-        self._player_score = (ctypes.c_uint16 * self.MAX_PLAYERS).in_dll(self._lib, "player_score")
-        self._player_bombs = (ctypes.c_uint8 * self.MAX_PLAYERS).in_dll(self._lib, "player_bombs")
-        self._player_keys = (ctypes.c_uint8 * self.MAX_PLAYERS).in_dll(self._lib, "player_keys")
-        self._player_dir = (ctypes.c_int8 * self.MAX_PLAYERS).in_dll(self._lib, "player_dir")
-        self._player_move_timer = (ctypes.c_uint8 * self.MAX_PLAYERS).in_dll(self._lib, "player_move_timer")
-        
-        self._arrow_x = (ctypes.c_uint8 * self.MAX_PLAYERS).in_dll(self._lib, "arrow_x")
-        self._arrow_y = (ctypes.c_uint8 * self.MAX_PLAYERS).in_dll(self._lib, "arrow_y")
-        self._arrow_dir = (ctypes.c_int8 * self.MAX_PLAYERS).in_dll(self._lib, "arrow_dir")
+        self._player_joined = self._ctx.player_joined
+
+        self._player_x = self._ctx.player_x
+        self._player_y = self._ctx.player_y
+        self._player_health = self._ctx.player_health
+        self._player_score = self._ctx.player_score
+        self._player_bombs = self._ctx.player_bombs
+        self._player_keys = self._ctx.player_keys
+        self._player_dir = self._ctx.player_dir
+        self._player_move_timer = self._ctx.player_move_timer
+
+        self._arrow_x = self._ctx.arrow_x
+        self._arrow_y = self._ctx.arrow_y
+        self._arrow_dir = self._ctx.arrow_dir
 
     def close(self):
         """
-        Explicitly unloads the shared library and deletes the temporary directory,
-        handling exceptions gracefully.
+        Frees this env's mock recording and drops its reference to the
+        shared library, which is unloaded once no env holds it.
         """
         if hasattr(self, "_lib"):
             try:
+                self._lib.mock_release(*self._ctx_args)
                 _ctypes.dlclose(self._lib._handle)
             except Exception:
                 pass
             del self._lib
-        if hasattr(self, "_temp_dir") and os.path.exists(self._temp_dir):
-            try:
-                shutil.rmtree(self._temp_dir)
-            except Exception as e:
-                print(f"Warning: Failed to remove temp directory {self._temp_dir}: {e}", file=sys.stderr)
 
     def __enter__(self):
         return self
@@ -214,46 +289,65 @@ class DandyEnv:
 
     @property
     def dandy_map(self):
-        return list(self._dandy_map)
+        buf = bytes(self._dandy_map)
+        result = []
+        for y in range(self.MAP_HEIGHT):
+            start = y * self.MAP_STRIDE
+            result.extend(buf[start:start + self.MAP_WIDTH])
+        return result
     
     @dandy_map.setter
     def dandy_map(self, new_map):
         if len(new_map) != self.MAP_SIZE:
             raise ValueError(f"Map size must be exactly {self.MAP_SIZE}")
-        for i in range(self.MAP_SIZE):
-            self._dandy_map[i] = new_map[i]
+        # Rebuild the wall padding too, in case init() hasn't run yet
+        padded = [self.TILE_WALL] * self.MAP_BUFFER_SIZE
+        for y in range(self.MAP_HEIGHT):
+            start = y * self.MAP_STRIDE
+            padded[start:start + self.MAP_WIDTH] = new_map[y * self.MAP_WIDTH:(y + 1) * self.MAP_WIDTH]
+        self._dandy_map[:] = padded
+        # Writing the map behind the core's back; resync its monster/generator set
+        self.rebuild_entities()
 
     @property
     def current_level(self):
-        return self._current_level.value
+        return self._ctx.current_level
 
     @current_level.setter
     def current_level(self, val):
-        self._current_level.value = val
+        self._ctx.current_level = val
 
     @property
     def monster_rotor(self):
-        return self._monster_rotor.value
+        return self._ctx.monster_rotor
 
     @monster_rotor.setter
     def monster_rotor(self, val):
-        self._monster_rotor.value = val
+        self._ctx.monster_rotor = val
+
+    @property
+    def rng_state(self):
+        return self._ctx.rng_state
+
+    @rng_state.setter
+    def rng_state(self, val):
+        self._ctx.rng_state = val
 
     @property
     def local_player_idx(self):
-        return self._local_player_idx.value
+        return self._ctx.local_player_idx
 
     @local_player_idx.setter
     def local_player_idx(self, val):
-        self._local_player_idx.value = val
+        self._ctx.local_player_idx = val
 
     @property
     def is_dirty(self):
-        return self._is_dirty.value
+        return self._ctx.is_dirty
 
     @is_dirty.setter
     def is_dirty(self, val):
-        self._is_dirty.value = val
+        self._ctx.is_dirty = val
 
     # --- Player State Array Accessors (Explorer 1 Style) ---
     def get_player_x(self, p_idx):
@@ -344,7 +438,7 @@ class DandyEnv:
 
     # --- Core Engine API Wrappers ---
     def init(self):
-        self._lib.dandy_init()
+        self._lib.dandy_init(*self._ctx_args)
 
     def step(self, inputs):
         """
@@ -353,29 +447,56 @@ class DandyEnv:
         if len(inputs) != self.MAX_PLAYERS:
             raise ValueError(f"Inputs must contain exactly {self.MAX_PLAYERS} items")
         arr = (ctypes.c_uint8 * self.MAX_PLAYERS)(*inputs)
-        self._lib.dandy_step(arr)
+        self._lib.dandy_step(*self._ctx_args, arr)
+
+    def seed(self, seed):
+        self._lib.dandy_seed(*self._ctx_args, seed)
 
     def load_level(self, level_idx):
-        self._lib.dandy_load_level(level_idx)
+        self._lib.dandy_load_level(*self._ctx_args, level_idx)
 
     def draw_viewport(self, local_p_idx):
-        self._lib.dandy_draw_viewport(local_p_idx)
+        self._lib.dandy_draw_viewport(*self._ctx_args, local_p_idx)
 
     def join_player(self, p_idx):
-        self._lib.dandy_join_player(p_idx)
+        self._lib.dandy_join_player(*self._ctx_args, p_idx)
+
+    def rebuild_entities(self):
+        self._lib.dandy_rebuild_entities(*self._ctx_args)
+
+    def snapshot(self):
+        """The game's state as a DandySnapshot, in bytes."""
+        buf = ctypes.create_string_buffer(self.snapshot_size)
+        self._lib.dandy_snapshot(*self._ctx_args, buf)
+        return buf.raw
+
+    def restore(self, snapshot):
+        if len(snapshot) != self.snapshot_size:
+            raise ValueError(f"A snapshot is {self.snapshot_size} bytes, not {len(snapshot)}")
+        self._lib.dandy_restore(*self._ctx_args, snapshot)
+
+    def snapshot_delta(self):
+        """The game's state as a snapshot delta against its level, in bytes."""
+        buf = ctypes.create_string_buffer(self.snapshot_size + self.MAP_SIZE)
+        size = self._lib.dandy_snapshot_delta(*self._ctx_args, buf)
+        return buf.raw[:size]
+
+    def restore_delta(self, delta):
+        """Returns False, leaving the game as it was, if delta is malformed."""
+        return self._lib.dandy_restore_delta(*self._ctx_args, delta, len(delta))
 
     # --- Mock HAL Query API Wrappers ---
     def mock_clear(self):
-        self._lib.mock_clear_buffers()
+        self._lib.mock_clear_buffers(*self._ctx_args)
 
     def clear_mock_buffers(self):
-        self._lib.mock_clear_buffers()
+        self._lib.mock_clear_buffers(*self._ctx_args)
 
     def mock_get_draw_count(self):
-        return self._lib.mock_get_draw_count()
+        return self._lib.mock_get_draw_count(*self._ctx_args)
 
     def get_draw_count(self):
-        return self._lib.mock_get_draw_count()
+        return self._lib.mock_get_draw_count(*self._ctx_args)
 
     def mock_get_draws(self):
         count = self.mock_get_draw_count()
@@ -384,7 +505,7 @@ class DandyEnv:
         y = ctypes.c_uint8()
         tile_id = ctypes.c_uint8()
         for i in range(count):
-            self._lib.mock_get_draw(i, ctypes.byref(x), ctypes.byref(y), ctypes.byref(tile_id))
+            self._lib.mock_get_draw(*self._ctx_args, i, ctypes.byref(x), ctypes.byref(y), ctypes.byref(tile_id))
             draws.append((x.value, y.value, tile_id.value))
         return draws
 
@@ -395,28 +516,28 @@ class DandyEnv:
         y = ctypes.c_uint8()
         tile_id = ctypes.c_uint8()
         for i in range(count):
-            self._lib.mock_get_draw(i, ctypes.byref(x), ctypes.byref(y), ctypes.byref(tile_id))
+            self._lib.mock_get_draw(*self._ctx_args, i, ctypes.byref(x), ctypes.byref(y), ctypes.byref(tile_id))
             draws.append({'x': x.value, 'y': y.value, 'tile_id': tile_id.value})
         return draws
 
     def mock_get_sound_count(self):
-        return self._lib.mock_get_sound_count()
+        return self._lib.mock_get_sound_count(*self._ctx_args)
 
     def mock_get_sounds(self):
         count = self.mock_get_sound_count()
-        return [self._lib.mock_get_sound(i) for i in range(count)]
+        return [self._lib.mock_get_sound(*self._ctx_args, i) for i in range(count)]
 
     def get_sounds(self):
-        count = self._lib.mock_get_sound_count()
-        return [self._lib.mock_get_sound(i) for i in range(count)]
+        count = self._lib.mock_get_sound_count(*self._ctx_args)
+        return [self._lib.mock_get_sound(*self._ctx_args, i) for i in range(count)]
 
     def mock_get_sprite(self, sprite_idx):
         x = ctypes.c_uint8()
         y = ctypes.c_uint8()
         tile_id = ctypes.c_uint8()
         flags = ctypes.c_uint8()
-        self._lib.mock_get_sprite(sprite_idx, ctypes.byref(x), ctypes.byref(y), ctypes.byref(tile_id), ctypes.byref(flags))
-        active = self._lib.mock_is_sprite_active(sprite_idx)
+        self._lib.mock_get_sprite(*self._ctx_args, sprite_idx, ctypes.byref(x), ctypes.byref(y), ctypes.byref(tile_id), ctypes.byref(flags))
+        active = self._lib.mock_is_sprite_active(*self._ctx_args, sprite_idx)
         return {
             "x": x.value,
             "y": y.value,
@@ -435,8 +556,8 @@ class DandyEnv:
         tile_id = ctypes.c_uint8()
         flags = ctypes.c_uint8()
         for i in range(40):
-            if self._lib.mock_is_sprite_active(i):
-                self._lib.mock_get_sprite(i, ctypes.byref(x), ctypes.byref(y), ctypes.byref(tile_id), ctypes.byref(flags))
+            if self._lib.mock_is_sprite_active(*self._ctx_args, i):
+                self._lib.mock_get_sprite(*self._ctx_args, i, ctypes.byref(x), ctypes.byref(y), ctypes.byref(tile_id), ctypes.byref(flags))
                 sprites[i] = {
                     'x': x.value,
                     'y': y.value,
@@ -448,23 +569,23 @@ class DandyEnv:
     def mock_get_viewport_camera(self):
         cam_x = ctypes.c_uint8()
         cam_y = ctypes.c_uint8()
-        self._lib.mock_get_camera(ctypes.byref(cam_x), ctypes.byref(cam_y))
+        self._lib.mock_get_camera(*self._ctx_args, ctypes.byref(cam_x), ctypes.byref(cam_y))
         return cam_x.value, cam_y.value
 
     def get_camera(self):
         cam_x = ctypes.c_uint8()
         cam_y = ctypes.c_uint8()
-        self._lib.mock_get_camera(ctypes.byref(cam_x), ctypes.byref(cam_y))
+        self._lib.mock_get_camera(*self._ctx_args, ctypes.byref(cam_x), ctypes.byref(cam_y))
         return cam_x.value, cam_y.value
 
     def mock_get_hud_update_count(self):
-        return self._lib.mock_get_hud_update_count()
+        return self._lib.mock_get_hud_update_count(*self._ctx_args)
 
     def get_hud_update_count(self):
-        return self._lib.mock_get_hud_update_count()
+        return self._lib.mock_get_hud_update_count(*self._ctx_args)
 
     def get_sprite_oob_error(self):
-        return self._lib.mock_get_sprite_oob_error()
+        return self._lib.mock_get_sprite_oob_error(*self._ctx_args)
 
     def assert_outer_border_walls(self, test_case):
         """
@@ -3,6 +3,7 @@
 
 #define MAX_MOCK_DRAWS 2048
 #define MAX_MOCK_SOUNDS 256
+#define MAX_MOCK_GAMES 64
 
 typedef struct {
     uint8_t x;
@@ -18,88 +19,125 @@ typedef struct {
     bool active;
 } SpriteState;
 
-static DrawCall mock_draws[MAX_MOCK_DRAWS];
-static int mock_draw_count = 0;
-
-static uint8_t mock_sounds[MAX_MOCK_SOUNDS];
-static int mock_sound_count = 0;
-
-static SpriteState mock_sprites[40];
-static int mock_hud_update_count = 0;
-
-static uint8_t mock_camera_x = 0;
-static uint8_t mock_camera_y = 0;
-static bool mock_sprite_oob_error = false;
+typedef struct {
+    const DandyContext* game; // NULL while the slot is free
+
+    DrawCall draws[MAX_MOCK_DRAWS];
+    int draw_count;
+
+    uint8_t sounds[MAX_MOCK_SOUNDS];
+    int sound_count;
+
+    SpriteState sprites[40];
+    int hud_update_count;
+
+    uint8_t camera_x;
+    uint8_t camera_y;
+    bool sprite_oob_error;
+} MockRecording;
+
+static MockRecording mock_games[MAX_MOCK_GAMES];
+// Shared by every game past the first MAX_MOCK_GAMES at once
+static MockRecording mock_overflow;
+
+#ifdef DANDY_SINGLE_CONTEXT
+#define MOCK_GAME (&dandy_ctx)
+#else
+#define MOCK_GAME ctx
+#endif
+
+/* The recording of game, claiming a free (and cleared) slot for it if it
+   has none yet */
+static MockRecording* recording_of(const DandyContext* game) {
+    MockRecording* free_slot = NULL;
+    for (int i = 0; i < MAX_MOCK_GAMES; ++i) {
+        if (mock_games[i].game == game) {
+            return &mock_games[i];
+        }
+        if (!mock_games[i].game && !free_slot) {
+            free_slot = &mock_games[i];
+        }
+    }
+    if (!free_slot) {
+        return &mock_overflow;
+    }
+    memset(free_slot, 0, sizeof(*free_slot));
+    free_slot->game = game;
+    return free_slot;
+}
 
 /* --- Game Engine HAL Implementation --- */
 
-void hal_draw_tile(uint8_t x, uint8_t y, uint8_t tile_id) {
-    if (mock_draw_count < MAX_MOCK_DRAWS) {
-        mock_draws[mock_draw_count].x = x;
-        mock_draws[mock_draw_count].y = y;
-        mock_draws[mock_draw_count].tile_id = tile_id;
-        mock_draw_count++;
+void hal_draw_tile(DANDY_CTX_ uint8_t x, uint8_t y, uint8_t tile_id) {
+    MockRecording* rec = recording_of(MOCK_GAME);
+    if (rec->draw_count < MAX_MOCK_DRAWS) {
+        rec->draws[rec->draw_count].x = x;
+        rec->draws[rec->draw_count].y = y;
+        rec->draws[rec->draw_count].tile_id = tile_id;
+        rec->draw_count++;
     }
 }
 
-void hal_update_hud(void) {
-    mock_hud_update_count++;
+void hal_update_hud(DANDY_CTX) {
+    recording_of(MOCK_GAME)->hud_update_count++;
 }
 
-void hal_clear_sprites(uint8_t vp_left, uint8_t vp_top) {
-    mock_camera_x = vp_left;
-    mock_camera_y = vp_top;
+void hal_clear_sprites(DANDY_CTX_ uint8_t vp_left, uint8_t vp_top) {
+    MockRecording* rec = recording_of(MOCK_GAME);
+    rec->camera_x = vp_left;
+    rec->camera_y = vp_top;
     for (int i = 0; i < 40; ++i) {
-        mock_sprites[i].active = false;
+        rec->sprites[i].active = false;
     }
 }
 
-void hal_set_sprite(uint8_t sprite_idx, uint8_t x, uint8_t y, uint8_t tile_id, uint8_t flags) {
+void hal_set_sprite(DANDY_CTX_ uint8_t sprite_idx, uint8_t x, uint8_t y, uint8_t tile_id, uint8_t flags) {
+    MockRecording* rec = recording_of(MOCK_GAME);
     if (sprite_idx < 40) {
-        mock_sprites[sprite_idx].x = x;
-        mock_sprites[sprite_idx].y = y;
-        mock_sprites[sprite_idx].tile_id = tile_id;
-        mock_sprites[sprite_idx].flags = flags;
-        mock_sprites[sprite_idx].active = true;
+        rec->sprites[sprite_idx].x = x;
+        rec->sprites[sprite_idx].y = y;
+        rec->sprites[sprite_idx].tile_id = tile_id;
+        rec->sprites[sprite_idx].flags = flags;
+        rec->sprites[sprite_idx].active = true;
     } else {
-        mock_sprite_oob_error = true;
+        rec->sprite_oob_error = true;
     }
 }
 
-void hal_play_sound(uint8_t sound_id) {
-    if (mock_sound_count < MAX_MOCK_SOUNDS) {
-        mock_sounds[mock_sound_count] = sound_id;
-        mock_sound_count++;
+void hal_play_sound(DANDY_CTX_ uint8_t sound_id) {
+    MockRecording* rec = recording_of(MOCK_GAME);
+    if (rec->sound_count < MAX_MOCK_SOUNDS) {
+        rec->sounds[rec->sound_count] = sound_id;
+        rec->sound_count++;
     }
 }
 
 /* --- Mock Query Extensions --- */
 
-void mock_clear_buffers(void) {
-    mock_sprite_oob_error = false;
-    mock_draw_count = 0;
-    mock_sound_count = 0;
-    mock_hud_update_count = 0;
-    mock_camera_x = 0;
-    mock_camera_y = 0;
-    for (int i = 0; i < 40; ++i) {
-        mock_sprites[i].x = 0;
-        mock_sprites[i].y = 0;
-        mock_sprites[i].tile_id = 0;
-        mock_sprites[i].flags = 0;
-        mock_sprites[i].active = false;
+void mock_clear_buffers(DANDY_CTX) {
+    MockRecording* rec = recording_of(MOCK_GAME);
+    const DandyContext* game = rec->game;
+    memset(rec, 0, sizeof(*rec));
+    rec->game = game;
+}
+
+void mock_release(DANDY_CTX) {
+    MockRecording* rec = recording_of(MOCK_GAME);
+    if (rec != &mock_overflow) {
+        rec->game = NULL;
     }
 }
 
-int mock_get_draw_count(void) {
-    return mock_draw_count;
+int mock_get_draw_count(DANDY_CTX) {
+    return recording_of(MOCK_GAME)->draw_count;
 }
 
-void mock_get_draw(int idx, uint8_t* x, uint8_t* y, uint8_t* tile_id) {
-    if (idx >= 0 && idx < mock_draw_count) {
-        if (x) *x = mock_draws[idx].x;
-        if (y) *y = mock_draws[idx].y;
-        if (tile_id) *tile_id = mock_draws[idx].tile_id;
+void mock_get_draw(DANDY_CTX_ int idx, uint8_t* x, uint8_t* y, uint8_t* tile_id) {
+    const MockRecording* rec = recording_of(MOCK_GAME);
+    if (idx >= 0 && idx < rec->draw_count) {
+        if (x) *x = rec->draws[idx].x;
+        if (y) *y = rec->draws[idx].y;
+        if (tile_id) *tile_id = rec->draws[idx].tile_id;
     } else {
         if (x) *x = 0;
         if (y) *y = 0;
@@ -107,23 +145,25 @@ void mock_get_draw(int idx, uint8_t* x, uint8_t* y, uint8_t* tile_id) {
     }
 }
 
-int mock_get_sound_count(void) {
-    return mock_sound_count;
+int mock_get_sound_count(DANDY_CTX) {
+    return recording_of(MOCK_GAME)->sound_count;
 }
 
-uint8_t mock_get_sound(int idx) {
-    if (idx >= 0 && idx < mock_sound_count) {
-        return mock_sounds[idx];
+uint8_t mock_get_sound(DANDY_CTX_ int idx) {
+    const MockRecording* rec = recording_of(MOCK_GAME);
+    if (idx >= 0 && idx < rec->sound_count) {
+        return rec->sounds[idx];
     }
     return 0xFF;
 }
 
-void mock_get_sprite(uint8_t sprite_idx, uint8_t* x, uint8_t* y, uint8_t* tile_id, uint8_t* flags) {
+void mock_get_sprite(DANDY_CTX_ uint8_t sprite_idx, uint8_t* x, uint8_t* y, uint8_t* tile_id, uint8_t* flags) {
+    const MockRecording* rec = recording_of(MOCK_GAME);
     if (sprite_idx < 40) {
-        if (x) *x = mock_sprites[sprite_idx].x;
-        if (y) *y = mock_sprites[sprite_idx].y;
-        if (tile_id) *tile_id = mock_sprites[sprite_idx].tile_id;
-        if (flags) *flags = mock_sprites[sprite_idx].flags;
+        if (x) *x = rec->sprites[sprite_idx].x;
+        if (y) *y = rec->sprites[sprite_idx].y;
+        if (tile_id) *tile_id = rec->sprites[sprite_idx].tile_id;
+        if (flags) *flags = rec->sprites[sprite_idx].flags;
     } else {
         if (x) *x = 0;
         if (y) *y = 0;
@@ -132,22 +172,23 @@ void mock_get_sprite(uint8_t sprite_idx, uint8_t* x, uint8_t* y, uint8_t* tile_i
     }
 }
 
-bool mock_is_sprite_active(uint8_t sprite_idx) {
+bool mock_is_sprite_active(DANDY_CTX_ uint8_t sprite_idx) {
     if (sprite_idx < 40) {
-        return mock_sprites[sprite_idx].active;
+        return recording_of(MOCK_GAME)->sprites[sprite_idx].active;
     }
     return false;
 }
 
-int mock_get_hud_update_count(void) {
-    return mock_hud_update_count;
+int mock_get_hud_update_count(DANDY_CTX) {
+    return recording_of(MOCK_GAME)->hud_update_count;
 }
 
-void mock_get_camera(uint8_t* cam_x, uint8_t* cam_y) {
-    if (cam_x) *cam_x = mock_camera_x;
-    if (cam_y) *cam_y = mock_camera_y;
+void mock_get_camera(DANDY_CTX_ uint8_t* cam_x, uint8_t* cam_y) {
+    const MockRecording* rec = recording_of(MOCK_GAME);
+    if (cam_x) *cam_x = rec->camera_x;
+    if (cam_y) *cam_y = rec->camera_y;
 }
 
-bool mock_get_sprite_oob_error(void) {
-    return mock_sprite_oob_error;
+bool mock_get_sprite_oob_error(DANDY_CTX) {
+    return recording_of(MOCK_GAME)->sprite_oob_error;
 }
@@ -1,30 +1,29 @@
 #ifndef MOCK_HAL_H
 #define MOCK_HAL_H
 
-#include <stdint.h>
-#include <stdbool.h>
+#include "dandy_core.h"
 
-/* Standard GameBoy HAL function signatures required by the engine */
-void hal_draw_tile(uint8_t x, uint8_t y, uint8_t tile_id);
-void hal_update_hud(void);
-void hal_clear_sprites(uint8_t vp_left, uint8_t vp_top);
-void hal_set_sprite(uint8_t sprite_idx, uint8_t x, uint8_t y, uint8_t tile_id, uint8_t flags);
-void hal_play_sound(uint8_t sound_id);
+/* Implements the HAL declared in dandy_core.h, recording every call. Each
+   game has its own recording, found by its context, so any number of games
+   can share one copy of the library (from one thread). The query functions
+   take the context of the game to look at, like the HAL itself. */
 
 /* Mock Control & Query Extensions (Exposed to Python Test Runner) */
-void mock_clear_buffers(void);
+void mock_clear_buffers(DANDY_CTX);
+// Frees the game's recording for another context; call before freeing ctx
+void mock_release(DANDY_CTX);
 
-int mock_get_draw_count(void);
-void mock_get_draw(int idx, uint8_t* x, uint8_t* y, uint8_t* tile_id);
+int mock_get_draw_count(DANDY_CTX);
+void mock_get_draw(DANDY_CTX_ int idx, uint8_t* x, uint8_t* y, uint8_t* tile_id);
 
-int mock_get_sound_count(void);
-uint8_t mock_get_sound(int idx);
+int mock_get_sound_count(DANDY_CTX);
+uint8_t mock_get_sound(DANDY_CTX_ int idx);
 
-void mock_get_sprite(uint8_t sprite_idx, uint8_t* x, uint8_t* y, uint8_t* tile_id, uint8_t* flags);
-bool mock_is_sprite_active(uint8_t sprite_idx);
-bool mock_get_sprite_oob_error(void);
+void mock_get_sprite(DANDY_CTX_ uint8_t sprite_idx, uint8_t* x, uint8_t* y, uint8_t* tile_id, uint8_t* flags);
+bool mock_is_sprite_active(DANDY_CTX_ uint8_t sprite_idx);
+bool mock_get_sprite_oob_error(DANDY_CTX);
 
-int mock_get_hud_update_count(void);
-void mock_get_camera(uint8_t* cam_x, uint8_t* cam_y);
+int mock_get_hud_update_count(DANDY_CTX);
+void mock_get_camera(DANDY_CTX_ uint8_t* cam_x, uint8_t* cam_y);
 
 #endif /* MOCK_HAL_H */
@@ -35,8 +35,14 @@ class TestAdversarialCompression(unittest.TestCase):
         res_sizes = self.libc.mprotect(ctypes.c_void_p(page_addr_sizes), pagesize * 2, 1 | 2)
         if res_sizes != 0:
             raise RuntimeError(f"mprotect failed to make dandy_level_sizes writable: {res_sizes}")
+        self.saved_levels = bytes(self.dandy_levels)
+        self.saved_level_sizes = bytes(self.dandy_level_sizes)
 
     def tearDown(self):
+        # The library stays loaded for other envs: put its tables back
+        if hasattr(self, "saved_levels"):
+            ctypes.memmove(self.dandy_levels, self.saved_levels, len(self.saved_levels))
+            ctypes.memmove(self.dandy_level_sizes, self.saved_level_sizes, len(self.saved_level_sizes))
         if hasattr(self, "env") and self.env is not None:
             self.env.close()
             self.env = None
@@ -0,0 +1,160 @@
+import unittest
+import os
+import sys
+import ctypes
+import random
+
+# Ensure tests/ directory is in sys.path
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+
+from dandy_env import DandyEnv
+
+BITSERIAL_LIB_PATH = os.path.abspath(
+    os.path.join(os.path.dirname(os.path.abspath(__file__)), "../libdandy_test_bitserial.so"))
+
+
+class TestB2TableDecoder(unittest.TestCase):
+    """Round-trip tests proving the host's table-driven Scheme B2 decoder is
+    byte-identical to the GameBoy's bit-serial decoder (built with
+    -DDANDY_BITSERIAL_DECODER into libdandy_test_bitserial.so)."""
+
+    def setUp(self):
+        if not os.path.exists(BITSERIAL_LIB_PATH):
+            self.skipTest("libdandy_test_bitserial.so not built; run 'make test_lib'")
+        self.table_env = DandyEnv()
+        self.serial_env = DandyEnv(lib_path=BITSERIAL_LIB_PATH)
+        self.table_env.init()
+        self.serial_env.init()
+        self.libc = ctypes.CDLL(None)
+        self.custom_refs = []
+        self.originals = []
+        self.levels = {}
+        self.sizes = {}
+        for env in (self.table_env, self.serial_env):
+            self.levels[env] = self.bind_writable(
+                env, "dandy_levels", ctypes.POINTER(ctypes.c_uint8) * env.num_levels)
+            self.sizes[env] = self.bind_writable(
+                env, "dandy_level_sizes", ctypes.c_uint16 * env.num_levels)
+
+    def tearDown(self):
+        # The library stays loaded for other envs: put its tables back
+        for table, saved in self.originals:
+            ctypes.memmove(ctypes.addressof(table), saved, len(saved))
+        for name in ("table_env", "serial_env"):
+            env = getattr(self, name, None)
+            if env is not None:
+                env.close()
+                setattr(self, name, None)
+
+    def bind_writable(self, env, symbol, ctype):
+        """Binds a const ROM table and makes its pages writable with mprotect."""
+        table = ctype.in_dll(env._lib, symbol)
+        pagesize = 4096
+        page_addr = ctypes.addressof(table) & ~(pagesize - 1)
+        res = self.libc.mprotect(ctypes.c_void_p(page_addr), pagesize * 2, 1 | 2) # PROT_READ | PROT_WRITE
+        if res != 0:
+            raise RuntimeError(f"mprotect failed to make {symbol} writable: {res}")
+        self.originals.append((table, bytes(table)))
+        return table
+
+    def encode_b2(self, inner_tiles):
+        """Python Scheme B2 encoder for a list of 1624 inner tile IDs."""
+        bits = []
+        for tile in inner_tiles:
+            if tile == 0:
+                bits.append(0)
+            elif tile == 1:
+                bits.extend([1, 0])
+            else:
+                bits.extend([1, 1])
+                for i in range(3, -1, -1):
+                    bits.append((tile >> i) & 1)
+        packed = []
+        for i in range(0, len(bits), 8):
+            byte_val = 0
+            for bit_idx, bit in enumerate(bits[i:i + 8]):
+                byte_val |= (bit << (7 - bit_idx))
+            packed.append(byte_val)
+        return packed
+
+    def load_stream_in_both(self, stream, logical_size=None):
+        """Points level 0 of both libraries at the same stream and loads it."""
+        if logical_size is None:
+            logical_size = len(stream)
+        # Always keep at least one byte so the pointer is valid
+        data = (ctypes.c_uint8 * max(1, len(stream)))(*stream)
+        self.custom_refs.append(data)
+        for env in (self.table_env, self.serial_env):
+            self.levels[env][0] = ctypes.cast(data, ctypes.POINTER(ctypes.c_uint8))
+            self.sizes[env][0] = logical_size
+            env.load_level(0)
+
+    def assert_maps_identical(self, label):
+        table_map = self.table_env.dandy_map
+        serial_map = self.serial_env.dandy_map
+        if table_map != serial_map:
+            first = next(i for i in range(len(table_map)) if table_map[i] != serial_map[i])
+            self.fail(f"{label}: decoders differ at ({first % 60}, {first // 60}): "
+                      f"table={table_map[first]} serial={serial_map[first]}")
+        self.assertEqual(self.table_env.get_player_x(0), self.serial_env.get_player_x(0))
+        self.assertEqual(self.table_env.get_player_y(0), self.serial_env.get_player_y(0))
+
+    def test_all_shipped_levels_identical(self):
+        """Every level in levels.c decodes to the same map with both decoders."""
+        for level in range(self.table_env.num_levels):
+            self.table_env.load_level(level)
+            self.serial_env.load_level(level)
+            self.assert_maps_identical(f"level {level}")
+
+    def test_random_maps_round_trip(self):
+        """Random maps, biased like the real levels, encode and decode back exactly."""
+        rng = random.Random(0xB2)
+        for case in range(100):
+            inner = []
+            for _ in range(58 * 28):
+                r = rng.random()
+                if r < 0.5:
+                    inner.append(0)
+                elif r < 0.8:
+                    inner.append(1)
+                else:
+                    inner.append(rng.randint(2, 15))
+            self.load_stream_in_both(self.encode_b2(inner))
+            self.assert_maps_identical(f"random map {case}")
+
+            # The decoded inner grid must be the original tiles (except spawn points)
+            decoded = self.serial_env.dandy_map
+            for p in range(self.serial_env.MAX_PLAYERS):
+                if self.serial_env.is_player_joined(p):
+                    px = self.serial_env.get_player_x(p)
+                    py = self.serial_env.get_player_y(p)
+                    decoded[py * 60 + px] = inner[(py - 1) * 58 + (px - 1)]
+            for y in range(1, 29):
+                self.assertEqual(decoded[y * 60 + 1:y * 60 + 59], inner[(y - 1) * 58:y * 58])
+
+    def test_random_byte_streams_identical(self):
+        """Arbitrary byte streams of any length, including truncated ones, decode identically."""
+        rng = random.Random(1624)
+        lengths = [0, 1, 7, 8, 9, 203, 406, 1217, 1218, 1219, 1500]
+        lengths += [rng.randint(0, 1300) for _ in range(60)]
+        for length in lengths:
+            stream = [rng.randint(0, 255) for _ in range(length)]
+            self.load_stream_in_both(stream)
+            self.assert_maps_identical(f"random stream of {length} bytes")
+
+    def test_padding_beyond_logical_size_ignored(self):
+        """Bytes past dandy_level_sizes are never read by either decoder."""
+        stream = [0x00] * 10 + [0xFF] * 1490
+        self.load_stream_in_both(stream, logical_size=10)
+        self.assert_maps_identical("truncated stream")
+        decoded = self.table_env.dandy_map
+        self.assertNotIn(15, decoded)
+
+    def test_all_ones_stream_identical(self):
+        """A stream of all 1 bits (every tile TILE_GENERATOR3) decodes identically."""
+        self.load_stream_in_both([0xFF] * 1218)
+        self.assert_maps_identical("all ones")
+
+
+if __name__ == '__main__':
+    unittest.main()
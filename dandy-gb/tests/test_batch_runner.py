@@ -0,0 +1,147 @@
+import unittest
+import os
+import sys
+import shutil
+import subprocess
+import tempfile
+
+# Ensure tests/ directory is in sys.path
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+
+from dandy_env import DandyEnv
+
+ROOT_DIR = os.path.abspath(os.path.join(os.path.dirname(os.path.abspath(__file__)), ".."))
+
+# Mirrors random_combos in bench/batch_runner.c
+RANDOM_COMBOS = [
+    0,
+    DandyEnv.BUTTON_LEFT, DandyEnv.BUTTON_RIGHT, DandyEnv.BUTTON_UP, DandyEnv.BUTTON_DOWN,
+    DandyEnv.BUTTON_LEFT | DandyEnv.BUTTON_UP, DandyEnv.BUTTON_RIGHT | DandyEnv.BUTTON_UP,
+    DandyEnv.BUTTON_LEFT | DandyEnv.BUTTON_DOWN, DandyEnv.BUTTON_RIGHT | DandyEnv.BUTTON_DOWN,
+    DandyEnv.BUTTON_FIRE, DandyEnv.BUTTON_LEFT | DandyEnv.BUTTON_FIRE,
+    DandyEnv.BUTTON_RIGHT | DandyEnv.BUTTON_FIRE, DandyEnv.BUTTON_UP | DandyEnv.BUTTON_FIRE,
+    DandyEnv.BUTTON_DOWN | DandyEnv.BUTTON_FIRE,
+    DandyEnv.BUTTON_BOMB, DandyEnv.BUTTON_FIRE | DandyEnv.BUTTON_BOMB,
+]
+
+
+def random_inputs(state, held):
+    """Python port of batch_random_inputs. Returns the new state."""
+    for p in range(DandyEnv.MAX_PLAYERS):
+        state ^= (state << 13) & 0xFFFFFFFF
+        state ^= state >> 17
+        state ^= (state << 5) & 0xFFFFFFFF
+        if state & 15 == 0:
+            held[p] = RANDOM_COMBOS[(state >> 4) & 15]
+    return state
+
+
+def fnv1a(h, data):
+    for b in data:
+        h = ((h ^ b) * 16777619) & 0xFFFFFFFF
+    return h
+
+
+class TestBatchRunner(unittest.TestCase):
+    """Builds bench/batch_runner and checks that a game's result doesn't
+    depend on the thread count, and matches the same game stepped through
+    DandyEnv."""
+
+    @classmethod
+    def setUpClass(cls):
+        if shutil.which("gcc") is None:
+            raise unittest.SkipTest("gcc not found")
+        cls.build_dir = tempfile.mkdtemp(prefix="dandy_batch_")
+        cls.exe = os.path.join(cls.build_dir, "batch_runner")
+        subprocess.run(
+            ["gcc", "-O2", "-pthread", "-Isrc", "-o", cls.exe,
+             "bench/batch_main.c", "bench/batch_runner.c", "src/dandy_core.c", "src/levels.c"],
+            cwd=ROOT_DIR, check=True)
+
+    @classmethod
+    def tearDownClass(cls):
+        shutil.rmtree(cls.build_dir, ignore_errors=True)
+
+    def run_batch(self, *args):
+        out = subprocess.run([self.exe, "-v"] + list(args), cwd=ROOT_DIR, check=True,
+                             capture_output=True, text=True).stdout
+        games = [line.split() for line in out.splitlines()
+                 if line and not line.startswith("#") and "games" not in line]
+        return games
+
+    def play_in_env(self, seed, level, players, ticks, input_seed=None, recording=None):
+        """Plays one batch job through DandyEnv; returns (final_level, scores, hash)."""
+        env = DandyEnv()
+        try:
+            env.init()
+            env.seed(seed)
+            env.current_level = level
+            env.load_level(level)
+            for p in range(1, players):
+                env.join_player(p)
+            state = input_seed or 1
+            held = [0] * DandyEnv.MAX_PLAYERS
+            for t in range(ticks):
+                if recording is not None:
+                    chunk = recording[t * 4:t * 4 + 4]
+                    held = list(chunk) if len(chunk) == 4 else [0] * 4
+                elif input_seed is not None:
+                    state = random_inputs(state, held)
+                env.step(held)
+            ctx = env._ctx
+            h = 2166136261
+            for part in (ctx.map, bytes([ctx.current_level]), ctx.player_x, ctx.player_y,
+                         ctx.player_health, ctx.player_score):
+                h = fnv1a(h, bytes(part))
+            scores = ",".join(str(s) for s in ctx.player_score)
+            return str(ctx.current_level), scores, "%08x" % h
+        finally:
+            env.close()
+
+    def test_results_independent_of_thread_count(self):
+        one = self.run_batch("-t", "1", "-n", "60", "-k", "1500", "-p", "2")
+        many = self.run_batch("-t", "4", "-n", "60", "-k", "1500", "-p", "2")
+        self.assertEqual(len(one), 60)
+        self.assertEqual(one, many)
+        # The batch is long enough that something happens in it
+        self.assertGreater(sum(int(g[7]) for g in one), 0, "expected some deaths")
+
+    def test_matches_env(self):
+        games = self.run_batch("-t", "2", "-n", "8", "-k", "1200", "-p", "2")
+        for g in games[:4]:
+            job, seed, level, players, ticks = (int(v) for v in g[:5])
+            final, scores, h = self.play_in_env(seed, level, players, ticks, input_seed=job + 1)
+            self.assertEqual((g[5], g[10], g[11]), (final, scores, h), f"job {job}")
+
+    def test_job_file(self):
+        recording = bytes((t // 7 * 5 + p) % 64 & 0x1F for t in range(900) for p in range(4))
+        rec_path = os.path.join(self.build_dir, "inputs.bin")
+        with open(rec_path, "wb") as f:
+            f.write(recording)
+        job_path = os.path.join(self.build_dir, "jobs.txt")
+        with open(job_path, "w") as f:
+            f.write("# seed level players ticks input\n")
+            f.write("7 3 1 600 idle\n")
+            f.write("9 5 2 800 random:1234   # trailing comment\n")
+            f.write(f"11 8 3 1000 {rec_path}\n")
+        games = self.run_batch("-t", "3", "-f", job_path)
+        self.assertEqual(len(games), 3)
+        expected = [
+            self.play_in_env(7, 3, 1, 600),
+            self.play_in_env(9, 5, 2, 800, input_seed=1234),
+            self.play_in_env(11, 8, 3, 1000, recording=recording),
+        ]
+        for g, exp in zip(games, expected):
+            self.assertEqual((g[5], g[10], g[11]), exp, f"job {g[0]}")
+
+    def test_bad_job_file_is_rejected(self):
+        job_path = os.path.join(self.build_dir, "bad.txt")
+        with open(job_path, "w") as f:
+            f.write("1 99 1 100 idle\n")
+        res = subprocess.run([self.exe, "-f", job_path], cwd=ROOT_DIR, capture_output=True, text=True)
+        self.assertNotEqual(res.returncode, 0)
+        self.assertIn("bad.txt:1", res.stderr)
+
+
+if __name__ == "__main__":
+    unittest.main()
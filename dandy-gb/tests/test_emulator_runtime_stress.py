@@ -16,6 +16,8 @@ import hashlib
 import random
 from pyboy import PyBoy
 
+from dandy_env import gb_context_address
+
 class TestEmulatorRuntimeStress(unittest.TestCase):
     @classmethod
     def setUpClass(cls):
@@ -32,16 +34,17 @@ class TestEmulatorRuntimeStress(unittest.TestCase):
         raw_symbols = cls.parse_map_symbols(cls.map_path)
         
         cls.symbols = {}
-        required_symbols = [
-            "_current_level", "_player_joined", "_player_x", 
-            "_player_y", "_player_health", "_player_score",
-            "_player_bombs", "_player_keys", "_dandy_map"
-        ]
-        for sym in required_symbols:
-            truncated = sym[:9]
-            if truncated not in raw_symbols:
-                raise KeyError(f"Required symbol '{sym}' not found in linker map.")
-            cls.symbols[sym] = raw_symbols[truncated]
+        # The game state lives in one DandyContext, _dandy_ctx; fields are
+        # offsets into it. GBDK truncates map symbols to 9 characters.
+        truncated = "_dandy_ctx"[:9]
+        if truncated not in raw_symbols:
+            raise KeyError(f"Required symbol '_dandy_ctx' (truncated: '{truncated}') not found in linker map file.")
+        ctx_addr = raw_symbols[truncated]
+        for field in ("current_level", "player_joined", "player_x",
+                      "player_y", "player_health", "player_score",
+                      "player_bombs", "player_keys"):
+            cls.symbols["_" + field] = gb_context_address(ctx_addr, field)
+        cls.symbols["_dandy_map"] = gb_context_address(ctx_addr, "map")
 
     @classmethod
     def parse_map_symbols(cls, map_path):
@@ -69,7 +72,7 @@ class TestEmulatorRuntimeStress(unittest.TestCase):
 
     def get_map_tile(self, x, y):
         map_addr = self.symbols["_dandy_map"]
-        idx = y * 60 + x
+        idx = y * 64 + x
         return self.pyboy.memory[map_addr + idx]
 
     # =========================================================================
@@ -93,7 +96,7 @@ class TestEmulatorRuntimeStress(unittest.TestCase):
         for y in range(1, 29):
             for x in range(1, 59):
                 # If this is a Wall tile
-                if self.pyboy.memory[map_addr + y * 60 + x] == 1:
+                if self.pyboy.memory[map_addr + y * 64 + x] == 1:
                     # Check neighbors
                     neighbors = {
                         "up": (x, y + 1),     # Space is below, Wall is above -> we move 'up' into wall
@@ -102,7 +105,7 @@ class TestEmulatorRuntimeStress(unittest.TestCase):
                         "right": (x - 1, y)   # Space is left, Wall is right -> we move 'right' into wall
                     }
                     for dir_name, (nx, ny) in neighbors.items():
-                        if self.pyboy.memory[map_addr + ny * 60 + nx] == 0:
+                        if self.pyboy.memory[map_addr + ny * 64 + nx] == 0:
                             target_px, target_py = nx, ny
                             wall_dir = dir_name
                             found = True
@@ -1,11 +1,13 @@
 import unittest
+import ctypes
 import os
+import random
 import sys
 
 # Ensure tests/ directory is in sys.path
 sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
 
-from dandy_env import DandyEnv
+from dandy_env import DandyEnv, DandyContext
 
 class TestInfraCheck(unittest.TestCase):
     def tearDown(self):
@@ -37,7 +39,7 @@ class TestInfraCheck(unittest.TestCase):
             self.assertFalse(env.is_dirty)
 
     def test_state_isolation(self):
-        """Verify that multiple DandyEnv instances have 100% isolated static states (Copy-on-Load)."""
+        """Verify that multiple DandyEnv instances have 100% isolated game states."""
         with DandyEnv() as env1, DandyEnv() as env2:
             env1.init()
             env2.init()
@@ -60,6 +62,34 @@ class TestInfraCheck(unittest.TestCase):
             # env2 should still step correctly
             env2.step([0, 0, 0, 0])
 
+    def test_contexts_share_one_library(self):
+        """Games in separate DandyContexts of one library don't affect each other."""
+        with DandyEnv() as env:
+            lib = env._lib
+            contexts = [DandyContext() for _ in range(3)]
+            for i, ctx in enumerate(contexts):
+                lib.dandy_init(ctypes.byref(ctx))
+                lib.dandy_load_level(ctypes.byref(ctx), 2 + i)
+                lib.dandy_join_player(ctypes.byref(ctx), 1)
+
+            # Step them interleaved, each with its own input stream
+            rngs = [random.Random(i) for i in range(3)]
+            for _ in range(600):
+                for ctx, rng in zip(contexts, rngs):
+                    inputs = (ctypes.c_uint8 * 4)(*[rng.choice([0, 1, 2, 4, 8, 16, 20]) for _ in range(4)])
+                    lib.dandy_step(ctypes.byref(ctx), inputs)
+
+            # Each must match the same game run alone through the env's own context
+            for i, ctx in enumerate(contexts):
+                env.init()
+                env.load_level(2 + i)
+                env.join_player(1)
+                rng = random.Random(i)
+                for _ in range(600):
+                    env.step([rng.choice([0, 1, 2, 4, 8, 16, 20]) for _ in range(4)])
+                self.assertEqual(bytes(ctx.map), bytes(env._dandy_map), f"context {i}")
+                self.assertEqual(list(ctx.player_health), [env.get_player_health(p) for p in range(4)])
+
     def test_mock_hal_logging_viewport(self):
         """Verify that drawing the viewport logs tile updates and camera positions in the mock HAL."""
         with DandyEnv() as env:
@@ -91,6 +121,23 @@ class TestInfraCheck(unittest.TestCase):
             self.assertTrue(0 <= cam_x <= 40)
             self.assertTrue(0 <= cam_y <= 20)
 
+    def test_mock_hal_recordings_per_env(self):
+        """Envs sharing the library each see only their own game's HAL calls."""
+        with DandyEnv() as env1, DandyEnv() as env2:
+            self.assertEqual(env1._lib._handle, env2._lib._handle)
+            env1.init()
+            env2.init()
+            env1.clear_mock_buffers()
+            env2.clear_mock_buffers()
+
+            env1.draw_viewport(0)
+            self.assertEqual(env1.get_draw_count(), 200)
+            self.assertEqual(env2.get_draw_count(), 0)
+            self.assertEqual(env2.get_sprites(), {})
+
+            env2.clear_mock_buffers()
+            self.assertEqual(env1.get_draw_count(), 200)
+
     def test_game_loop_step_and_sound(self):
         """Verify engine step, global variable updates, and mock HAL sound recording (E2E style)."""
         with DandyEnv() as env:
@@ -2,9 +2,6 @@ import unittest
 import os
 import sys
 import gc
-import shutil
-import tempfile
-import glob
 import resource
 import subprocess
 import time
@@ -36,10 +33,6 @@ def get_mapped_lib_count():
 def get_rss_kb():
     return resource.getrusage(resource.RUSAGE_SELF).ru_maxrss
 
-def get_temp_env_dirs():
-    script_dir = os.path.dirname(os.path.abspath(__file__))
-    return glob.glob(os.path.join(script_dir, '.temp_envs/dandy_env_*'))
-
 class TestInfraStress(unittest.TestCase):
     
     def tearDown(self):
@@ -47,24 +40,16 @@ class TestInfraStress(unittest.TestCase):
             del self.env
 
     def test_lifecycle_and_leak_stability_1000_runs(self):
-        """Instantiate and delete DandyEnv 1000 times to verify no FD, library, temp dir, or memory leaks."""
+        """Instantiate and delete DandyEnv 1000 times to verify no FD, library, or memory leaks."""
         print("\n--- Starting Lifecycle and Leak Stability Test (1000 iterations) ---")
         
-        # Clean up any leftover temp dirs from previous runs first
-        for d in get_temp_env_dirs():
-            try:
-                shutil.rmtree(d)
-            except Exception:
-                pass
-                
         gc.collect()
         
         start_fd = get_open_fd_count()
         start_libs = get_mapped_lib_count()
-        start_temp_dirs = len(get_temp_env_dirs())
         start_rss = get_rss_kb()
         
-        print(f"Initial state: FDs={start_fd}, Mapped Libs={start_libs}, Temp Dirs={start_temp_dirs}, RSS={start_rss} KB")
+        print(f"Initial state: FDs={start_fd}, Mapped Libs={start_libs}, RSS={start_rss} KB")
         
         # Warm up with 5 runs to let ctypes/libc stabilize their internal caches
         for _ in range(5):
@@ -77,9 +62,8 @@ class TestInfraStress(unittest.TestCase):
         
         stable_fd = get_open_fd_count()
         stable_libs = get_mapped_lib_count()
-        stable_temp_dirs = len(get_temp_env_dirs())
         stable_rss = get_rss_kb()
-        print(f"Stabilized state (after warmup): FDs={stable_fd}, Mapped Libs={stable_libs}, Temp Dirs={stable_temp_dirs}, RSS={stable_rss} KB")
+        print(f"Stabilized state (after warmup): FDs={stable_fd}, Mapped Libs={stable_libs}, RSS={stable_rss} KB")
         
         # Run 1000 iterations
         for i in range(1000):
@@ -96,10 +80,9 @@ class TestInfraStress(unittest.TestCase):
         
         end_fd = get_open_fd_count()
         end_libs = get_mapped_lib_count()
-        end_temp_dirs = len(get_temp_env_dirs())
         end_rss = get_rss_kb()
         
-        print(f"Final state (after 1000 runs): FDs={end_fd}, Mapped Libs={end_libs}, Temp Dirs={end_temp_dirs}, RSS={end_rss} KB")
+        print(f"Final state (after 1000 runs): FDs={end_fd}, Mapped Libs={end_libs}, RSS={end_rss} KB")
         
         # Assertions
         # 1. File Descriptors: should not grow by more than a tiny buffer (e.g. 1-2 due to python internals, but ideally 0)
@@ -108,10 +91,7 @@ class TestInfraStress(unittest.TestCase):
         # 2. Shared Library mappings: must remain identical
         self.assertEqual(end_libs, stable_libs, f"Shared library handle leak detected! Stabilized: {stable_libs}, End: {end_libs}")
         
-        # 3. Temp directories: must not leak (no growth compared to stable baseline)
-        self.assertLessEqual(end_temp_dirs, stable_temp_dirs, f"Temp directory leak detected! Leftover: {get_temp_env_dirs()}")
-        
-        # 4. Memory: RSS should remain stable (allowing a small overhead, e.g., 5MB/5120KB for Python's allocator fragmentation, but not unbounded growth)
+        # 3. Memory: RSS should remain stable (allowing a small overhead, e.g., 5MB/5120KB for Python's allocator fragmentation, but not unbounded growth)
         rss_growth = end_rss - stable_rss
         print(f"RSS Memory Growth: {rss_growth} KB")
         self.assertLessEqual(rss_growth, 5120, f"Memory leak detected! RSS grew by {rss_growth} KB")
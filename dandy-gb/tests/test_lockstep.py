@@ -0,0 +1,161 @@
+import unittest
+import os
+import sys
+import ctypes
+import random
+import shutil
+import subprocess
+import tempfile
+
+# Ensure tests/ directory is in sys.path
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+
+from dandy_env import DandyContext, DandyEnv
+
+ROOT_DIR = os.path.abspath(os.path.join(os.path.dirname(os.path.abspath(__file__)), ".."))
+
+GAMES = 37 # Not a whole number of vectors, so the last one is part empty
+TICKS = 1500
+
+
+def cpu_has_avx2():
+    try:
+        with open("/proc/cpuinfo") as f:
+            return " avx2" in f.read()
+    except OSError:
+        return False
+
+
+class LockstepEquivalenceBase:
+    """Steps the same games through dandy_step one at a time and through
+    the lockstep engine (bench/lockstep.c), and checks that every field of
+    every game matches after every tick."""
+
+    CFLAGS = []
+
+    @classmethod
+    def setUpClass(cls):
+        if shutil.which("gcc") is None:
+            raise unittest.SkipTest("gcc not found")
+        cls.build_dir = tempfile.mkdtemp(prefix="dandy_lockstep_")
+        lib_path = os.path.join(cls.build_dir, "liblockstep.so")
+        subprocess.run(
+            ["gcc", "-O2", "-fPIC", "-shared"] + cls.CFLAGS +
+            ["-Isrc", "-Ibench", "-o", lib_path,
+             "bench/lockstep.c", "src/levels.c", "bench/null_hal.c"],
+            cwd=ROOT_DIR, check=True)
+        lib = ctypes.CDLL(lib_path)
+        size = ctypes.c_uint16.in_dll(lib, "dandy_sizeof_context").value
+        if size != ctypes.sizeof(DandyContext):
+            raise RuntimeError(f"DandyContext is {size} bytes in C, {ctypes.sizeof(DandyContext)} in dandy_env")
+        ctx_p = ctypes.POINTER(DandyContext)
+        lib.dandy_init.argtypes = [ctx_p]
+        lib.dandy_seed.argtypes = [ctx_p, ctypes.c_uint16]
+        lib.dandy_load_level.argtypes = [ctx_p, ctypes.c_uint8]
+        lib.dandy_join_player.argtypes = [ctx_p, ctypes.c_uint8]
+        lib.dandy_step.argtypes = [ctx_p, ctypes.POINTER(ctypes.c_uint8)]
+        lib.dandy_lockstep_create.restype = ctypes.c_void_p
+        lib.dandy_lockstep_create.argtypes = [ctypes.c_uint32]
+        lib.dandy_lockstep_destroy.argtypes = [ctypes.c_void_p]
+        lib.dandy_lockstep_put.argtypes = [ctypes.c_void_p, ctypes.c_uint32, ctx_p]
+        lib.dandy_lockstep_get.argtypes = [ctypes.c_void_p, ctypes.c_uint32, ctx_p]
+        lib.dandy_lockstep_step.argtypes = [ctypes.c_void_p, ctypes.POINTER(ctypes.c_uint8)]
+        cls.lib = lib
+
+    @classmethod
+    def tearDownClass(cls):
+        shutil.rmtree(cls.build_dir, ignore_errors=True)
+
+    def make_games(self, rng):
+        """Varied starts: every level, 1-4 players, and some games set up to
+        reach the rare paths (stairs next to the player, keys, bombs)."""
+        games = []
+        for g in range(GAMES):
+            ctx = DandyContext()
+            self.lib.dandy_init(ctx)
+            self.lib.dandy_seed(ctx, g + 1)
+            ctx.current_level = g % 26
+            self.lib.dandy_load_level(ctx, ctx.current_level)
+            for p in range(1, 1 + g % 4):
+                self.lib.dandy_join_player(ctx, p)
+            for p in range(4):
+                ctx.player_keys[p] = rng.randrange(4)
+                ctx.player_bombs[p] = rng.randrange(3)
+            if g % 5 == 0:
+                x, y = ctx.player_x[0], ctx.player_y[0]
+                for nx, ny in ((x + 1, y), (x - 1, y), (x, y + 1), (x, y - 1)):
+                    pos = ny * DandyEnv.MAP_STRIDE + nx
+                    if ctx.map[pos] == DandyEnv.TILE_SPACE:
+                        ctx.map[pos] = DandyEnv.TILE_DOWN
+                        break
+            games.append(ctx)
+        return games
+
+    def assert_same(self, ref, got, game, tick):
+        if bytes(ref) == bytes(got):
+            return
+        # Field by field, so padding doesn't count and a failure says where
+        for name, _ in DandyContext._fields_:
+            a = getattr(ref, name)
+            b = getattr(got, name)
+            if name == "door_runs":
+                a = ctypes.cast(a, ctypes.c_void_p).value
+                b = ctypes.cast(b, ctypes.c_void_p).value
+            elif name == "entity_mask":
+                a = [list(row) for row in a]
+                b = [list(row) for row in b]
+            elif hasattr(a, "_length_"):
+                a = list(a)
+                b = list(b)
+            if a != b:
+                self.fail(f"game {game} tick {tick}: {name} differs")
+
+    def test_matches_dandy_step(self):
+        rng = random.Random(2024)
+        refs = self.make_games(rng)
+        ls = self.lib.dandy_lockstep_create(GAMES)
+        self.assertTrue(ls)
+        try:
+            for g, ctx in enumerate(refs):
+                self.lib.dandy_lockstep_put(ls, g, ctx)
+            held = [[0] * 4 for _ in range(GAMES)]
+            inputs = (ctypes.c_uint8 * (GAMES * 4))()
+            got = DandyContext()
+            level_changes = 0
+            game_overs = 0
+            for t in range(TICKS):
+                for g in range(GAMES):
+                    for p in range(4):
+                        if rng.random() < 0.06:
+                            held[g][p] = rng.choice([0, 1, 2, 4, 8, 5, 6, 9, 10, 16, 17, 18, 20, 24, 32, 48])
+                        inputs[g * 4 + p] = held[g][p]
+                for g, ctx in enumerate(refs):
+                    level = ctx.current_level
+                    joined = list(ctx.player_joined)
+                    self.lib.dandy_step(ctx, ctypes.cast(ctypes.byref(inputs, g * 4), ctypes.POINTER(ctypes.c_uint8)))
+                    if ctx.current_level != level:
+                        level_changes += 1
+                    if list(ctx.player_joined) != joined:
+                        game_overs += 1
+                self.lib.dandy_lockstep_step(ls, inputs)
+                for g, ctx in enumerate(refs):
+                    self.lib.dandy_lockstep_get(ls, g, got)
+                    self.assert_same(ctx, got, g, t)
+            # The run must have gone down the per-game paths
+            self.assertGreater(level_changes, 0)
+            self.assertGreater(game_overs, 0)
+        finally:
+            self.lib.dandy_lockstep_destroy(ls)
+
+
+@unittest.skipUnless(cpu_has_avx2(), "CPU has no AVX2")
+class TestLockstepAVX2(LockstepEquivalenceBase, unittest.TestCase):
+    CFLAGS = ["-mavx2"]
+
+
+class TestLockstepPlain(LockstepEquivalenceBase, unittest.TestCase):
+    CFLAGS = []
+
+
+if __name__ == "__main__":
+    unittest.main()
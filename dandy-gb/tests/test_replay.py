@@ -0,0 +1,245 @@
+import unittest
+import os
+import sys
+import ctypes
+import random
+import shutil
+import struct
+import subprocess
+import tempfile
+
+# Ensure tests/ directory is in sys.path
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+
+from dandy_env import DandyContext
+
+ROOT_DIR = os.path.abspath(os.path.join(os.path.dirname(os.path.abspath(__file__)), ".."))
+
+REPLAY_OK, REPLAY_BAD_FORMAT, REPLAY_DESYNC = 0, 1, 2
+RECORD_RUN, RECORD_JOIN, RECORD_HASH = 0, 1, 2
+
+
+# Mirror bench/replay.h
+class ReplayHeader(ctypes.Structure):
+    _fields_ = [
+        ("level", ctypes.c_uint8),
+        ("joined", ctypes.c_uint8),
+        ("seed", ctypes.c_uint16),
+        ("hash_interval", ctypes.c_uint16),
+        ("build_hash", ctypes.c_uint32),
+        ("ticks", ctypes.c_uint32),
+    ]
+
+
+class ReplayRecorder(ctypes.Structure):
+    _fields_ = [
+        ("data", ctypes.POINTER(ctypes.c_uint8)),
+        ("size", ctypes.c_size_t),
+        ("capacity", ctypes.c_size_t),
+        ("header", ReplayHeader),
+        ("held", ctypes.c_uint8 * 4),
+        ("run_changed", ctypes.c_uint8),
+        ("run_ticks", ctypes.c_uint32),
+        ("out_of_memory", ctypes.c_bool),
+    ]
+
+
+class ReplayResult(ctypes.Structure):
+    _fields_ = [
+        ("header", ReplayHeader),
+        ("ticks", ctypes.c_uint32),
+        ("hashes_checked", ctypes.c_uint32),
+        ("desync_tick", ctypes.c_uint32),
+        ("build_matches", ctypes.c_bool),
+    ]
+
+
+def read_varint(data, pos):
+    v, shift = 0, 0
+    while True:
+        b = data[pos]
+        pos += 1
+        v |= (b & 0x7F) << shift
+        shift += 7
+        if not b & 0x80:
+            return v, pos
+
+
+def decode_replay(data):
+    """Independent reading of the format in bench/replay.h: the header
+    fields and the input of every tick, with joins and hashes in place."""
+    magic, version, level, joined, _, seed, interval, build, ticks = struct.unpack_from("<4sBBBBHHII", data)
+    assert magic == b"DRPL" and version == 1
+    events = []
+    held = [0, 0, 0, 0]
+    pos = 20
+    while pos < len(data):
+        v, pos = read_varint(data, pos)
+        kind = v & 3
+        if kind == RECORD_RUN:
+            for p in range(4):
+                if v & (4 << p):
+                    held[p] = data[pos]
+                    pos += 1
+            events.extend([("tick", tuple(held))] * (v >> 6))
+        elif kind == RECORD_JOIN:
+            events.append(("join", v >> 2))
+        elif kind == RECORD_HASH:
+            events.append(("hash", struct.unpack_from("<I", data, pos)[0]))
+            pos += 4
+    return (level, joined, seed, interval, ticks), events
+
+
+class TestReplay(unittest.TestCase):
+    """Records games through bench/replay.c and checks that they play back
+    to the same state, that the format is what replay.h says, and that
+    playback notices a replay that no longer matches."""
+
+    @classmethod
+    def setUpClass(cls):
+        if shutil.which("gcc") is None:
+            raise unittest.SkipTest("gcc not found")
+        cls.build_dir = tempfile.mkdtemp(prefix="dandy_replay_")
+        lib_path = os.path.join(cls.build_dir, "libreplay.so")
+        subprocess.run(
+            ["gcc", "-O2", "-fPIC", "-shared", "-Isrc", "-o", lib_path,
+             "bench/replay.c", "src/dandy_core.c", "src/levels.c", "bench/null_hal.c"],
+            cwd=ROOT_DIR, check=True)
+        cls.exe = os.path.join(cls.build_dir, "replay")
+        subprocess.run(
+            ["gcc", "-O2", "-Isrc", "-o", cls.exe,
+             "bench/replay_main.c", "bench/replay.c", "src/dandy_core.c", "src/levels.c", "bench/null_hal.c"],
+            cwd=ROOT_DIR, check=True)
+        lib = ctypes.CDLL(lib_path)
+        ctx_p = ctypes.POINTER(DandyContext)
+        bytes_p = ctypes.POINTER(ctypes.c_uint8)
+        lib.dandy_step.argtypes = [ctx_p, bytes_p]
+        lib.dandy_join_player.argtypes = [ctx_p, ctypes.c_uint8]
+        lib.replay_state_hash.restype = ctypes.c_uint32
+        lib.replay_state_hash.argtypes = [ctx_p]
+        lib.replay_build_hash.restype = ctypes.c_uint32
+        lib.replay_record_begin.restype = ctypes.c_bool
+        lib.replay_record_begin.argtypes = [ctypes.POINTER(ReplayRecorder), ctx_p, ctypes.POINTER(ReplayHeader)]
+        lib.replay_record_tick.argtypes = [ctypes.POINTER(ReplayRecorder), ctx_p, bytes_p]
+        lib.replay_record_join.argtypes = [ctypes.POINTER(ReplayRecorder), ctypes.c_uint8]
+        lib.replay_record_end.restype = ctypes.c_bool
+        lib.replay_record_end.argtypes = [ctypes.POINTER(ReplayRecorder)]
+        lib.replay_record_free.argtypes = [ctypes.POINTER(ReplayRecorder)]
+        lib.replay_play.restype = ctypes.c_int
+        lib.replay_play.argtypes = [bytes_p, ctypes.c_size_t, ctx_p, ctypes.POINTER(ReplayResult)]
+        cls.lib = lib
+
+    @classmethod
+    def tearDownClass(cls):
+        shutil.rmtree(cls.build_dir, ignore_errors=True)
+
+    def record(self, level, players, seed, ticks, rng, joins=(), change_odds=0.05):
+        """Records a game with held random buttons; returns (replay bytes,
+        the final context, every tick's inputs)."""
+        ctx = DandyContext()
+        header = ReplayHeader(level=level, joined=(1 << players) - 1, seed=seed, hash_interval=60)
+        rec = ReplayRecorder()
+        self.assertTrue(self.lib.replay_record_begin(rec, ctx, header))
+        held = [0, 0, 0, 0]
+        inputs = (ctypes.c_uint8 * 4)()
+        played = []
+        for t in range(ticks):
+            for tick, p in joins:
+                if tick == t:
+                    self.lib.dandy_join_player(ctx, p)
+                    self.lib.replay_record_join(rec, p)
+            for p in range(4):
+                if rng.random() < change_odds:
+                    held[p] = rng.choice([0, 1, 2, 4, 8, 5, 6, 9, 10, 16, 17, 18, 20, 24, 32, 48])
+                inputs[p] = held[p]
+            played.append(tuple(held))
+            self.lib.dandy_step(ctx, inputs)
+            self.lib.replay_record_tick(rec, ctx, inputs)
+        self.assertTrue(self.lib.replay_record_end(rec))
+        data = bytes(ctypes.string_at(rec.data, rec.size))
+        self.lib.replay_record_free(rec)
+        return data, ctx, played
+
+    def play(self, data):
+        buf = (ctypes.c_uint8 * len(data)).from_buffer_copy(data)
+        ctx = DandyContext()
+        result = ReplayResult()
+        status = self.lib.replay_play(buf, len(data), ctx, result)
+        return status, result, ctx
+
+    def test_plays_back_to_the_same_state(self):
+        rng = random.Random(7)
+        for level, players, joins in ((0, 1, ((900, 2),)), (5, 2, ()), (13, 4, ()), (25, 1, ((1, 1), (2000, 3)))):
+            data, ref, _ = self.record(level, players, 0x1234 + level, 3000, rng, joins)
+            status, result, ctx = self.play(data)
+            self.assertEqual(status, REPLAY_OK, f"level {level}")
+            self.assertEqual(result.ticks, 3000)
+            self.assertEqual(result.hashes_checked, 50)
+            self.assertTrue(result.build_matches)
+            self.assertEqual(self.lib.replay_state_hash(ctx), self.lib.replay_state_hash(ref))
+            self.assertEqual(bytes(ctx.map), bytes(ref.map))
+            self.assertEqual(list(ctx.player_score), list(ref.player_score))
+            self.assertEqual(list(ctx.player_joined), list(ref.player_joined))
+
+    def test_format_matches_header_doc(self):
+        rng = random.Random(11)
+        data, ref, played = self.record(3, 2, 0xBEEF, 1000, rng, joins=((400, 3),))
+        (level, joined, seed, interval, ticks), events = decode_replay(data)
+        self.assertEqual((level, joined, seed, interval, ticks), (3, 3, 0xBEEF, 60, 1000))
+        self.assertEqual([e[1] for e in events if e[0] == "tick"], played)
+        # The join lands before tick 400, and a hash follows every 60th tick
+        self.assertEqual(events.index(("join", 3)), 400 + 400 // 60)
+        tick = 0
+        for kind, _ in events:
+            if kind == "tick":
+                tick += 1
+            elif kind == "hash":
+                self.assertEqual(tick % 60, 0)
+        self.assertEqual(sum(1 for e in events if e[0] == "hash"), 1000 // 60)
+
+    def test_held_buttons_are_cheap(self):
+        # An hour of one player changing buttons about twice a second
+        data, _, _ = self.record(0, 1, 1, 3600 * 60, random.Random(3), change_odds=1 / 30)
+        self.assertLess(len(data), 100 * 1024)
+        self.assertEqual(self.play(data)[0], REPLAY_OK)
+
+    def test_detects_desync(self):
+        data, _, _ = self.record(2, 1, 99, 600, random.Random(5))
+        # Start from another level: the first hash can't match
+        changed = bytearray(data)
+        changed[5] = 4
+        status, result, _ = self.play(bytes(changed))
+        self.assertEqual(status, REPLAY_DESYNC)
+        self.assertEqual(result.desync_tick, 60)
+        # A different build still plays, and says so
+        changed = bytearray(data)
+        changed[12] ^= 0xFF
+        status, result, _ = self.play(bytes(changed))
+        self.assertEqual(status, REPLAY_OK)
+        self.assertFalse(result.build_matches)
+
+    def test_rejects_bad_replays(self):
+        data, _, _ = self.record(1, 1, 5, 300, random.Random(9))
+        self.assertEqual(self.play(data[:-3])[0], REPLAY_BAD_FORMAT)
+        self.assertEqual(self.play(b"DRPX" + data[4:])[0], REPLAY_BAD_FORMAT)
+        self.assertEqual(self.play(data[:10])[0], REPLAY_BAD_FORMAT)
+
+    def test_cli_round_trip(self):
+        path = os.path.join(self.build_dir, "cli.drp")
+        subprocess.run([self.exe, "record", "-l", "7", "-p", "2", "-k", "5000", "-j", "100:2", path],
+                       cwd=ROOT_DIR, check=True, capture_output=True)
+        out = subprocess.run([self.exe, "play", "-n", "2", path], cwd=ROOT_DIR, check=True,
+                             capture_output=True, text=True).stdout
+        self.assertIn("OK: 83 hashes matched", out)
+        with open(path, "rb") as f:
+            data = bytearray(f.read())
+        data[5] = 8
+        with open(path, "wb") as f:
+            f.write(data)
+        run = subprocess.run([self.exe, "play", path], cwd=ROOT_DIR, capture_output=True, text=True)
+        self.assertEqual(run.returncode, 1)
+        self.assertIn("DESYNC", run.stdout)
+
+
+if __name__ == "__main__":
+    unittest.main()
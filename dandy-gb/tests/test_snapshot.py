@@ -0,0 +1,246 @@
+import unittest
+import ctypes
+import os
+import sys
+import random
+import time
+
+# Ensure tests/ directory is in sys.path
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+
+from dandy_env import DandyEnv
+
+BITSERIAL_LIB_PATH = os.path.abspath(
+    os.path.join(os.path.dirname(os.path.abspath(__file__)), "../libdandy_test_bitserial.so"))
+
+# Offsets into DandySnapshot (src/dandy_core.h)
+SNAPSHOT_CURRENT_LEVEL = 256 + 2 + 8 + 8
+SNAPSHOT_MONSTER_ROTOR = SNAPSHOT_CURRENT_LEVEL + 1
+SNAPSHOT_LOCAL_PLAYER = SNAPSHOT_CURRENT_LEVEL + 2
+SNAPSHOT_DOOR_LEVEL = SNAPSHOT_CURRENT_LEVEL + 3
+SNAPSHOT_PLAYER_JOINED = SNAPSHOT_CURRENT_LEVEL + 4
+SNAPSHOT_PLAYER_X = SNAPSHOT_CURRENT_LEVEL + 8
+SNAPSHOT_PLAYER_Y = SNAPSHOT_CURRENT_LEVEL + 12
+SNAPSHOT_PLAYER_DIR = SNAPSHOT_CURRENT_LEVEL + 24
+SNAPSHOT_ARROW_X = SNAPSHOT_CURRENT_LEVEL + 32
+SNAPSHOT_ARROW_Y = SNAPSHOT_CURRENT_LEVEL + 36
+SNAPSHOT_ARROW_DIR = SNAPSHOT_CURRENT_LEVEL + 40
+SNAPSHOT_MAP = SNAPSHOT_CURRENT_LEVEL + 48
+NO_DOORS = 0xFF
+
+
+def random_inputs(rng, ticks):
+    """Buttons held for a while at a time, as a player would."""
+    held = [0, 0, 0, 0]
+    inputs = []
+    for _ in range(ticks):
+        for p in range(4):
+            if rng.random() < 0.05:
+                held[p] = rng.choice([0, 1, 2, 4, 8, 5, 6, 9, 10, 16, 17, 18, 20, 24, 32])
+        inputs.append(tuple(held))
+    return inputs
+
+
+class TestSnapshot(unittest.TestCase):
+    """dandy_snapshot/dandy_restore and the delta-encoded form: a restored
+    game must go on exactly as the game it was taken from."""
+
+    def setUp(self):
+        self.env = DandyEnv()
+        self.other = None
+
+    def tearDown(self):
+        for env in (self.env, self.other):
+            if env is not None:
+                env.close()
+
+    def start(self, env, level, players=1, seed=0x1234):
+        env.init()
+        env.seed(seed)
+        env.current_level = level
+        env.load_level(level)
+        for p in range(1, players):
+            env.join_player(p)
+
+    def play(self, env, inputs):
+        for buttons in inputs:
+            env.step(buttons)
+
+    def test_layout(self):
+        self.assertEqual(self.env.snapshot_size, 2122)
+        self.start(self.env, 4)
+        snap = self.env.snapshot()
+        self.assertEqual(len(snap), self.env.snapshot_size)
+        self.assertEqual(snap[SNAPSHOT_CURRENT_LEVEL], 4)
+        self.assertEqual(snap[SNAPSHOT_DOOR_LEVEL], 4)
+        # The map is the 60x30 level, row by row
+        self.assertEqual(list(snap[SNAPSHOT_MAP:]), self.env.dandy_map)
+
+    def test_restore_goes_on_as_before(self):
+        rng = random.Random(1)
+        for level, players in ((0, 1), (3, 2), (12, 4), (25, 1)):
+            self.start(self.env, level, players)
+            self.play(self.env, random_inputs(rng, 300))
+            snap = self.env.snapshot()
+            later = random_inputs(rng, 1500)
+            self.play(self.env, later)
+            expected = self.env.snapshot()
+            expected_map = bytes(self.env._ctx.map)
+
+            self.env.restore(snap)
+            self.assertTrue(self.env.is_dirty)
+            self.assertEqual(self.env.snapshot(), snap, f"level {level}")
+            self.play(self.env, later)
+            self.assertEqual(self.env.snapshot(), expected, f"level {level}")
+            # Padding included
+            self.assertEqual(bytes(self.env._ctx.map), expected_map)
+
+    def test_restore_into_another_game(self):
+        rng = random.Random(2)
+        self.other = DandyEnv()
+        self.start(self.env, 7, 2)
+        self.play(self.env, random_inputs(rng, 600))
+        snap = self.env.snapshot()
+        doors = bool(self.env._ctx.door_runs)
+
+        # Another game, on another level
+        self.start(self.other, 19, 4, seed=99)
+        self.play(self.other, random_inputs(rng, 200))
+        self.other.restore(snap)
+        self.assertEqual(bool(self.other._ctx.door_runs), doors)
+
+        later = random_inputs(rng, 1200)
+        self.play(self.env, later)
+        self.play(self.other, later)
+        self.assertEqual(self.other.snapshot(), self.env.snapshot())
+
+    def test_restore_keeps_door_groups(self):
+        self.start(self.env, 9)
+        doors = self.env._ctx.door_runs
+        snap = self.env.snapshot()
+        self.env.rebuild_entities()
+        self.assertFalse(self.env._ctx.door_runs)
+        self.env.restore(snap)
+        self.assertEqual(ctypes_address(self.env._ctx.door_runs), ctypes_address(doors))
+
+        # A game that stopped using them keeps not using them
+        self.env.rebuild_entities()
+        snap = self.env.snapshot()
+        self.assertEqual(snap[SNAPSHOT_DOOR_LEVEL], NO_DOORS)
+        self.env.load_level(9)
+        self.env.restore(snap)
+        self.assertFalse(self.env._ctx.door_runs)
+
+    def test_delta_round_trip(self):
+        if not self.env.has_snapshot_delta:
+            self.skipTest("library has no snapshot deltas")
+        rng = random.Random(3)
+        for level in (0, 5, 13, 24):
+            self.start(self.env, level, 2)
+            self.play(self.env, random_inputs(rng, 400))
+            snap = self.env.snapshot()
+            delta = self.env.snapshot_delta()
+            # The fields, then a few runs for the players, monsters and pickups
+            self.assertLess(len(delta), 700, f"level {level}")
+
+            self.play(self.env, random_inputs(rng, 100))
+            self.assertTrue(self.env.restore_delta(delta))
+            self.assertEqual(self.env.snapshot(), snap, f"level {level}")
+
+    def test_delta_of_rewritten_map(self):
+        if not self.env.has_snapshot_delta:
+            self.skipTest("library has no snapshot deltas")
+        self.start(self.env, 2)
+        # Every other cell changed: the most runs a delta can have
+        level_map = self.env.dandy_map
+        self.env.dandy_map = [t if i % 2 else (t ^ 1) & 7 for i, t in enumerate(level_map)]
+        self.env.rebuild_entities()
+        snap = self.env.snapshot()
+        delta = self.env.snapshot_delta()
+        self.assertLessEqual(len(delta), self.env.snapshot_size + self.env.MAP_SIZE)
+
+        self.env.load_level(2)
+        self.assertTrue(self.env.restore_delta(delta))
+        self.assertEqual(self.env.snapshot(), snap)
+
+    def test_rejects_malformed_delta(self):
+        if not self.env.has_snapshot_delta:
+            self.skipTest("library has no snapshot deltas")
+        self.start(self.env, 6)
+        self.play(self.env, random_inputs(random.Random(4), 300))
+        delta = self.env.snapshot_delta()
+        self.assertGreater(len(delta), SNAPSHOT_MAP)
+        self.env.load_level(8)
+        before = self.env.snapshot()
+
+        def changed(*edits):
+            data = bytearray(delta)
+            for offset, value in edits:
+                data[offset] = value & 0xFF
+            return bytes(data)
+
+        past_the_end = delta[:SNAPSHOT_MAP] + bytes([0x8E, 0x0E, 1, 0])  # Skip 1806 cells
+        empty_run = delta[:SNAPSHOT_MAP] + bytes([5, 0])
+        bad = [
+            delta[:SNAPSHOT_MAP - 1], delta[:-1], past_the_end, empty_run,
+            changed((SNAPSHOT_CURRENT_LEVEL, 200)),
+            changed((SNAPSHOT_MONSTER_ROTOR, 16)),
+            changed((SNAPSHOT_LOCAL_PLAYER, 4)),
+            changed((SNAPSHOT_DOOR_LEVEL, 26)),
+            changed((SNAPSHOT_PLAYER_JOINED + 1, 2)),
+            changed((SNAPSHOT_PLAYER_X, 60)),
+            changed((SNAPSHOT_PLAYER_Y + 3, 30)),
+            changed((SNAPSHOT_PLAYER_DIR, 8)),
+            changed((SNAPSHOT_PLAYER_DIR + 2, -1)),
+            # An arrow far off the map, which move_arrows would index with
+            changed((SNAPSHOT_ARROW_X, 250), (SNAPSHOT_ARROW_Y, 250), (SNAPSHOT_ARROW_DIR, 3)),
+            changed((SNAPSHOT_ARROW_Y + 1, 32)),
+            changed((SNAPSHOT_ARROW_DIR + 2, -2)),
+            changed((5 * 16 + 3 * 2 + 1, 0x80)),  # entity_mask[5][3] bit 15
+        ]
+        for i, data in enumerate(bad):
+            self.assertFalse(self.env.restore_delta(data), f"case {i}")
+            self.assertEqual(self.env.snapshot(), before)
+        # The edges themselves are fine
+        edge = changed((SNAPSHOT_PLAYER_X, 59), (SNAPSHOT_ARROW_X + 1, 63), (SNAPSHOT_ARROW_DIR + 3, -1))
+        self.assertTrue(self.env.restore_delta(edge))
+
+    def test_restore_is_cheap(self):
+        # Thousands a second, even through ctypes
+        self.start(self.env, 11, 2)
+        self.play(self.env, random_inputs(random.Random(5), 300))
+        snap = self.env.snapshot()
+        timed = [("restore", lambda: self.env.restore(snap))]
+        if self.env.has_snapshot_delta:
+            delta = self.env.snapshot_delta()
+            timed.append(("restore_delta", lambda: self.env.restore_delta(delta)))
+        for name, restore in timed:
+            start = time.perf_counter()
+            for _ in range(5000):
+                restore()
+            self.assertLess(time.perf_counter() - start, 1.0, name)
+        self.assertEqual(self.env.snapshot(), snap)
+
+    def test_single_context_build(self):
+        if not os.path.exists(BITSERIAL_LIB_PATH):
+            self.skipTest("libdandy_test_bitserial.so not built; run 'make test_lib'")
+        self.other = DandyEnv(lib_path=BITSERIAL_LIB_PATH)
+        self.assertFalse(self.other.has_snapshot_delta)
+        self.assertEqual(self.other.snapshot_size, self.env.snapshot_size)
+        rng = random.Random(6)
+        self.start(self.env, 14, 3)
+        self.play(self.env, random_inputs(rng, 500))
+        # Snapshots move between the two builds unchanged
+        self.other.restore(self.env.snapshot())
+        later = random_inputs(rng, 1000)
+        self.play(self.env, later)
+        self.play(self.other, later)
+        self.assertEqual(self.other.snapshot(), self.env.snapshot())
+
+
+def ctypes_address(pointer):
+    return ctypes.cast(pointer, ctypes.c_void_p).value
+
+
+if __name__ == "__main__":
+    unittest.main()
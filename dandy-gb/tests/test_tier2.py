@@ -1,4 +1,5 @@
 import unittest
+import ctypes
 import os
 import sys
 
@@ -415,7 +416,7 @@ class TestTier2(unittest.TestCase):
     # =========================================================================
 
     def test_f04_t2_door_flood_fill_stack_overflow(self):
-        """F-04: Contiguous door network of 625 door tiles (25x25 block). Unlocking clears a portion and leaves some doors locked due to FLOOD_STACK_SIZE=64 limit."""
+        """F-04: Contiguous door network of 625 door tiles (25x25 block). Unlocking clears all of it, even though the flood fill stack only holds 64."""
         self.helper_setup_clean_map(10, 1)
         self.env.set_player_keys(0, 1)
         
@@ -439,13 +440,126 @@ class TestTier2(unittest.TestCase):
                 if self.get_tile(x, y) == self.env.TILE_DOOR:
                     doors_left += 1
                     
-        # Since the total doors was 625, and the stack size is 64, we expect some doors to remain locked!
-        self.assertEqual(doors_left, 418)
+        # Cells that didn't fit on the stack are picked up by a later pass
+        self.assertEqual(doors_left, 0)
 
         self.env.draw_viewport(0)
         sounds = self.env.get_sounds()
         self.assertIn(self.env.SOUND_KEY, sounds)
 
+    def door_groups(self):
+        """The 8-way connected groups of doors on the current map, as sets of (x, y)."""
+        m = self.env.dandy_map
+        seen = set()
+        groups = []
+        for y in range(self.env.MAP_HEIGHT):
+            for x in range(self.env.MAP_WIDTH):
+                if m[y * 60 + x] != self.env.TILE_DOOR or (x, y) in seen:
+                    continue
+                group = set()
+                stack = [(x, y)]
+                seen.add((x, y))
+                while stack:
+                    cx, cy = stack.pop()
+                    group.add((cx, cy))
+                    for dy in (-1, 0, 1):
+                        for dx in (-1, 0, 1):
+                            nx, ny = cx + dx, cy + dy
+                            if (0 <= nx < 60 and 0 <= ny < 30 and (nx, ny) not in seen
+                                    and m[ny * 60 + nx] == self.env.TILE_DOOR):
+                                seen.add((nx, ny))
+                                stack.append((nx, ny))
+                groups.append(group)
+        return groups
+
+    def level_info(self):
+        """dandy_level_info from levels.c, bound with ctypes."""
+        class DoorRun(ctypes.Structure):
+            _fields_ = [("pos", ctypes.c_uint16), ("len", ctypes.c_uint8)]
+
+        class LevelInfo(ctypes.Structure):
+            _fields_ = [("level", ctypes.c_void_p), ("start_pos", ctypes.c_uint16),
+                        ("monsters", ctypes.c_uint16), ("generators", ctypes.c_uint16),
+                        ("keys", ctypes.c_uint16), ("doors", ctypes.c_uint16),
+                        ("door_runs", ctypes.POINTER(DoorRun))]
+
+        return (LevelInfo * self.env.num_levels).in_dll(self.env._lib, "dandy_level_info")
+
+    def test_f04_t2_rom_level_info_matches_levels(self):
+        """F-04: The start and tile counts levels.c ships for each level match the decoded level."""
+        infos = self.level_info()
+        levels = (ctypes.c_void_p * self.env.num_levels).in_dll(self.env._lib, "dandy_levels")
+        for level in range(self.env.num_levels):
+            info = infos[level]
+            self.assertEqual(info.level, levels[level])
+            # With nobody joined, no player tile hides part of the level
+            self.env.set_player_joined(0, False)
+            self.env.load_level(level)
+            # Player 0 still gets a spawn point, just above the up staircase
+            start_x, start_y = info.start_pos & 63, info.start_pos >> 6
+            self.assertEqual((self.env.get_player_x(0), self.env.get_player_y(0)), (start_x, start_y - 1))
+            m = self.env.dandy_map
+            self.assertEqual(m.index(self.env.TILE_UP), start_y * 60 + start_x, f"level {level}")
+            self.assertEqual(info.monsters, sum(m.count(t) for t in (9, 10, 11)), f"level {level}")
+            self.assertEqual(info.generators, sum(m.count(t) for t in (13, 14, 15)), f"level {level}")
+            self.assertEqual(info.keys, m.count(self.env.TILE_KEY), f"level {level}")
+            self.assertEqual(info.doors, m.count(self.env.TILE_DOOR), f"level {level}")
+
+    def test_f04_t2_rom_door_tables_match_levels(self):
+        """F-04: The door groups levels.c ships for each level are exactly the decoded level's door groups."""
+        infos = self.level_info()
+        for level in range(self.env.num_levels):
+            self.env.load_level(level)
+            rom_groups = []
+            i = 0
+            runs = infos[level].door_runs
+            while runs[i].len:
+                group = set()
+                while runs[i].len:
+                    x, y = runs[i].pos & 63, runs[i].pos >> 6
+                    group.update((x + n, y) for n in range(runs[i].len))
+                    i += 1
+                rom_groups.append(group)
+                i += 1
+            self.assertEqual(sorted(map(sorted, rom_groups)), sorted(map(sorted, self.door_groups())),
+                             f"level {level}")
+
+    def test_f04_t2_rom_door_table_opens_whole_group(self):
+        """F-04: On a shipped level, unlocking a door clears its whole group and no other door."""
+        dirs = [(self.env.BUTTON_LEFT, 1, 0), (self.env.BUTTON_RIGHT, -1, 0),
+                (self.env.BUTTON_UP, 0, 1), (self.env.BUTTON_DOWN, 0, -1)]
+        opened = 0
+        for level in range(self.env.num_levels):
+            self.env.load_level(level)
+            groups = self.door_groups()
+            start = None
+            for group in sorted(groups, key=len, reverse=True):
+                # A space next to the group to step in from
+                start = next(((x + dx, y + dy, button) for x, y in sorted(group)
+                              for button, dx, dy in dirs
+                              if self.get_tile(x + dx, y + dy) == self.env.TILE_SPACE), None)
+                if start is not None:
+                    break
+            if start is None:
+                continue
+            sx, sy, button = start
+            # Poke the player in without the dandy_map setter, which would make
+            # the core stop trusting the level's ROM door table
+            self.env._dandy_map[sy * 64 + sx] = self.env.TILE_PLAYER1
+            self.env.set_player_position(0, sx, sy)
+            self.env.set_player_move_timer(0, 0)
+            self.env.set_player_keys(0, 1)
+            self.env.step([button, 0, 0, 0])
+
+            self.assertEqual(self.env.get_player_keys(0), 0, f"level {level}")
+            for x, y in group:
+                self.assertNotEqual(self.get_tile(x, y), self.env.TILE_DOOR, f"level {level} ({x}, {y})")
+            others = [g for g in groups if g is not group]
+            self.assertEqual(sorted(map(sorted, self.door_groups())), sorted(map(sorted, others)),
+                             f"level {level}")
+            opened += 1
+        self.assertGreater(opened, 0)
+
     def test_f04_t2_door_flood_fill_circular(self):
         """F-04: A circular ring of doors is completely cleared by a single unlock without infinite looping."""
         self.helper_setup_clean_map(10, 10)
@@ -910,7 +1024,7 @@ class TestTier2(unittest.TestCase):
         self.assertTrue(any(s['tile_id'] == self.env.TILE_MONSTER1 for s in sprites.values()))
 
     def test_f08_t2_generator_spawn_wrap_around_x(self):
-        """F-08: Generator at x=59 (right edge) spawning Right wraps around to x=0 of the next row."""
+        """F-08: Generator at x=59 (right edge) spawning Right hits the padding wall instead of wrapping to the next row."""
         self.helper_setup_clean_map(59, 10)
         # Rotor index for (59, 10): (10%4)*4 + (59%4) = 2*4 + 3 = 11.
         self.set_tile(59, 10, self.env.TILE_GENERATOR1)
@@ -923,11 +1037,12 @@ class TestTier2(unittest.TestCase):
         
         # Step 1: Tick rotor to 11.
         # LFSR becomes 0xE270. Spawn dir is Up (blocked).
-        # Tries Right. Target is (60, 10).
-        # Spawns at (0, 11) because of row-wrapping!
+        # Tries Right. Target is (60, 10), a padding wall in the 64-wide map.
+        # Tries Down and spawns at (59, 11); nothing wraps to (0, 11).
         self.env.step([0, 0, 0, 0])
         
-        self.assertEqual(self.get_tile(0, 11), self.env.TILE_MONSTER1)
+        self.assertEqual(self.get_tile(59, 11), self.env.TILE_MONSTER1)
+        self.assertEqual(self.get_tile(0, 11), self.env.TILE_SPACE)
 
         self.env.draw_viewport(0)
         self.assertEqual(self.env.mock_get_sound_count(), 0)
@@ -297,5 +297,24 @@ class TestTier3(unittest.TestCase):
         sounds = self.env.get_sounds()
         self.assertIn(self.env.SOUND_WARP, sounds)
 
+    def test_f05_f07_t3_arrowed_heart_monster_ticks_same_step(self):
+        """Tier 3: An arrow turns a heart into Monster 3, which joins the active monster set at once and attacks on its rotor phase in the same tick."""
+        self.helper_setup_clean_map(10, 10)
+        self.env.set_player_dir(0, 2)  # Facing Right
+        
+        # Heart at (11, 10). Rotor index: (10%4)*4 + (11%4) = 2*4 + 3 = 11.
+        self.set_tile(11, 10, self.env.TILE_HEART)
+        self.env.monster_rotor = 10
+        
+        # Action: Fire arrow
+        self.env.step([self.env.BUTTON_FIRE, 0, 0, 0])
+        
+        # Assert Globals:
+        # The arrow hits the heart, which becomes Monster 3. move_monsters then
+        # visits phase 11, finds the new monster and it attacks the player for 30.
+        self.assertEqual(self.env.get_arrow_dir(0), -1)
+        self.assertEqual(self.get_tile(11, 10), self.env.TILE_SPACE)
+        self.assertEqual(self.env.get_player_health(0), 70)
+
 if __name__ == '__main__':
     unittest.main()
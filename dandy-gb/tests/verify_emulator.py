@@ -3,6 +3,8 @@ import re
 import unittest
 from pyboy import PyBoy
 
+from dandy_env import gb_context_address
+
 class TestEmulator(unittest.TestCase):
     @classmethod
     def setUpClass(cls):
@@ -21,18 +23,18 @@ class TestEmulator(unittest.TestCase):
         # Parse variable addresses from dandy.map
         raw_symbols = cls.parse_map_symbols(cls.map_path)
         
-        # Resolve symbols taking GBDK's 9-character truncation into account
         cls.symbols = {}
-        required_symbols = [
-            "_current_level", "_player_joined", "_player_x", 
-            "_player_y", "_player_health", "_player_score",
-            "_player_bombs", "_player_keys", "_dandy_map"
-        ]
-        for sym in required_symbols:
-            truncated = sym[:9]
-            if truncated not in raw_symbols:
-                raise KeyError(f"Required symbol '{sym}' (truncated: '{truncated}') not found in linker map file.")
-            cls.symbols[sym] = raw_symbols[truncated]
+        # The game state lives in one DandyContext, _dandy_ctx; fields are
+        # offsets into it. GBDK truncates map symbols to 9 characters.
+        truncated = "_dandy_ctx"[:9]
+        if truncated not in raw_symbols:
+            raise KeyError(f"Required symbol '_dandy_ctx' (truncated: '{truncated}') not found in linker map file.")
+        ctx_addr = raw_symbols[truncated]
+        for field in ("current_level", "player_joined", "player_x",
+                      "player_y", "player_health", "player_score",
+                      "player_bombs", "player_keys"):
+            cls.symbols["_" + field] = gb_context_address(ctx_addr, field)
+        cls.symbols["_dandy_map"] = gb_context_address(ctx_addr, "map")
 
     @classmethod
     def parse_map_symbols(cls, map_path):
@@ -89,11 +91,11 @@ class TestEmulator(unittest.TestCase):
         start_y = self.pyboy.memory[p1_y_addr]
         
         # Read the tiles surrounding the player in the 60x30 WRAM map to find an empty direction
-        # Each row is 60 bytes wide.
-        idx_up = (start_y - 1) * 60 + start_x
-        idx_down = (start_y + 1) * 60 + start_x
-        idx_left = start_y * 60 + (start_x - 1)
-        idx_right = start_y * 60 + (start_x + 1)
+        # Each row is 64 bytes apart (60 tiles plus wall padding).
+        idx_up = (start_y - 1) * 64 + start_x
+        idx_down = (start_y + 1) * 64 + start_x
+        idx_left = start_y * 64 + (start_x - 1)
+        idx_right = start_y * 64 + (start_x + 1)
         
         tile_up = self.pyboy.memory[map_addr + idx_up]
         tile_down = self.pyboy.memory[map_addr + idx_down]
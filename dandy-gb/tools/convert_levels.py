@@ -57,6 +57,67 @@ def pack_bits_to_bytes(bits):
         packed_bytes.append(byte_val)
     return packed_bytes
 
+# --- Door Groups ---
+TILE_DOOR = ENCODING.index("D")
+MAP_WIDTH_SHIFT = 6  # dandy_map is 64 wide, so a map position is (y << 6) | x
+
+def find_door_groups(tile_ids):
+    """
+    Finds the 8-way connected groups of door tiles on the decoded map
+    (the border is always wall there). Returns a list of groups, in order of
+    their first cell, each a row-major list of (x, y, length) runs.
+    """
+    def is_door(x, y):
+        return 1 <= x <= 58 and 1 <= y <= 28 and tile_ids[y * 60 + x] == TILE_DOOR
+
+    seen = set()
+    groups = []
+    for y in range(1, 29):
+        for x in range(1, 59):
+            if not is_door(x, y) or (x, y) in seen:
+                continue
+            cells = []
+            stack = [(x, y)]
+            seen.add((x, y))
+            while stack:
+                cx, cy = stack.pop()
+                cells.append((cx, cy))
+                for dy in (-1, 0, 1):
+                    for dx in (-1, 0, 1):
+                        n = (cx + dx, cy + dy)
+                        if n not in seen and is_door(*n):
+                            seen.add(n)
+                            stack.append(n)
+            runs = []
+            for cx, cy in sorted(cells, key=lambda c: (c[1], c[0])):
+                if runs and runs[-1][1] == cy and runs[-1][0] + runs[-1][2] == cx:
+                    runs[-1] = (runs[-1][0], cy, runs[-1][2] + 1)
+                else:
+                    runs.append((cx, cy, 1))
+            groups.append(runs)
+    return groups
+
+# --- Level Metadata ---
+TILE_UP = ENCODING.index("u")
+COUNTED_TILES = {
+    "monsters": [ENCODING.index(c) for c in "123"],
+    "generators": [ENCODING.index(c) for c in "nop"],
+    "keys": [ENCODING.index("K")],
+    "doors": [TILE_DOOR],
+}
+
+def find_start(tile_ids):
+    """The map position of the first TILE_UP in row-major order, as the engine would find it."""
+    for y in range(1, 29):
+        for x in range(1, 59):
+            if tile_ids[y * 60 + x] == TILE_UP:
+                return (y << MAP_WIDTH_SHIFT) | x
+    raise ValueError("Level has no up staircase")
+
+def count_tiles(tile_ids):
+    inner = elide_edge_walls(tile_ids)
+    return {name: sum(inner.count(t) for t in tiles) for name, tiles in COUNTED_TILES.items()}
+
 # --- Main Compressor entry point ---
 def compress_level(tile_ids):
     """
@@ -104,6 +165,28 @@ def main():
         "extern const uint8_t* const dandy_levels[DANDY_NUM_LEVELS];",
         "extern const uint16_t dandy_level_sizes[DANDY_NUM_LEVELS];",
         "",
+        "/* A row of len door tiles starting at dandy_map[pos], pos = (y << 6) | x */",
+        "typedef struct {",
+        "    uint16_t pos;",
+        "    uint8_t len;",
+        "} DandyDoorRun;",
+        "",
+        "/* What the engine would otherwise have to scan each level for. door_runs",
+        "   lists the groups of 8-way connected doors run by run: a run with len 0",
+        "   ends a group, and an empty group ends the list. level is the stream the",
+        "   rest was worked out from. */",
+        "typedef struct {",
+        "    const uint8_t* level;",
+        "    uint16_t start_pos;  /* First TILE_UP, (y << 6) | x */",
+        "    uint16_t monsters;",
+        "    uint16_t generators;",
+        "    uint16_t keys;",
+        "    uint16_t doors;",
+        "    const DandyDoorRun* door_runs;",
+        "} DandyLevelInfo;",
+        "",
+        "extern const DandyLevelInfo dandy_level_info[DANDY_NUM_LEVELS];",
+        "",
         "#endif /* DANDY_LEVELS_H */"
     ]
 
@@ -122,6 +205,7 @@ def main():
 
     total_uncompressed = 0
     total_compressed = 0
+    level_infos = []
 
     for l_idx, lvl in enumerate(levels):
         flat_tiles = []
@@ -153,6 +237,23 @@ def main():
         c_content.append("};")
         c_content.append("")
 
+        door_groups = find_door_groups(flat_tiles)
+        door_runs = sum(len(g) for g in door_groups)
+        c_content.append(f"/* Level {l_idx} doors (groups: {len(door_groups)}, runs: {door_runs}) */")
+        c_content.append(f"const DandyDoorRun dandy_level_{l_idx}_doors[] = {{")
+        for runs in door_groups:
+            run_strs = [f"{{0x{(y << MAP_WIDTH_SHIFT) | x:03X}, {n}}}" for x, y, n in runs]
+            c_content.append("    " + ", ".join(run_strs + ["{0, 0},"]))
+        c_content.append("    {0, 0}")
+        c_content.append("};")
+        c_content.append("")
+
+        counts = count_tiles(flat_tiles)
+        level_infos.append(
+            f"    {{ dandy_level_{l_idx}, 0x{find_start(flat_tiles):03X}, "
+            + ", ".join(str(counts[name]) for name in COUNTED_TILES)
+            + f", dandy_level_{l_idx}_doors }}")
+
     c_content.append("/* Pointer array to all compressed levels in ROM */")
     c_content.append("const uint8_t* const dandy_levels[DANDY_NUM_LEVELS] = {")
     level_pointers = [f"    dandy_level_{i}" for i in range(len(levels))]
@@ -165,6 +266,11 @@ def main():
     c_content.append(",\n".join(level_sizes))
     c_content.append("};")
     c_content.append("")
+    c_content.append("/* Metadata of each level: stream, start, monsters, generators, keys, doors, door runs */")
+    c_content.append("const DandyLevelInfo dandy_level_info[DANDY_NUM_LEVELS] = {")
+    c_content.append(",\n".join(level_infos))
+    c_content.append("};")
+    c_content.append("")
 
     overall_saving = (1.0 - (total_compressed / total_uncompressed)) * 100
     print(f"--------------------------------------------------")
@@ -11,5 +11,6 @@
 
 @interface DGame : NSObject
 @property Level level;
+@property LevelDoors* doors;
 
 @end
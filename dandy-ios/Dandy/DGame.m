@@ -22,8 +22,10 @@
     return nil;
 
     _level = LevelCreate();
+    _doors = LevelDoorsCreate();
 
     LevelRead(_level, _levelIndex);
+    LevelFindDoors(_level, _doors);
     // NSLog(@"Level %d:\n%@", _levelIndex, LevelToString(_level));
   }
   return self;
@@ -31,6 +33,7 @@
 
 - (void)dealloc {
   LevelDelete(_level);
+  LevelDoorsDelete(_doors);
 }
 
 @end
@@ -69,7 +69,24 @@ void LevelRead(Level level, int index);
 
 bool LevelFind(Level level, Cell cell, int* pX, int* pY);
 
-void LevelOpenDoor(Level level, int x, int y);
+// The 8-way connected groups of doors in a level, found once at load time.
+// Doors are never added during play and a group always opens all at once,
+// so the groups stay right for the rest of the level.
+typedef struct {
+  short groupOf[LEVEL_WIDTH * LEVEL_HEIGHT];  // Group of each cell, or -1
+  short groupStart[LEVEL_WIDTH * LEVEL_HEIGHT + 1];
+  short cells[LEVEL_WIDTH * LEVEL_HEIGHT];  // Group g is cells[start[g]..start[g+1])
+  int groupCount;
+} LevelDoors;
+
+LevelDoors* LevelDoorsCreate();
+
+void LevelDoorsDelete(LevelDoors* doors);
+
+void LevelFindDoors(Level level, LevelDoors* doors);
+
+// Opens every door in the group containing x,y.
+void LevelOpenDoor(Level level, const LevelDoors* doors, int x, int y);
 
 void LevelDelete(Level level);
 
@@ -7,6 +7,7 @@
 //
 
 #import "Level.h"
+#import "LevelUnpack.h"
 #import "math.h"
 
 Level LevelCreate() {
@@ -24,15 +25,11 @@ void LevelRead(Level level, int index) {
   NSString* filePath =
       [[NSBundle mainBundle] pathForResource:resourceName ofType:@"bin"];
   NSData* data = [NSData dataWithContentsOfFile:filePath];
-  const Byte* packedLevelData = [data bytes];
-  Cell* dest = level;
-  for (int y = 0; y < LEVEL_HEIGHT; y++) {
-    for (int x = 0; x < LEVEL_WIDTH; x += 2) {
-      Byte d = *packedLevelData++;
-      *dest++ = (Cell)(d & 15);
-      *dest++ = (Cell)(d >> 4);
-    }
+  if ([data length] < LEVEL_WIDTH * LEVEL_HEIGHT / 2) {
+    return;
   }
+  // Cell is a byte-sized enum, so the level can be unpacked in place.
+  LevelUnpack((unsigned char*)level, [data bytes], LEVEL_HEIGHT);
 }
 
 bool LevelFind(Level level, Cell cell, int* pX, int* pY) {
@@ -52,19 +49,108 @@ bool LevelFind(Level level, Cell cell, int* pX, int* pY) {
   return false;
 }
 
-void LevelOpenDoor(Level level, int x, int y) {
-  // Flood fill from this coord
-  int index = x + y * LEVEL_WIDTH;
-  if (level[index] == kDoor) {
-    level[index] = kSpace;
-    for (int dy = -1; dy <= 1; dy++) {
-      for (int dx = -1; dx <= 1; dx++) {
-        if (dx != 0 || dy != 0) {
-          LevelOpenDoor(level, x + dx, y + dy);
+LevelDoors* LevelDoorsCreate() {
+  return (LevelDoors*)malloc(sizeof(LevelDoors));
+}
+
+void LevelDoorsDelete(LevelDoors* doors) {
+  if (doors) {
+    free(doors);
+  }
+}
+
+static int DoorRoot(short* parent, int i) {
+  while (parent[i] != i) {
+    parent[i] = parent[parent[i]];
+    i = parent[i];
+  }
+  return i;
+}
+
+static void DoorJoin(short* parent, int a, int b) {
+  if (parent[b] < 0) {
+    return;
+  }
+  a = DoorRoot(parent, a);
+  b = DoorRoot(parent, b);
+  if (a < b) {
+    parent[b] = a;
+  } else if (b < a) {
+    parent[a] = b;
+  }
+}
+
+void LevelFindDoors(Level level, LevelDoors* doors) {
+  // Union-find over the doors, joining each to the neighbours already
+  // visited: left, up-left, up and up-right.
+  short* parent = doors->cells;  // Scratch until the groups are listed
+  for (int y = 0; y < LEVEL_HEIGHT; y++) {
+    for (int x = 0; x < LEVEL_WIDTH; x++) {
+      int i = x + y * LEVEL_WIDTH;
+      parent[i] = -1;
+      if (level[i] != kDoor) {
+        continue;
+      }
+      parent[i] = i;
+      if (x > 0) {
+        DoorJoin(parent, i, i - 1);
+      }
+      if (y > 0) {
+        if (x > 0) {
+          DoorJoin(parent, i, i - LEVEL_WIDTH - 1);
+        }
+        DoorJoin(parent, i, i - LEVEL_WIDTH);
+        if (x + 1 < LEVEL_WIDTH) {
+          DoorJoin(parent, i, i - LEVEL_WIDTH + 1);
         }
       }
     }
   }
+
+  // Number the groups in order of their first cell
+  int groupCount = 0;
+  doors->groupStart[0] = 0;
+  for (int i = 0; i < LEVEL_WIDTH * LEVEL_HEIGHT; i++) {
+    doors->groupOf[i] = -1;
+    if (parent[i] < 0) {
+      continue;
+    }
+    int root = DoorRoot(parent, i);
+    if (root == i) {
+      doors->groupStart[++groupCount] = 0;
+      doors->groupOf[i] = groupCount - 1;
+    } else {
+      doors->groupOf[i] = doors->groupOf[root];
+    }
+    doors->groupStart[doors->groupOf[i] + 1]++;
+  }
+  doors->groupCount = groupCount;
+
+  // Counting sort of the cells into their groups, reusing parent's space
+  for (int g = 0; g < groupCount; g++) {
+    doors->groupStart[g + 1] += doors->groupStart[g];
+  }
+  short next[LEVEL_WIDTH * LEVEL_HEIGHT / 2 + 1];
+  for (int g = 0; g < groupCount; g++) {
+    next[g] = doors->groupStart[g];
+  }
+  for (int i = 0; i < LEVEL_WIDTH * LEVEL_HEIGHT; i++) {
+    if (doors->groupOf[i] >= 0) {
+      doors->cells[next[doors->groupOf[i]]++] = i;
+    }
+  }
+}
+
+void LevelOpenDoor(Level level, const LevelDoors* doors, int x, int y) {
+  int index = LevelXYToIndex(x, y);
+  if (level[index] != kDoor) {
+    return;
+  }
+  int group = doors->groupOf[index];
+  for (int i = doors->groupStart[group]; i < doors->groupStart[group + 1];
+       i++) {
+    level[doors->cells[i]] = kSpace;
+  }
 }
 
 NSString* CellToNSString(Cell c) {